@@ -0,0 +1,121 @@
+/**
+ *
+ * @file
+ *
+ *  BBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions realcomplex dz -> sc
+ *
+ **/
+
+#include "bblas.h"
+
+/*****************************************************************************
+ *
+ * @ingroup gemm_realcomplex_batch
+ *
+ * blas_dzgemm_batch is a batch version of zgemm for a real A. It performs
+ * the matrix-matrix multiplications
+ *
+ *  \f[ C[i] = \alpha[i] [op( A[i] ) \times op( B[i] )] + \beta[i] C[i], \f]
+ *
+ *  where A[i] are real matrices and B[i] and C[i] are complex matrices.
+ *  See blas_dzgemm_batchf.
+ *
+ ******************************************************************************
+ *
+ * @param[in] group_count, group_sizes, layout, transa, transb, m, n, k, alpha
+ *          As in blas_zgemm_batch.
+ *
+ * @param[in] A
+ *          Array of pointers to the real matrices A[i].
+ *          Dimensions as in blas_zgemm_batch.
+ *
+ * @param[in] lda
+ *          As in blas_zgemm_batch.
+ *
+ * @param[in] B
+ *          Array of pointers to the complex matrices B[i].
+ *          Dimensions as in blas_zgemm_batch.
+ *
+ * @param[in] ldb, beta, C, ldc, info
+ *          As in blas_zgemm_batch.
+ *
+ ******************************************************************************
+ *
+ * @retval BblasSuccess successful exit
+ *
+ *******************************************************************************
+ *
+ * @sa dzgemm_batch
+ * @sa scgemm_batch
+ *
+ ******************************************************************************/
+void blas_dzgemm_batch(bblas_int group_count, const bblas_int *group_sizes,
+                       bblas_enum_t layout, const bblas_enum_t *transa, const bblas_enum_t *transb,
+                       const bblas_int *m, const bblas_int *n, const bblas_int *k,
+                       const bblas_complex64_t *alpha, double            const *const *A, const bblas_int *lda,
+                                                       bblas_complex64_t const *const *B, const bblas_int *ldb,
+                       const bblas_complex64_t *beta,  bblas_complex64_t             **C, const bblas_int *ldc,
+                       bblas_int *info)
+{
+
+	// Check input arguments
+	if (group_count < 0) {
+		bblas_error("Illegal value of group_count");
+		info[0] = -1;
+		return;
+	}
+
+	bblas_int offset = 0;
+	bblas_int info_offset = 0;
+	bblas_int info_option = info[0];
+	bblas_int flag = 0;
+	// Check group_size and call fixed batch computation
+	for (bblas_int group_iter = 0; group_iter < group_count; group_iter++) {
+
+		if (info_option == BblasErrorsReportAll)
+			info_offset = offset+1;
+		else if (info_option == BblasErrorsReportGroup)
+			info_offset = group_iter+1;
+		else
+			info_offset = 0;
+		info[info_offset] = info_option;
+
+		if (group_sizes[group_iter] < 0) {
+			bblas_error("Illegal values of group_sizes");
+			info[0] = -2;
+			return;
+		}
+
+		bblas_int group_offset = offset;
+		offset += group_sizes[group_iter];
+
+		// Skip the group where nothing needs to be done
+		if (m[group_iter] == 0 || n[group_iter] == 0 ||
+				((alpha[group_iter] == (bblas_complex64_t)0.0 ||
+				 k[group_iter] == 0) &&
+				 beta[group_iter] == (bblas_complex64_t)1.0 ) ||
+				 group_sizes[group_iter] == 0) {
+			bblas_success(info_option, &info[info_offset], group_sizes[group_iter]);
+			continue;
+		}
+
+		// Call to blas_dzgemm_batchf
+		blas_dzgemm_batchf(group_sizes[group_iter],
+                           layout, transa[group_iter], transb[group_iter],
+                           m[group_iter], n[group_iter], k[group_iter],
+                           alpha[group_iter], A+group_offset, lda[group_iter],
+                                              B+group_offset, ldb[group_iter],
+                           beta[group_iter],  C+group_offset, ldc[group_iter],
+                           &info[info_offset]);
+
+		// check for errors in batchf function
+		if (info[info_offset] != 0 && flag == 0) {
+			info[0] = info[info_offset];
+			flag = 1;
+		}
+	}
+}
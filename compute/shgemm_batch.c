@@ -0,0 +1,122 @@
+/**
+ *
+ * @file
+ *
+ *  BBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions half sh -> sb
+ *
+ **/
+
+#include "bblas.h"
+
+/*****************************************************************************
+ *
+ * @ingroup gemm_mixed_batch
+ *
+ * blas_shgemm_batch is a mixed precision batch version of sgemm. It performs
+ * the matrix-matrix multiplications
+ *
+ *  \f[ C[i] = \alpha[i] [op( A[i] ) \times op( B[i] )] + \beta[i] C[i], \f]
+ *
+ *  where A[i] and B[i] are fp16 numbers, while alpha, beta and C[i] are
+ *  in single precision and the products are accumulated in single precision.
+ *  See blas_shgemm_batchf.
+ *
+ ******************************************************************************
+ *
+ * @param[in] group_count, group_sizes, layout, transa, transb, m, n, k, alpha
+ *          As in blas_sgemm_batch.
+ *
+ * @param[in] A
+ *          Array of pointers to the fp16 matrices A[i].
+ *          Dimensions as in blas_sgemm_batch.
+ *
+ * @param[in] lda
+ *          As in blas_sgemm_batch.
+ *
+ * @param[in] B
+ *          Array of pointers to the fp16 matrices B[i].
+ *          Dimensions as in blas_sgemm_batch.
+ *
+ * @param[in] ldb, beta, C, ldc, info
+ *          As in blas_sgemm_batch.
+ *
+ ******************************************************************************
+ *
+ * @retval BblasSuccess successful exit
+ *
+ *******************************************************************************
+ *
+ * @sa shgemm_batch
+ * @sa sbgemm_batch
+ *
+ ******************************************************************************/
+void blas_shgemm_batch(bblas_int group_count, const bblas_int *group_sizes,
+                       bblas_enum_t layout, const bblas_enum_t *transa, const bblas_enum_t *transb,
+                       const bblas_int *m, const bblas_int *n, const bblas_int *k,
+                       const float *alpha, bblas_half_t const *const *A, const bblas_int *lda,
+                                           bblas_half_t const *const *B, const bblas_int *ldb,
+                       const float *beta,  float                   **C, const bblas_int *ldc,
+                       bblas_int *info)
+{
+
+	// Check input arguments
+	if (group_count < 0) {
+		bblas_error("Illegal value of group_count");
+		info[0] = -1;
+		return;
+	}
+
+	bblas_int offset = 0;
+	bblas_int info_offset = 0;
+	bblas_int info_option = info[0];
+	bblas_int flag = 0;
+	// Check group_size and call fixed batch computation
+	for (bblas_int group_iter = 0; group_iter < group_count; group_iter++) {
+
+		if (info_option == BblasErrorsReportAll)
+			info_offset = offset+1;
+		else if (info_option == BblasErrorsReportGroup)
+			info_offset = group_iter+1;
+		else
+			info_offset = 0;
+		info[info_offset] = info_option;
+
+		if (group_sizes[group_iter] < 0) {
+			bblas_error("Illegal values of group_sizes");
+			info[0] = -2;
+			return;
+		}
+
+		bblas_int group_offset = offset;
+		offset += group_sizes[group_iter];
+
+		// Skip the group where nothing needs to be done
+		if (m[group_iter] == 0 || n[group_iter] == 0 ||
+				((alpha[group_iter] == 0.0f ||
+				 k[group_iter] == 0) &&
+				 beta[group_iter] == 1.0f ) ||
+				 group_sizes[group_iter] == 0) {
+			bblas_success(info_option, &info[info_offset], group_sizes[group_iter]);
+			continue;
+		}
+
+		// Call to blas_shgemm_batchf
+		blas_shgemm_batchf(group_sizes[group_iter],
+                           layout, transa[group_iter], transb[group_iter],
+                           m[group_iter], n[group_iter], k[group_iter],
+                           alpha[group_iter], A+group_offset, lda[group_iter],
+                                              B+group_offset, ldb[group_iter],
+                           beta[group_iter],  C+group_offset, ldc[group_iter],
+                           &info[info_offset]);
+
+		// check for errors in batchf function
+		if (info[info_offset] != 0 && flag == 0) {
+			info[0] = info[info_offset];
+			flag = 1;
+		}
+	}
+}
@@ -0,0 +1,180 @@
+/**
+ *
+ * @file
+ *
+ *  BBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+
+#include "bblas.h"
+
+
+/***************************************************************************//**
+ *
+ * @ingroup gbmm_batch
+ *
+ *  Performs the batch matrix-matrix operations
+ *
+ *     \f[ C[j] = \alpha[i] [op( A[j] ) \times B[j]] + \beta[i] C[j] \f]
+ *
+ *  for the matrices j of each group i, where op( A[j] ) is an
+ *  m[i]-by-k[i] band matrix with kl[i] sub-diagonals and ku[i]
+ *  super-diagonals (as A[j], before op), of which only the band is stored,
+ *  B[j] is a k[i]-by-n[i] matrix and C[j] an m[i]-by-n[i] matrix.
+ *
+ *******************************************************************************
+ * @param[in] group_count
+ * 	    The number groups of matrices.
+ *
+ * @param[in] group_sizes
+ * 	    An array of integers of length group_count, where
+ * 	    group_sizes[i] denotes the number of matrices in i-th group.
+ *
+ * @param[in] layout
+ * 	    Specifies if the matrix is stored in row major or column major
+ * 	    format:
+ * 	    - BblasRowMajor: Row major format
+ * 	    - BblasColMajor: Column major format
+ *
+ * @param[in] transa
+ * 	    An array of length group_count; transa[i] is BblasNoTrans,
+ * 	    BblasTrans or BblasConjTrans, the op of the matrices A[j] of
+ * 	    i-th group.
+ *
+ * @param[in] m, n, k
+ * 	    Arrays of length group_count; the dimensions of the products
+ * 	    of i-th group. m[i], n[i], k[i] >= 0.
+ *
+ * @param[in] kl, ku
+ * 	    Arrays of length group_count; the numbers of sub-diagonals and
+ * 	    super-diagonals of the matrices A[j] of i-th group.
+ * 	    kl[i], ku[i] >= 0.
+ *
+ * @param[in] alpha
+ *          An array of scalars of length group_count.
+ *
+ * @param[in] A
+ * 	    A is an array of pointers to the bands of the matrices
+ * 	    A[0], A[1] .. A[batch_count-1], stored as in blas_zgbmm_batchf.
+ *	    batch_count = \sum_{i=0}^{group_count-1}group_sizes[i].
+ *
+ * @param[in] lda
+ * 	    An array of length group_count, where lda[i] is the leading
+ * 	    dimension of the arrays A[j] of i-th group. lda[i] >= kl[i]+ku[i]+1.
+ *
+ * @param[in] B
+ * 	    B is an array of pointers to matrices B[0], B[1] .. B[batch_count-1],
+ * 	    where each B[j] of i-th group is a k[i]-by-n[i] matrix.
+ *
+ * @param[in] ldb
+ * 	    An array of length group_count, where ldb[i] is the leading
+ * 	    dimension of the arrays B[j] of i-th group.
+ *
+ * @param[in] beta
+ *          An array of scalars of length group_count.
+ *
+ * @param[in,out] C
+ * 	    C is an array of pointers to matrices C[0], C[1] .. C[batch_count-1],
+ * 	    where each C[j] of i-th group is an m[i]-by-n[i] matrix.
+ *
+ * @param[in] ldc
+ * 	    An array of length group_count, where ldc[i] is the leading
+ * 	    dimension of the arrays C[j] of i-th group.
+ *
+ * @param[in,out] info
+ * 		Array of bblas_int for error handling. On entry info[0] should have one of the
+ * 		following values
+ *			- BblasErrorsReportAll    :  All errors will be specified on output.
+ *						     Length of the array should be atleast
+ *						     \sum_{i=0}^{group_count-1}group_sizes[i]+1.
+ *			- BblasErrorsReportGroup  :  Single error from each group will be
+ *						     reported. Length of the array should
+ *						     be atleast group_count+1.
+ *			- BblasErrorsReportAny    :  Occurence of an error will be indicated
+ *						     by a single integer value, and length
+ *						     of the array should be atleast 1.
+ *			- BblasErrorsReportNone   :  No error will be reported on output, and
+ *						     length of the array should be atleast 1.
+ ******************************************************************************
+ *
+ * @retval BblasSuccess successful exit
+ *
+ *******************************************************************************
+ *
+ * @sa zgbmm_batch
+ * @sa cgbmm_batch
+ * @sa dgbmm_batch
+ * @sa sgbmm_batch
+ *
+ ******************************************************************************/
+void blas_zgbmm_batch(bblas_int group_count, const bblas_int *group_sizes,
+                      bblas_enum_t layout, const bblas_enum_t *transa,
+                      const bblas_int *m, const bblas_int *n, const bblas_int *k,
+                      const bblas_int *kl, const bblas_int *ku,
+                      const bblas_complex64_t *alpha, bblas_complex64_t const *const *A, const bblas_int *lda,
+                                                      bblas_complex64_t const* const *B, const bblas_int *ldb,
+                      const bblas_complex64_t *beta,  bblas_complex64_t            ** C, const bblas_int *ldc,
+                      bblas_int *info)
+{
+	// Check input arguments
+	if (group_count < 0) {
+		bblas_error("Illegal value of group_count");
+		info[0] = -1;
+		return;
+	}
+
+	bblas_int offset = 0;
+	bblas_int info_offset = 0;
+	bblas_int info_option = info[0];
+	bblas_int flag = 0;
+	// Check group_size and call fixed batch computation
+	for (bblas_int group_iter = 0; group_iter < group_count; group_iter++) {
+
+		if (info_option == BblasErrorsReportAll)
+			info_offset = offset+1;
+		else if (info_option == BblasErrorsReportGroup)
+			info_offset = group_iter+1;
+		else
+			info_offset = 0;
+		info[info_offset] = info_option;
+
+		if (group_sizes[group_iter] < 0) {
+			bblas_error("Illegal values of group_sizes");
+			info[0] = -2;
+			return;
+		}
+
+		bblas_int group_offset = offset;
+		offset += group_sizes[group_iter];
+
+		// Skip the group where nothing needs to be done
+		if (m[group_iter] == 0 || n[group_iter] == 0 ||
+				((alpha[group_iter] == (bblas_complex64_t)0.0 ||
+				 k[group_iter] == 0) &&
+				 beta[group_iter] == (bblas_complex64_t)1.0) ||
+				group_sizes[group_iter] == 0) {
+			bblas_success(info_option, &info[info_offset], group_sizes[group_iter]);
+			continue;
+		}
+
+		// Call to blas_zgbmm_batchf
+		blas_zgbmm_batchf(group_sizes[group_iter],
+		                  layout, transa[group_iter],
+		                  m[group_iter], n[group_iter], k[group_iter],
+		                  kl[group_iter], ku[group_iter],
+		                  alpha[group_iter], A+group_offset, lda[group_iter],
+		                                     B+group_offset, ldb[group_iter],
+		                  beta[group_iter],  C+group_offset, ldc[group_iter],
+		                  &info[info_offset]);
+
+		// check for errors in batchf function
+		if (info[info_offset] != 0 && flag == 0) {
+			info[0] = info[info_offset];
+			flag = 1;
+		}
+	}
+}
@@ -0,0 +1,207 @@
+/**
+ *
+ * @file
+ *
+ *  BBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+
+#include "bblas.h"
+
+#include <string.h>
+
+#define COMPLEX
+
+// With MKL, real matrices are packed by MKL itself.
+#if defined(HAVE_MKL) && defined(REAL)
+#define VENDOR_PACK
+#endif
+
+#ifdef VENDOR_PACK
+/******************************************************************************/
+// blas_zgemm_batchf on the matrices packed by cblas_zgemm_pack, which already
+// hold alpha*op( A[i] ); lda is ignored, as by cblas_zgemm_compute.
+static void zgemm_batchf_packed(bblas_int group_size, bblas_enum_t layout,
+                                bblas_enum_t transb,
+                                bblas_int m, bblas_int n, bblas_int k,
+                                void *const *A, bblas_int lda,
+                                bblas_complex64_t const* const *B, bblas_int ldb,
+                                bblas_complex64_t beta,
+                                bblas_complex64_t **C, bblas_int ldc,
+                                bblas_int *info)
+{
+	// Check input arguments, numbered as in blas_zgemm_batchf
+	if ((transb != BblasNoTrans) &&
+        (transb != BblasTrans) &&
+        (transb != BblasConjTrans) &&
+        (transb != BblasConjNoTrans)) {
+		bblas_error("Illegal value of transb");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 3);
+		}
+		return;
+	}
+	bblas_int bm = bblas_transposed(transb) ? n : k;
+	bblas_int cm = m;
+	if (layout == BblasRowMajor) {
+		bm = bblas_transposed(transb) ? k : n;
+		cm = n;
+	}
+	if (ldb < imax(1, bm)) {
+		bblas_error("Illegal value of ldb");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 8);
+		}
+		return;
+	}
+	if (ldc < imax(1, cm)) {
+		bblas_error("Illegal value of ldc");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 9);
+		}
+		return;
+	}
+
+	// Conjugation is a no-op in real arithmetic.
+	bblas_enum_t op = bblas_transposed(transb) ? BblasTrans : BblasNoTrans;
+	for (bblas_int iter = 0; iter < group_size; iter++) {
+		cblas_zgemm_compute(layout, CblasPacked, op,
+		                    m, n, k,
+		                    (const bblas_complex64_t*)A[iter], lda,
+		                                                       B[iter], ldb,
+		                    beta,                              C[iter], ldc);
+		// BblasSuccess
+		if (info[0] == BblasErrorsReportAll)
+			info[iter] = 0;
+	}
+	// BblasSuccess
+	if (info[0] != BblasErrorsReportAll)
+		info[0] = 0;
+}
+#endif
+
+/*****************************************************************************
+ *
+ * @ingroup gemm_batch_packed
+ *
+ * blas_zgemm_batch_packed is the version of blas_zgemm_batch whose left
+ * operands have been packed by blas_zgemm_pack_batch. It performs the
+ * matrix-matrix multiplications
+ *
+ *  \f[ C[i] = P[i] \times op( B[i] ) + \beta C[i], \f]
+ *
+ *  where P[i] = \alpha op( A[i] ) is the i-th packed matrix. The groups,
+ *  layout, alpha and the dimensions m, n and k are those of the packed
+ *  batch. With MKL, in real precisions, each group is computed by
+ *  cblas_zgemm_compute on MKL's packed matrices; otherwise, by
+ *  blas_zgemm_batchf on the untransposed copies.
+ *
+ ******************************************************************************
+ *
+ * @param[in] packed
+ *          The packed batch, from blas_zgemm_pack_batch.
+ *
+ * @param[in] transb
+ *          Array of length group_count, as in blas_zgemm_batch.
+ *
+ * @param[in] B, ldb, beta, C, ldc
+ *          As in blas_zgemm_batch, for the groups of the packed batch.
+ *
+ * @param[in,out] info
+ *          Array of bblas_int for error handling, as in blas_zgemm_batch.
+ *          On exit, info[0] = -1 if packed is NULL or was not made by
+ *          blas_zgemm_pack_batch.
+ *
+ ******************************************************************************
+ *
+ * @retval BblasSuccess successful exit
+ *
+ *******************************************************************************
+ *
+ * @sa zgemm_batch_packed
+ * @sa cgemm_batch_packed
+ * @sa dgemm_batch_packed
+ * @sa sgemm_batch_packed
+ *
+ ******************************************************************************/
+void blas_zgemm_batch_packed(bblas_packed_t packed, const bblas_enum_t *transb,
+                             bblas_complex64_t const* const *B, const bblas_int *ldb,
+                             const bblas_complex64_t *beta, bblas_complex64_t **C, const bblas_int *ldc,
+                             bblas_int *info)
+{
+	// Check input arguments
+	if (packed == NULL || strcmp(packed->routine, "zgemm") != 0) {
+		bblas_error("Illegal value of packed");
+		info[0] = -1;
+		return;
+	}
+
+	const bblas_int *m = packed->m;
+	const bblas_int *n = packed->n;
+	const bblas_int *k = packed->k;
+	bblas_complex64_t const *const *A = (bblas_complex64_t const *const *)packed->A;
+	bblas_complex64_t one = 1.0;
+	bblas_complex64_t zero = 0.0;
+
+	bblas_int offset = 0;
+	bblas_int info_offset = 0;
+	bblas_int info_option = info[0];
+	bblas_int flag = 0;
+	for (bblas_int group_iter = 0; group_iter < packed->group_count; group_iter++) {
+
+		if (info_option == BblasErrorsReportAll)
+			info_offset = offset+1;
+		else if (info_option == BblasErrorsReportGroup)
+			info_offset = group_iter+1;
+		else
+			info_offset = 0;
+		info[info_offset] = info_option;
+
+		bblas_int group_size = packed->group_sizes[group_iter];
+		bblas_int group_offset = offset;
+		offset += group_size;
+
+		// Skip the group where nothing needs to be done
+		if (m[group_iter] == 0 || n[group_iter] == 0 ||
+				((packed->zero[group_iter] ||
+				 k[group_iter] == 0) &&
+				 beta[group_iter] == (bblas_complex64_t)1.0 ) ||
+				 group_size == 0) {
+			bblas_success(info_option, &info[info_offset], group_size);
+			continue;
+		}
+
+		// With alpha = 0 or k = 0, blas_zgemm_batchf only scales C[i],
+		// without reading A[i], which was not packed.
+		bool scale = packed->zero[group_iter] || k[group_iter] == 0;
+		if (packed->vendor && !scale) {
+#ifdef VENDOR_PACK
+			zgemm_batchf_packed(group_size, packed->layout, transb[group_iter],
+			                    m[group_iter], n[group_iter], k[group_iter],
+			                    packed->A+group_offset, packed->ld[group_iter],
+			                    B+group_offset, ldb[group_iter],
+			                    beta[group_iter], C+group_offset, ldc[group_iter],
+			                    &info[info_offset]);
+#endif
+		}
+		else {
+			blas_zgemm_batchf(group_size,
+			                  packed->layout, BblasNoTrans, transb[group_iter],
+			                  m[group_iter], n[group_iter], k[group_iter],
+			                  scale ? zero : one, A+group_offset, packed->ld[group_iter],
+			                                      B+group_offset, ldb[group_iter],
+			                  beta[group_iter],   C+group_offset, ldc[group_iter],
+			                  &info[info_offset]);
+		}
+
+		// check for errors in batchf function
+		if (info[info_offset] != 0 && flag == 0) {
+			info[0] = info[info_offset];
+			flag = 1;
+		}
+	}
+}
@@ -0,0 +1,212 @@
+/**
+ *
+ * @file
+ *
+ *  BBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+
+#include "bblas.h"
+
+#define COMPLEX
+
+// With MKL, real matrices are packed by MKL itself.
+#if defined(HAVE_MKL) && defined(REAL)
+#define VENDOR_PACK
+#endif
+
+#ifndef VENDOR_PACK
+/******************************************************************************/
+// Copies the rows-by-cols matrix alpha*op( X ), with X column major, to W
+// with leading dimension ldw.
+static void copy_op(bblas_enum_t trans, bblas_int rows, bblas_int cols,
+                    bblas_complex64_t alpha,
+                    const bblas_complex64_t *X, bblas_int ldx,
+                    bblas_complex64_t *W, bblas_int ldw)
+{
+	for (bblas_int j = 0; j < cols; j++) {
+		bblas_complex64_t *w = &W[(size_t)ldw*j];
+		if (trans == BblasNoTrans) {
+			const bblas_complex64_t *x = &X[(size_t)ldx*j];
+			for (bblas_int i = 0; i < rows; i++)
+				w[i] = alpha*x[i];
+		}
+#ifdef COMPLEX
+		else if (trans == BblasConjTrans) {
+			for (bblas_int i = 0; i < rows; i++)
+				w[i] = alpha*conj(X[(size_t)ldx*i + j]);
+		}
+#endif
+		else {
+			for (bblas_int i = 0; i < rows; i++)
+				w[i] = alpha*X[(size_t)ldx*i + j];
+		}
+	}
+}
+#endif
+
+/*****************************************************************************
+ *
+ * @ingroup gemm_batch_packed
+ *
+ * blas_zgemm_pack_batch packs the scaled left operands alpha[i]*op( A[i] )
+ * of a batch of gemms once, so that they can be reused by any number of
+ * calls to blas_zgemm_batch_packed, e.g., for a fixed set of weights
+ * multiplied by a stream of inputs.
+ *
+ * With MKL, in real precisions, each matrix is packed by cblas_zgemm_pack
+ * into MKL's own blocked format, which cblas_zgemm_compute then reads
+ * without packing A again: only B[i] is packed on each call. Otherwise,
+ * alpha[i]*op( A[i] ) is copied untransposed, as an m-by-k matrix in the
+ * given layout whose leading dimension is a whole number of cache lines;
+ * CBLAS still packs the copies on every call, so only the scaling, the
+ * transposition and the strided reads of A[i] are saved.
+ *
+ * Either way, the matrices are stored in a pool owned by BBLAS and aligned
+ * to BBLAS_CACHE_LINE.
+ *
+ ******************************************************************************
+ *
+ * @param[in] group_count
+ *          The number of groups. group_count >= 0.
+ *
+ * @param[in] group_sizes
+ *          Array of length group_count; the number of matrices of each group.
+ *
+ * @param[in] layout
+ *          BblasColMajor or BblasRowMajor, as in the later
+ *          blas_zgemm_batch_packed calls.
+ *
+ * @param[in] transa, m, n, k, alpha, A, lda
+ *          Arrays of length group_count (batch_count for A), as in
+ *          blas_zgemm_batch. m, n and k are those of the later products.
+ *
+ * @param[out] packed
+ *          On exit, the packed batch, to be freed with bblas_packed_free,
+ *          or NULL on error. A[i] may be modified or freed once packed.
+ *
+ ******************************************************************************
+ *
+ * @retval BblasSuccess successful exit
+ * @retval <0 if -i, the i-th argument had an illegal value
+ * @retval BblasErrorOutOfMemory if the pool cannot be allocated
+ *
+ *******************************************************************************
+ *
+ * @sa zgemm_batch_packed
+ * @sa cgemm_batch_packed
+ * @sa dgemm_batch_packed
+ * @sa sgemm_batch_packed
+ *
+ ******************************************************************************/
+bblas_int blas_zgemm_pack_batch(bblas_int group_count, const bblas_int *group_sizes,
+                                bblas_enum_t layout, const bblas_enum_t *transa,
+                                const bblas_int *m, const bblas_int *n, const bblas_int *k,
+                                const bblas_complex64_t *alpha, bblas_complex64_t const *const *A, const bblas_int *lda,
+                                bblas_packed_t *packed)
+{
+	*packed = NULL;
+
+	// Check input arguments
+	if (group_count < 0) {
+		bblas_error("Illegal value of group_count");
+		return -1;
+	}
+	if ((layout != BblasRowMajor) &&
+	    (layout != BblasColMajor)) {
+		bblas_error("Illegal value of layout");
+		return -3;
+	}
+	for (bblas_int group_iter = 0; group_iter < group_count; group_iter++) {
+		if (group_sizes[group_iter] < 0) {
+			bblas_error("Illegal values of group_sizes");
+			return -2;
+		}
+		if ((transa[group_iter] != BblasNoTrans) &&
+		    (transa[group_iter] != BblasTrans) &&
+		    (transa[group_iter] != BblasConjTrans)) {
+			bblas_error("Illegal value of transa");
+			return -4;
+		}
+		if (m[group_iter] < 0) {
+			bblas_error("Illegal value of m");
+			return -5;
+		}
+		if (n[group_iter] < 0) {
+			bblas_error("Illegal value of n");
+			return -6;
+		}
+		if (k[group_iter] < 0) {
+			bblas_error("Illegal value of k");
+			return -7;
+		}
+		// Rows of A as stored, in its layout.
+		bblas_int am;
+		if (layout == BblasColMajor)
+			am = (transa[group_iter] == BblasNoTrans) ? m[group_iter] : k[group_iter];
+		else
+			am = (transa[group_iter] == BblasNoTrans) ? k[group_iter] : m[group_iter];
+		if (lda[group_iter] < imax(1, am)) {
+			bblas_error("Illegal value of lda");
+			return -10;
+		}
+	}
+
+	// Size of a packed matrix of each group; NULL for the copies.
+	size_t *bytes = NULL;
+#ifdef VENDOR_PACK
+	bytes = (size_t*)malloc(((size_t)group_count+1)*sizeof(size_t));
+	if (bytes == NULL) {
+		bblas_error("malloc() failed");
+		return BblasErrorOutOfMemory;
+	}
+	for (bblas_int group_iter = 0; group_iter < group_count; group_iter++)
+		bytes[group_iter] = cblas_zgemm_pack_get_size(CblasAMatrix,
+		                                              m[group_iter], n[group_iter], k[group_iter]);
+#endif
+
+	bblas_packed_t batch = bblas_packed_create("zgemm", layout,
+	                                           group_count, group_sizes, m, n, k,
+	                                           sizeof(bblas_complex64_t), bytes);
+	free(bytes);
+	if (batch == NULL) {
+		bblas_error("malloc() failed");
+		return BblasErrorOutOfMemory;
+	}
+
+	// With alpha = 0, A is not referenced, as in blas_zgemm_batch.
+	// In the column major view of the storage, the copy is op( A )
+	// in column major and op( A )^T = op( A^T ) in row major: in both
+	// layouts, op( X ) of the stored X.
+	bblas_int offset = 0;
+	for (bblas_int group_iter = 0; group_iter < group_count; group_iter++) {
+		bblas_int group_offset = offset;
+		offset += group_sizes[group_iter];
+		batch->zero[group_iter] = alpha[group_iter] == (bblas_complex64_t)0.0;
+		if (batch->zero[group_iter] ||
+		    m[group_iter] == 0 || n[group_iter] == 0 || k[group_iter] == 0)
+			continue;
+
+		for (bblas_int i = group_offset; i < offset; i++) {
+#ifdef VENDOR_PACK
+			cblas_zgemm_pack(layout, CblasAMatrix, transa[group_iter],
+			                 m[group_iter], n[group_iter], k[group_iter],
+			                 alpha[group_iter], A[i], lda[group_iter],
+			                 (bblas_complex64_t*)batch->A[i]);
+#else
+			bblas_int rows = (layout == BblasColMajor) ? m[group_iter] : k[group_iter];
+			bblas_int cols = (layout == BblasColMajor) ? k[group_iter] : m[group_iter];
+			copy_op(transa[group_iter], rows, cols, alpha[group_iter],
+			        A[i], lda[group_iter],
+			        (bblas_complex64_t*)batch->A[i], batch->ld[group_iter]);
+#endif
+		}
+	}
+
+	*packed = batch;
+	return BblasSuccess;
+}
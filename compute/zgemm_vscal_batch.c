@@ -0,0 +1,222 @@
+/**
+ *
+ * @file
+ *
+ *  BBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+
+#include "bblas.h"
+
+/*****************************************************************************
+ *
+ * @ingroup gemm_vscal_batch
+ *
+ * blas_zgemm_vscal_batch is a batch version of zgemm with one alpha and
+ * one beta per matrix instead of per group, so that matrices of the same
+ * size but different scalars can share a group. It performs
+ * matrix-matrix multiplication
+ *
+ *  \f[ C[i] = \alpha[i] [op( A[i] ) \times op( B[i] )] + \beta[i] C[i], \f]
+ *
+ *  where op( X ) is one of:
+ *    \f[ op( X ) = X,   \f]
+ *    \f[ op( X ) = X^T, \f]
+ *    \f[ op( X ) = X^H, \f]
+ *    \f[ op( X ) = \bar{X}, \f]
+ *
+ *  where alpha[i] and beta[i] are scalars, and A[i], B[i] and C[i] are matrices, with 
+ *  op( A[i] ) an m[i]-by-k[i] matrix, op( B[i] ) a k[i]-by-n[i] matrix and C[i] an 
+ *  m[i]-by-n[i] matrix.
+ *
+ ******************************************************************************
+ * @param[in] group_count
+ * 	    The number groups of matrices.	  
+ *
+ * @param[in] group_sizes
+ * 	    An array of integers of length group_count, where group_sizes[i] denotes
+ * 	    the number of matrices in i-th group.	
+ *
+ * @param[in] layout
+ * 	    Specifies if the matrix is stored in row major or column major
+ * 	    format:
+ * 	    - BblasRowMajor: Row major format
+ * 	    - BblasColMajor: Column major format
+ *
+ * @param[in] transa
+ * 	    An array of length group_count, where
+ *          - BblasNoTrans:   A[j]-s in i-th group are not transposed,
+ *          - BblasTrans:     A[j]-s in i-th group are transposed,
+ *          - BblasConjTrans: A[j]-s in i-th group are conjugate transposed,
+ *          - BblasConjNoTrans: A[j]-s in i-th group are conjugated, not
+ *            transposed.
+ *
+ * @param[in] transb
+ * 	    An array of length group_count, where
+ *          - BblasNoTrans:   B[j]-s in the i-th group are not transposed,
+ *          - BblasTrans:     B[j]-s in the i-th group are transposed,
+ *          - BblasConjTrans: B[j]-s in the i-th group are conjugate transposed,
+ *          - BblasConjNoTrans: B[j]-s in the i-th group are conjugated, not
+ *            transposed.
+ *
+ * @param[in] m
+ *          An array of integers of length group_count, where m[i] is 
+ *          the number of rows of matrices op( A[j] ) and of matrices 
+ *          C[j] in i-th group. m[i] >= 0.
+ *
+ * @param[in] n
+ *          An array of integers of length group_count, where n[i] is 
+ *          the number of columns of matrices op( B[j] ) and C[j] in 
+ *          i-th group. n[i] >= 0.
+ *
+ * @param[in] k
+ *          An array of integers, where k[i] is the number of columns of  
+ *          matrices op( A[j] ) and number of rows of matrices op( B[j] )
+ *          in i-th group. k[i] >= 0.
+ *
+ * @param[in] alpha
+ *          An array of scalars of length batch_count, one per matrix,
+ *          batch_count = \sum_{i=0}^{group_count-1}group_sizes[i].
+ *
+ * @param[in] A
+ * 		A is an array of pointers to matrices A[0], A[1] .. A[batch_count-1]. 
+ * 		If in i-th group, each element A[j] is a pointer to a matrix of 
+ * 		dimension lda[i]-by-ka[i], where ka[i] is k[i] when transa[i] = 
+ * 		BblasNoTrans, and is m[i] otherwise. When using transa[i] = 
+ * 		BblasNoTrans the leading m[i]-by-k[i] part of A[j] 
+ * 		must contain the matrix elements, otherwise the leading  
+ * 		k[i]-by-m[i] part of A[j] must contain the matrix elements.
+ *		batch_count = \sum_{i=0}^{group_count-1}group_sizes[i].
+ *
+ * @param[in] lda
+ * 	    An array of integers of length group_count, which
+ * 	    denotes the leading dimension of the arrays A[j]-s
+ * 	    in i-th group. When transa[i] = BblasNoTrans, 
+ * 	    lda[i] >= max(1,m[i]), otherwise, lda[i] >= max(1,k[i]).
+ *
+ * @param[in] B
+ * 		B is an array of pointers to matrices B[0], B[1],..,B[batch_count-1].
+ * 		If in i-th group, each element B[j] is a pointer to a matrix
+ * 		of dimension lda[i]-by-kb, where kb is n[i] when transb[i] = 
+ * 		BblasNoTrans, and is k[i] otherwise. When using transb[i] = 
+ * 		BblasNoTrans the leading k[i]-by-n[i] part of B[j] 
+ * 		must contain the matrix elements, otherwise the leading  
+ * 		n[i]-by-k[i] part of B[j] must contain the matrix elements.
+ *		batch_count = \sum_{i=0}^{group_count-1}group_sizes[i].
+ *
+ * @param[in] ldb
+ * 	    An array of integers of size group_count, which 
+ * 	    denotes the leading dimension of the array B[j]-s
+ * 	    in i-th group. When transb[i] = BblasNoTrans, 
+ * 	    ldb[i] >= max(1,k[i]), otherwise, ldb[i] >= max(1,n[i]).
+ *
+ * @param[in] beta
+ *          An array of scalars of length batch_count, one per matrix.
+ *
+ * @param[in,out] C
+ * 		C is an array of pointers to matrices C[0], C[1],...,C[batch_count-1].
+ * 		In i-th group each element C[j] is a pointer to a matrix of dimension 
+ *		ldc[j]-by-n[j]. On exit, each array C[j] of i-th group is overwritten 
+ *		by the m[i]-by-n[i] matrix ( alpha[j]*op(A[j] )*op( B[j] ) + beta[j]*C[j] ),
+ *		where j=0,1,...,group_sizes[i-1].
+ *
+ * @param[in] ldc
+ * 	    An array of integers of length group_count, which
+ *          denotes the leading dimension of the arrays C[j]
+ *          in i-th group. ldc[i] >= max(1,m[i]).
+ *
+ *
+ * @param[in,out] info
+ * 		Array of bblas_int for error handling. On entry info[0] should have one of the 
+ * 		following values
+ *			- BblasErrorsReportAll    :  All errors will be specified on output.
+ *						     Length of the array should be atleast
+ *						     \sum_{i=0}^{group_count-1}group_sizes[i]+1.
+ *			- BblasErrorsReportGroup  :  Single error from each group will be 
+ *						     reported. Length of the array should 
+ *						     be atleast group_count+1.
+ *			- BblasErrorsReportAny    :  Occurence of an error will be indicated
+ *						     by a single integer value, and length 
+ *						     of the array should be atleast 1.
+ *			- BblasErrorsReportNone   :  No error will be reported on output, and
+ *						     length of the array should be atleast 1.
+ ******************************************************************************
+ *
+ * @retval BblasSuccess successful exit
+ *
+ *******************************************************************************
+ *
+ * @sa zgemm_vscal_batch
+ * @sa cgemm_vscal_batch
+ * @sa dgemm_vscal_batch
+ * @sa sgemm_vscal_batch
+ *
+ ******************************************************************************/
+void blas_zgemm_vscal_batch(bblas_int group_count, const bblas_int *group_sizes,
+		      bblas_enum_t layout, const bblas_enum_t *transa, const bblas_enum_t *transb,
+		      const bblas_int *m, const bblas_int *n, const bblas_int *k,
+		      const bblas_complex64_t *alpha, bblas_complex64_t const *const *A, const bblas_int *lda,
+		      				      bblas_complex64_t const* const *B, const bblas_int *ldb, 
+		      const bblas_complex64_t *beta,  bblas_complex64_t            ** C, const bblas_int *ldc, 
+		      bblas_int *info)
+{
+
+	// Check input arguments 
+	if (group_count < 0) {
+		bblas_error("Illegal value of group_count");
+		info[0] = -1;
+		return;
+	}
+
+	bblas_int offset = 0;
+	bblas_int info_offset = 0;
+	bblas_int info_option = info[0];
+	bblas_int flag = 0;
+	// Check group_size and call fixed batch computation
+	for (bblas_int group_iter = 0; group_iter < group_count; group_iter++) {
+
+		if (info_option == BblasErrorsReportAll)
+			info_offset = offset+1;
+		else if (info_option == BblasErrorsReportGroup)
+			info_offset = group_iter+1;
+		else
+			info_offset = 0;
+		info[info_offset] = info_option;
+
+		if (group_sizes[group_iter] < 0) {
+			bblas_error("Illegal values of group_sizes");
+			info[0] = -2;
+			return;
+		}
+
+		bblas_int group_offset = offset;
+		offset += group_sizes[group_iter];
+
+		// Skip the group where nothing needs to be done; the scalars
+		// are checked per matrix in blas_zgemm_vscal_batchf.
+		if (m[group_iter] == 0 || n[group_iter] == 0 ||
+				group_sizes[group_iter] == 0) {
+			bblas_success(info_option, &info[info_offset], group_sizes[group_iter]);
+			continue;
+		}
+
+		// Call to blas_zgemm_vscal_batchf
+		blas_zgemm_vscal_batchf(group_sizes[group_iter],
+		                        layout, transa[group_iter], transb[group_iter],
+		                        m[group_iter], n[group_iter], k[group_iter],
+		                        alpha+group_offset, A+group_offset, lda[group_iter],
+		                                            B+group_offset, ldb[group_iter],
+		                        beta+group_offset,  C+group_offset, ldc[group_iter],
+		                        &info[info_offset]);
+
+		// check for errors in batchf function
+		if (info[info_offset] != 0 && flag == 0) {
+			info[0] = info[info_offset];
+			flag = 1;
+		}
+	}
+}
@@ -0,0 +1,150 @@
+/**
+ *
+ * @file
+ *
+ *  BBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+
+#include "bblas.h"
+
+
+/***************************************************************************//**
+ *
+ * @ingroup gtsv_batch
+ *
+ *  Solves the batch of tridiagonal linear systems
+ *
+ *     \f[ A[j] \times X[j] = B[j] \f]
+ *
+ *  for the matrices j of each group i, where A[j] is an n[i]-by-n[i]
+ *  tridiagonal matrix, given by its three diagonals, and X[j] and B[j] are
+ *  n[i]-by-nrhs[i] matrices, by Gaussian elimination with partial pivoting.
+ *  The systems of a group are solved several at a time, vectorized across
+ *  the systems; see blas_zgtsv_batchf.
+ *
+ *******************************************************************************
+ * @param[in] group_count
+ * 	    The number groups of matrices.
+ *
+ * @param[in] group_sizes
+ * 	    An array of integers of length group_count, where
+ * 	    group_sizes[i] denotes the number of matrices in i-th group.
+ *
+ * @param[in] layout
+ * 	    Specifies if the matrices B[j] are stored in row major or column
+ * 	    major format:
+ * 	    - BblasRowMajor: Row major format
+ * 	    - BblasColMajor: Column major format
+ *
+ * @param[in] n
+ * 	    An array of length group_count; the order of the matrices A[j]
+ * 	    of i-th group. n[i] >= 0.
+ *
+ * @param[in] nrhs
+ * 	    An array of length group_count; the number of columns of the
+ * 	    matrices B[j] of i-th group. nrhs[i] >= 0.
+ *
+ * @param[in,out] dl, d, du
+ * 	    Arrays of pointers to the sub-diagonals, of length n[i]-1, the
+ * 	    diagonals, of length n[i], and the super-diagonals, of length
+ * 	    n[i]-1, of the matrices A[0], A[1] .. A[batch_count-1].
+ * 	    On exit, the factors of the A[j], as in blas_zgtsv_batchf.
+ *	    batch_count = \sum_{i=0}^{group_count-1}group_sizes[i].
+ *
+ * @param[in,out] B
+ * 	    B is an array of pointers to matrices B[0], B[1] .. B[batch_count-1].
+ * 	    On exit, the solutions X[j].
+ *
+ * @param[in] ldb
+ * 	    An array of length group_count, where ldb[i] is the leading
+ * 	    dimension of the arrays B[j] of i-th group.
+ *
+ * @param[in,out] info
+ * 		Array of bblas_int for error handling. On entry info[0] should have one of the
+ * 		following values
+ *			- BblasErrorsReportAll    :  All errors will be specified on output.
+ *						     Length of the array should be atleast
+ *						     \sum_{i=0}^{group_count-1}group_sizes[i]+1.
+ *			- BblasErrorsReportGroup  :  Single error from each group will be
+ *						     reported. Length of the array should
+ *						     be atleast group_count+1.
+ *			- BblasErrorsReportAny    :  Occurence of an error will be indicated
+ *						     by a single integer value, and length
+ *						     of the array should be atleast 1.
+ *			- BblasErrorsReportNone   :  No error will be reported on output, and
+ *						     length of the array should be atleast 1.
+ *		Singular matrices are reported as BblasErrorSingular.
+ ******************************************************************************
+ *
+ * @retval BblasSuccess successful exit
+ *
+ *******************************************************************************
+ *
+ * @sa zgtsv_batch
+ * @sa cgtsv_batch
+ * @sa dgtsv_batch
+ * @sa sgtsv_batch
+ *
+ ******************************************************************************/
+void blas_zgtsv_batch(bblas_int group_count, const bblas_int *group_sizes,
+                      bblas_enum_t layout, const bblas_int *n, const bblas_int *nrhs,
+                      bblas_complex64_t **dl, bblas_complex64_t **d, bblas_complex64_t **du,
+                      bblas_complex64_t **B, const bblas_int *ldb,
+                      bblas_int *info)
+{
+	// Check input arguments
+	if (group_count < 0) {
+		bblas_error("Illegal value of group_count");
+		info[0] = -1;
+		return;
+	}
+
+	bblas_int offset = 0;
+	bblas_int info_offset = 0;
+	bblas_int info_option = info[0];
+	bblas_int flag = 0;
+	// Check group_size and call fixed batch computation
+	for (bblas_int group_iter = 0; group_iter < group_count; group_iter++) {
+
+		if (info_option == BblasErrorsReportAll)
+			info_offset = offset+1;
+		else if (info_option == BblasErrorsReportGroup)
+			info_offset = group_iter+1;
+		else
+			info_offset = 0;
+		info[info_offset] = info_option;
+
+		if (group_sizes[group_iter] < 0) {
+			bblas_error("Illegal values of group_sizes");
+			info[0] = -2;
+			return;
+		}
+
+		bblas_int group_offset = offset;
+		offset += group_sizes[group_iter];
+
+		// Skip the group where nothing needs to be done
+		if (n[group_iter] == 0 || group_sizes[group_iter] == 0) {
+			bblas_success(info_option, &info[info_offset], group_sizes[group_iter]);
+			continue;
+		}
+
+		// Call to blas_zgtsv_batchf
+		blas_zgtsv_batchf(group_sizes[group_iter], layout,
+		                  n[group_iter], nrhs[group_iter],
+		                  dl+group_offset, d+group_offset, du+group_offset,
+		                  B+group_offset, ldb[group_iter],
+		                  &info[info_offset]);
+
+		// check for errors in batchf function
+		if (info[info_offset] != 0 && flag == 0) {
+			info[0] = info[info_offset];
+			flag = 1;
+		}
+	}
+}
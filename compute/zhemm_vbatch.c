@@ -0,0 +1,175 @@
+/**
+ *
+ * @file
+ *
+ *  BBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> c
+ *
+ **/
+
+#include "bblas.h"
+
+#include <stdlib.h>
+
+/*****************************************************************************
+ *
+ * @ingroup hemm_vbatch
+ *
+ * blas_zhemm_vbatch is a variable size batch version of zhemm. It
+ * performs the hermitian matrix-matrix multiplications
+ *
+ *  \f[ C[i] = \alpha A[i] \times B[i] + \beta C[i], \f] or
+ *  \f[ C[i] = \alpha B[i] \times A[i] + \beta C[i], \f]
+ *
+ *  where each matrix has its own dimensions and leading dimensions, given
+ *  in any order. The matrices are sorted by shape with bblas_bucket and
+ *  each set of matrices of the same shape is computed by
+ *  blas_zhemm_batchf, so the caller need not group them.
+ *
+ ******************************************************************************
+ *
+ * @param[in] batch_count
+ *          The number of matrices. batch_count >= 0.
+ *
+ * @param[in] layout, side, uplo
+ *          As in blas_zhemm_batchf, for all the matrices.
+ *
+ * @param[in] m, n
+ *          Arrays of length batch_count, with the dimensions of
+ *          the matrices as in blas_zhemm_batchf.
+ *
+ * @param[in] alpha
+ *          The scalar alpha.
+ *
+ * @param[in] A
+ *          Array of pointers to the matrices A[i].
+ *
+ * @param[in] lda
+ *          Array of length batch_count; lda[i] is the leading dimension of A[i].
+ *
+ * @param[in] B
+ *          Array of pointers to the matrices B[i].
+ *
+ * @param[in] ldb
+ *          Array of length batch_count; ldb[i] is the leading dimension of B[i].
+ *
+ * @param[in] beta
+ *          The scalar beta.
+ *
+ * @param[in,out] C
+ *          Array of pointers to the matrices C[i].
+ *
+ * @param[in] ldc
+ *          Array of length batch_count; ldc[i] is the leading dimension of C[i].
+ *
+ * @param[in,out] info
+ *          Array of bblas_int for error handling. On entry info[0] should be one of
+ *          - BblasErrorsReportAll: on exit, info[i+1] is the error code of
+ *            matrix i. Length at least batch_count+1.
+ *          - BblasErrorsReportGroup, BblasErrorsReportAny: since the groups
+ *            are internal, both report a single error. Length at least 1.
+ *          - BblasErrorsReportNone: no error is reported. Length at least 1.
+ *
+ *          On exit, info[0] is the first error code, in the order of the
+ *          groups, or 0.
+ *
+ ******************************************************************************
+ *
+ * @retval BblasSuccess successful exit
+ *
+ *******************************************************************************
+ *
+ * @sa zhemm_vbatch
+ * @sa chemm_vbatch
+ *
+ ******************************************************************************/
+void blas_zhemm_vbatch(bblas_int batch_count,
+                       bblas_enum_t layout, bblas_enum_t side, bblas_enum_t uplo,
+                       const bblas_int *m, const bblas_int *n,
+                       bblas_complex64_t alpha, bblas_complex64_t const *const *A, const bblas_int *lda,
+                                                bblas_complex64_t const *const *B, const bblas_int *ldb,
+                       bblas_complex64_t beta,  bblas_complex64_t             **C, const bblas_int *ldc,
+                       bblas_int *info)
+{
+	// Check input arguments
+	if (batch_count < 0) {
+		bblas_error("Illegal value of batch_count");
+		info[0] = -1;
+		return;
+	}
+	bblas_int info_option = info[0];
+
+	// Matrices in group order, their info, and the groups.
+	bblas_int *perm  = (bblas_int*)malloc(((size_t)batch_count+1)*sizeof(bblas_int));
+	bblas_int *start = (bblas_int*)malloc(((size_t)batch_count+1)*sizeof(bblas_int));
+	bblas_int *ginfo = (bblas_int*)malloc(((size_t)batch_count+1)*sizeof(bblas_int));
+	const bblas_complex64_t **Ag = (const bblas_complex64_t**)malloc(
+		((size_t)batch_count+1)*sizeof(bblas_complex64_t*));
+	const bblas_complex64_t **Bg = (const bblas_complex64_t**)malloc(
+		((size_t)batch_count+1)*sizeof(bblas_complex64_t*));
+	bblas_complex64_t **Cg = (bblas_complex64_t**)malloc(
+		((size_t)batch_count+1)*sizeof(bblas_complex64_t*));
+
+	const bblas_int *shape[] = { m, n, lda, ldb, ldc };
+	bblas_int group_count = -1;
+	if (perm != NULL && start != NULL && ginfo != NULL &&
+	    Ag != NULL && Bg != NULL && Cg != NULL)
+		group_count = bblas_bucket(batch_count, 5, shape, perm, start);
+
+	if (group_count < 0) {
+		bblas_error("malloc() failed");
+		if (info_option == BblasErrorsReportAll)
+			bblas_set_info(info_option, &info[1], batch_count,
+			               BblasErrorOutOfMemory);
+		if (info_option != BblasErrorsReportNone)
+			info[0] = BblasErrorOutOfMemory;
+	}
+	else {
+		for (bblas_int i = 0; i < batch_count; i++) {
+			Ag[i] = A[perm[i]];
+			Bg[i] = B[perm[i]];
+			Cg[i] = C[perm[i]];
+		}
+
+		bblas_int flag = 0;
+		for (bblas_int group_iter = 0; group_iter < group_count; group_iter++) {
+			bblas_int first = start[group_iter];
+			bblas_int size = start[group_iter+1]-first;
+			bblas_int j = perm[first];
+
+			ginfo[first] = info_option;
+			blas_zhemm_batchf(size,
+			                  layout, side, uplo,
+			                  m[j], n[j],
+			                  alpha, Ag+first, lda[j],
+			                         Bg+first, ldb[j],
+			                  beta,  Cg+first, ldc[j],
+			                  &ginfo[first]);
+
+			// Scatter and check for errors in batchf function
+			if (info_option == BblasErrorsReportNone)
+				continue;
+			bblas_int count = (info_option == BblasErrorsReportAll) ? size : 1;
+			for (bblas_int i = first; i < first+count; i++) {
+				if (info_option == BblasErrorsReportAll)
+					info[perm[i]+1] = ginfo[i];
+				if (ginfo[i] != 0 && flag == 0) {
+					info[0] = ginfo[i];
+					flag = 1;
+				}
+			}
+		}
+		if (flag == 0)
+			info[0] = 0;
+	}
+
+	free(perm);
+	free(start);
+	free(ginfo);
+	free(Ag);
+	free(Bg);
+	free(Cg);
+}
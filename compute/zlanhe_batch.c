@@ -0,0 +1,147 @@
+/**
+ *
+ * @file
+ *
+ *  BBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> c
+ *
+ **/
+
+#include "bblas.h"
+
+
+/***************************************************************************//**
+ *
+ * @ingroup lanhe_batch
+ *
+ *  Computes the norms
+ *
+ *     \f[ values[j] = \| A[j] \| \f]
+ *
+ *  of the n[i]-by-n[i] Hermitian matrices j of each group i, of which
+ *  only the uplo[i] triangles are stored, as LAPACK zlanhe. See
+ *  blas_zlanhe_batchf.
+ *
+ *******************************************************************************
+ * @param[in] group_count
+ * 	    The number groups of matrices.
+ *
+ * @param[in] group_sizes
+ * 	    An array of integers of length group_count, where
+ * 	    group_sizes[i] denotes the number of matrices in i-th group.
+ *
+ * @param[in] layout
+ * 	    Specifies if the matrix is stored in row major or column major
+ * 	    format:
+ * 	    - BblasRowMajor: Row major format
+ * 	    - BblasColMajor: Column major format
+ *
+ * @param[in] norm
+ * 	    An array of length group_count; the norm of the matrices of i-th
+ * 	    group, BblasMaxNorm, BblasOneNorm, BblasInfNorm or
+ * 	    BblasFrobeniusNorm, as for blas_zlange_batchf.
+ *
+ * @param[in] uplo
+ * 	    An array of length group_count; the stored triangle of the
+ * 	    matrices A[j] of i-th group, BblasUpper or BblasLower.
+ *
+ * @param[in] n
+ * 	    An array of length group_count; the order of the matrices A[j]
+ * 	    of i-th group. n[i] >= 0.
+ *
+ * @param[in] A
+ * 	    A is an array of pointers to matrices A[0], A[1] .. A[batch_count-1].
+ *	    batch_count = \sum_{i=0}^{group_count-1}group_sizes[i].
+ *
+ * @param[in] lda
+ * 	    An array of length group_count, where lda[i] is the leading
+ * 	    dimension of the arrays A[j] of i-th group.
+ *
+ * @param[out] values
+ * 	    An array of length batch_count; values[j] is the norm of A[j].
+ *
+ * @param[in,out] info
+ * 		Array of bblas_int for error handling. On entry info[0] should have one of the
+ * 		following values
+ *			- BblasErrorsReportAll    :  All errors will be specified on output.
+ *						     Length of the array should be atleast
+ *						     \sum_{i=0}^{group_count-1}group_sizes[i]+1.
+ *			- BblasErrorsReportGroup  :  Single error from each group will be
+ *						     reported. Length of the array should
+ *						     be atleast group_count+1.
+ *			- BblasErrorsReportAny    :  Occurence of an error will be indicated
+ *						     by a single integer value, and length
+ *						     of the array should be atleast 1.
+ *			- BblasErrorsReportNone   :  No error will be reported on output, and
+ *						     length of the array should be atleast 1.
+ ******************************************************************************
+ *
+ * @retval BblasSuccess successful exit
+ *
+ *******************************************************************************
+ *
+ * @sa zlanhe_batch
+ * @sa clanhe_batch
+ *
+ ******************************************************************************/
+void blas_zlanhe_batch(bblas_int group_count, const bblas_int *group_sizes,
+                       bblas_enum_t layout, const bblas_enum_t *norm,
+                       const bblas_enum_t *uplo, const bblas_int *n,
+                       bblas_complex64_t const *const *A, const bblas_int *lda,
+                       double *values, bblas_int *info)
+{
+	// Check input arguments
+	if (group_count < 0) {
+		bblas_error("Illegal value of group_count");
+		info[0] = -1;
+		return;
+	}
+
+	bblas_int offset = 0;
+	bblas_int info_offset = 0;
+	bblas_int info_option = info[0];
+	bblas_int flag = 0;
+	// Check group_size and call fixed batch computation
+	for (bblas_int group_iter = 0; group_iter < group_count; group_iter++) {
+
+		if (info_option == BblasErrorsReportAll)
+			info_offset = offset+1;
+		else if (info_option == BblasErrorsReportGroup)
+			info_offset = group_iter+1;
+		else
+			info_offset = 0;
+		info[info_offset] = info_option;
+
+		if (group_sizes[group_iter] < 0) {
+			bblas_error("Illegal values of group_sizes");
+			info[0] = -2;
+			return;
+		}
+
+		bblas_int group_offset = offset;
+		offset += group_sizes[group_iter];
+
+		// Skip the empty group only: blas_zlanhe_batchf sets the norms of
+		// empty matrices to 0.
+		if (group_sizes[group_iter] == 0) {
+			bblas_success(info_option, &info[info_offset], group_sizes[group_iter]);
+			continue;
+		}
+
+		// Call to blas_zlanhe_batchf
+		blas_zlanhe_batchf(group_sizes[group_iter], layout, norm[group_iter],
+		                   uplo[group_iter], n[group_iter],
+		                   A+group_offset, lda[group_iter],
+		                   values+group_offset,
+		                   &info[info_offset]);
+
+		// check for errors in batchf function
+		if (info[info_offset] != 0 && flag == 0) {
+			info[0] = info[info_offset];
+			flag = 1;
+		}
+	}
+}
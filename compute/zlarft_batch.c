@@ -0,0 +1,165 @@
+/**
+ *
+ * @file
+ *
+ *  BBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+
+#include "bblas.h"
+
+
+/***************************************************************************//**
+ *
+ * @ingroup larft_batch
+ *
+ *  Forms the triangular factors T[j] of the block reflectors
+ *
+ *     \f[ H[j] = I - V[j] \times T[j] \times V[j]^H \f]
+ *
+ *  of the k[i] elementary reflectors of order n[i] of the matrices j of
+ *  each group i, as LAPACK zlarft. See blas_zlarft_batchf.
+ *
+ *******************************************************************************
+ * @param[in] group_count
+ * 	    The number groups of matrices.
+ *
+ * @param[in] group_sizes
+ * 	    An array of integers of length group_count, where
+ * 	    group_sizes[i] denotes the number of matrices in i-th group.
+ *
+ * @param[in] layout
+ * 	    Specifies if the matrix is stored in row major or column major
+ * 	    format:
+ * 	    - BblasRowMajor: Row major format
+ * 	    - BblasColMajor: Column major format
+ *
+ * @param[in] direct
+ * 	    An array of length group_count; BblasForward or BblasBackward,
+ * 	    the order in which the reflectors of i-th group are multiplied.
+ *
+ * @param[in] storev
+ * 	    An array of length group_count; BblasColumnwise or BblasRowwise,
+ * 	    how the reflectors of i-th group are stored.
+ *
+ * @param[in] n
+ * 	    An array of length group_count; the order of the block
+ * 	    reflectors of i-th group. n[i] >= 0.
+ *
+ * @param[in] k
+ * 	    An array of length group_count; the number of elementary
+ * 	    reflectors of i-th group. 0 <= k[i] <= n[i].
+ *
+ * @param[in] V
+ * 	    V is an array of pointers to matrices V[0], V[1] .. V[batch_count-1]
+ * 	    holding the reflectors, stored as in blas_zlarft_batchf.
+ *	    batch_count = \sum_{i=0}^{group_count-1}group_sizes[i].
+ *
+ * @param[in] ldv
+ * 	    An array of length group_count, where ldv[i] is the leading
+ * 	    dimension of the arrays V[j] of i-th group.
+ *
+ * @param[in] tau
+ * 	    tau is an array of pointers to vectors tau[0] .. tau[batch_count-1]
+ * 	    of the k[i] scalar factors of the reflectors.
+ *
+ * @param[out] T
+ * 	    T is an array of pointers to k[i]-by-k[i] matrices
+ * 	    T[0] .. T[batch_count-1]; on exit, the triangular factors.
+ *
+ * @param[in] ldt
+ * 	    An array of length group_count, where ldt[i] is the leading
+ * 	    dimension of the arrays T[j] of i-th group.
+ *
+ * @param[in,out] info
+ * 		Array of bblas_int for error handling. On entry info[0] should have one of the
+ * 		following values
+ *			- BblasErrorsReportAll    :  All errors will be specified on output.
+ *						     Length of the array should be atleast
+ *						     \sum_{i=0}^{group_count-1}group_sizes[i]+1.
+ *			- BblasErrorsReportGroup  :  Single error from each group will be
+ *						     reported. Length of the array should
+ *						     be atleast group_count+1.
+ *			- BblasErrorsReportAny    :  Occurence of an error will be indicated
+ *						     by a single integer value, and length
+ *						     of the array should be atleast 1.
+ *			- BblasErrorsReportNone   :  No error will be reported on output, and
+ *						     length of the array should be atleast 1.
+ ******************************************************************************
+ *
+ * @retval BblasSuccess successful exit
+ *
+ *******************************************************************************
+ *
+ * @sa zlarft_batch
+ * @sa clarft_batch
+ * @sa dlarft_batch
+ * @sa slarft_batch
+ *
+ ******************************************************************************/
+void blas_zlarft_batch(bblas_int group_count, const bblas_int *group_sizes,
+                       bblas_enum_t layout,
+                       const bblas_enum_t *direct, const bblas_enum_t *storev,
+                       const bblas_int *n, const bblas_int *k,
+                       bblas_complex64_t const *const *V, const bblas_int *ldv,
+                       bblas_complex64_t const *const *tau,
+                       bblas_complex64_t **T, const bblas_int *ldt,
+                       bblas_int *info)
+{
+	// Check input arguments
+	if (group_count < 0) {
+		bblas_error("Illegal value of group_count");
+		info[0] = -1;
+		return;
+	}
+
+	bblas_int offset = 0;
+	bblas_int info_offset = 0;
+	bblas_int info_option = info[0];
+	bblas_int flag = 0;
+	// Check group_size and call fixed batch computation
+	for (bblas_int group_iter = 0; group_iter < group_count; group_iter++) {
+
+		if (info_option == BblasErrorsReportAll)
+			info_offset = offset+1;
+		else if (info_option == BblasErrorsReportGroup)
+			info_offset = group_iter+1;
+		else
+			info_offset = 0;
+		info[info_offset] = info_option;
+
+		if (group_sizes[group_iter] < 0) {
+			bblas_error("Illegal values of group_sizes");
+			info[0] = -2;
+			return;
+		}
+
+		bblas_int group_offset = offset;
+		offset += group_sizes[group_iter];
+
+		// Skip the group where nothing needs to be done
+		if (k[group_iter] == 0 || group_sizes[group_iter] == 0) {
+			bblas_success(info_option, &info[info_offset], group_sizes[group_iter]);
+			continue;
+		}
+
+		// Call to blas_zlarft_batchf
+		blas_zlarft_batchf(group_sizes[group_iter], layout,
+		                   direct[group_iter], storev[group_iter],
+		                   n[group_iter], k[group_iter],
+		                   V+group_offset, ldv[group_iter],
+		                   tau+group_offset,
+		                   T+group_offset, ldt[group_iter],
+		                   &info[info_offset]);
+
+		// check for errors in batchf function
+		if (info[info_offset] != 0 && flag == 0) {
+			info[0] = info[info_offset];
+			flag = 1;
+		}
+	}
+}
@@ -0,0 +1,233 @@
+/**
+ *
+ * @file
+ *
+ *  BBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+
+#include "bblas.h"
+
+#include <stdlib.h>
+
+/*****************************************************************************
+ *
+ * @ingroup batch_strided
+ *
+ * blas_zptsv_batch_strided is the version of blas_zptsv_batchf whose
+ * systems are addressed by strides instead of arrays of pointers. It
+ * solves the batch_count Hermitian positive definite tridiagonal systems
+ *
+ *  \f[ A[i] \times X[i] = B[i], \f]
+ *
+ *  where element k of the diagonal of A[i] is d[i*stridet + k*inct],
+ *  and likewise for the sub-diagonal e, and element (k, j) of B[i] is
+ *  B[i*strideb + k*incb + j*ldb].
+ *
+ *  With stridet = strideb = 1, the systems are interleaved: element k of
+ *  one system is next to element k of the next one, as the vector lanes
+ *  of core_zptsv_lanes expect, which then works on the arrays in place.
+ *  Other strides, e.g., stridet = n and inct = 1 for systems stored one
+ *  after the other, go through the interleaved workspace of
+ *  blas_zptsv_batchf.
+ *
+ ******************************************************************************
+ *
+ * @param[in] n
+ *          The order of the matrices A[i]. n >= 0.
+ *
+ * @param[in] nrhs
+ *          The number of columns of the matrices B[i]. nrhs >= 0.
+ *
+ * @param[in,out] d, e
+ *          The real diagonals and the sub-diagonals of the A[i];
+ *          on exit, the factors D[i] and L[i], as in blas_zptsv_batchf.
+ *
+ * @param[in] inct
+ *          The distance between consecutive elements of a system in d
+ *          and e. inct >= 1, and inct >= batch_count if stridet = 1.
+ *
+ * @param[in] stridet
+ *          The distance between the first elements of consecutive systems
+ *          in d and e. stridet >= 1.
+ *
+ * @param[in,out] B
+ *          The right hand sides B[i]; on exit, the solutions X[i].
+ *
+ * @param[in] incb, ldb
+ *          The distances between consecutive rows and columns of a B[i].
+ *          incb >= 1, and incb >= batch_count if strideb = 1; ldb >= 1.
+ *
+ * @param[in] strideb
+ *          The distance between the first elements of consecutive B[i].
+ *          strideb >= 1.
+ *
+ * @param[in] batch_count
+ *          The number of systems. batch_count >= 0.
+ *
+ * @param[in,out] info
+ *          Array of bblas_int for error handling, as in blas_zptsv_batchf
+ *          for a group of batch_count matrices.
+ *
+ ******************************************************************************
+ *
+ * @retval BblasSuccess successful exit
+ *
+ *******************************************************************************
+ *
+ * @sa zptsv_batch_strided
+ * @sa cptsv_batch_strided
+ * @sa dptsv_batch_strided
+ * @sa sptsv_batch_strided
+ *
+ ******************************************************************************/
+void blas_zptsv_batch_strided(bblas_int n, bblas_int nrhs,
+                              double *d, bblas_complex64_t *e,
+                              bblas_int inct, bblas_int stridet,
+                              bblas_complex64_t *B, bblas_int incb, bblas_int ldb,
+                              bblas_int strideb,
+                              bblas_int batch_count, bblas_int *info)
+{
+	// Check input arguments
+	if (n < 0) {
+		bblas_error("Illegal value of n");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], imax(0, batch_count), 1);
+		}
+		return;
+	}
+	if (nrhs < 0) {
+		bblas_error("Illegal value of nrhs");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], imax(0, batch_count), 2);
+		}
+		return;
+	}
+	if (inct < 1 || (stridet == 1 && inct < batch_count)) {
+		bblas_error("Illegal value of inct");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], imax(0, batch_count), 3);
+		}
+		return;
+	}
+	if (stridet < 1) {
+		bblas_error("Illegal value of stridet");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], imax(0, batch_count), 4);
+		}
+		return;
+	}
+	if (incb < 1 || (strideb == 1 && incb < batch_count)) {
+		bblas_error("Illegal value of incb");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], imax(0, batch_count), 5);
+		}
+		return;
+	}
+	if (ldb < 1) {
+		bblas_error("Illegal value of ldb");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], imax(0, batch_count), 6);
+		}
+		return;
+	}
+	if (strideb < 1) {
+		bblas_error("Illegal value of strideb");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], imax(0, batch_count), 7);
+		}
+		return;
+	}
+	if (batch_count < 0) {
+		bblas_error("Illegal value of batch_count");
+		info[0] = -8;
+		return;
+	}
+
+	const bblas_int lanes = BBLAS_TRIDIAG_LANES;
+	bool interleaved = stridet == 1 && strideb == 1;
+
+	// Workspace of BBLAS_TRIDIAG_LANES interleaved systems, unless they
+	// already are.
+	size_t len = (size_t)lanes*imax(1, n);
+	bblas_complex64_t *W = NULL;
+	double *Wd = NULL;
+	bblas_complex64_t *We = NULL, *WB = NULL;
+	if (! interleaved) {
+		W = (bblas_complex64_t*)malloc(
+			(1+(size_t)nrhs)*len*sizeof(bblas_complex64_t));
+		Wd = (double*)malloc(len*sizeof(double));
+		if (W == NULL || Wd == NULL) {
+			bblas_error("malloc() failed");
+			if (info[0] != BblasErrorsReportNone) {
+				bblas_set_info(info[0], &info[0], batch_count,
+				               BblasErrorOutOfMemory);
+			}
+			free(W);
+			free(Wd);
+			return;
+		}
+		We = W;
+		WB = W + len;
+	}
+
+	// Pointers to the systems of one chunk.
+	bblas_complex64_t *Pe[BBLAS_TRIDIAG_LANES];
+	bblas_complex64_t *PB[BBLAS_TRIDIAG_LANES];
+
+	// info[0] is also the error of A[0] if all errors are reported.
+	bblas_int info_option = info[0];
+	bblas_int error = 0;
+	bblas_int info_lanes[BBLAS_TRIDIAG_LANES];
+	for (bblas_int first = 0; first < batch_count; first += lanes) {
+		bblas_int count = imin(lanes, batch_count-first);
+
+		if (interleaved) {
+			core_zptsv_lanes(count, n, nrhs, d+first, e+first, inct,
+			                 B+first, incb, ldb, info_lanes);
+		}
+		else {
+			for (bblas_int l = 0; l < count; l++) {
+				const double *di = d + (size_t)stridet*(first+l);
+				for (bblas_int k = 0; k < n; k++)
+					Wd[(size_t)k*count + l] = di[(size_t)inct*k];
+				Pe[l] = e + (size_t)stridet*(first+l);
+				PB[l] = B + (size_t)strideb*(first+l);
+			}
+			core_zgather_lanes(count, n-1, 1, (bblas_complex64_t const *const *)Pe,
+			                   inct, 1, We);
+			core_zgather_lanes(count, n, nrhs, (bblas_complex64_t const *const *)PB,
+			                   incb, ldb, WB);
+
+			core_zptsv_lanes(count, n, nrhs, Wd, We, count,
+			                 WB, count, count*n, info_lanes);
+
+			for (bblas_int l = 0; l < count; l++) {
+				double *di = d + (size_t)stridet*(first+l);
+				for (bblas_int k = 0; k < n; k++)
+					di[(size_t)inct*k] = Wd[(size_t)k*count + l];
+			}
+			core_zscatter_lanes(count, n-1, 1, We, Pe, inct, 1);
+			core_zscatter_lanes(count, n, nrhs, WB, PB, incb, ldb);
+		}
+
+		for (bblas_int l = 0; l < count; l++) {
+			bblas_int code = (info_lanes[l] > 0) ?
+				BblasErrorNotPositiveDefinite : BblasSuccess;
+			if (info_option == BblasErrorsReportAll)
+				info[first+l] = code;
+			else if (error == 0)
+				error = code;
+		}
+	}
+	free(W);
+	free(Wd);
+
+	// BblasSuccess, or the first error of the batch
+	if (info_option != BblasErrorsReportAll)
+		info[0] = (info_option == BblasErrorsReportNone) ? 0 : error;
+}
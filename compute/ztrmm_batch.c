@@ -12,6 +12,129 @@
 
 #include "bblas.h"
 
+/******************************************************************************/
+// blas_ztrmm_batchf on the matrices Ap + offa[i] and Bp + offb[i], whose
+// pointers are resolved BBLAS_OFFSET_CHUNK at a time into arrays on the
+// stack.
+static void ztrmm_batchf_offset(bblas_int group_size, bblas_enum_t layout,
+                                bblas_enum_t side, bblas_enum_t uplo,
+                                bblas_enum_t transa, bblas_enum_t diag,
+                                bblas_int m, bblas_int n,
+                                bblas_complex64_t alpha, const bblas_complex64_t *Ap, const bblas_int *offa, bblas_int lda,
+                                                               bblas_complex64_t *Bp, const bblas_int *offb, bblas_int ldb,
+                                bblas_int *info)
+{
+	const bblas_complex64_t *A[BBLAS_OFFSET_CHUNK];
+	bblas_complex64_t *B[BBLAS_OFFSET_CHUNK];
+	bblas_int info_option = info[0];
+	for (bblas_int first = 0; first < group_size; first += BBLAS_OFFSET_CHUNK) {
+		bblas_int count = imin(BBLAS_OFFSET_CHUNK, group_size-first);
+		for (bblas_int i = 0; i < count; i++) {
+			A[i] = Ap + offa[first+i];
+			B[i] = Bp + offb[first+i];
+		}
+		bblas_int *info_chunk =
+			(info_option == BblasErrorsReportAll) ? &info[first] : info;
+		info_chunk[0] = info_option;
+		blas_ztrmm_batchf(count, layout, side, uplo,
+		                  transa, diag,
+		                  m, n,
+		                  alpha, A, lda,
+		                         B, ldb,
+		                  info_chunk);
+
+		// The rest of the group would fail the same way.
+		if (info_chunk[0] != 0) {
+			if (info_option == BblasErrorsReportAll)
+				bblas_set_info(info_option, &info_chunk[count],
+				               group_size-first-count, info_chunk[0]);
+			return;
+		}
+	}
+}
+
+/******************************************************************************/
+// The group loop of blas_ztrmm_batch, blas_ztrmm_batch_layouts and
+// blas_ztrmm_batch_offset; the matrices of group i are stored in
+// layout[incl*i], and, with offa not NULL, are Ap + offa[j] and Bp + offb[j]
+// rather than A[j] and B[j].
+static void ztrmm_batch(bblas_int group_count, const bblas_int *group_sizes,
+                        const bblas_enum_t *layout, bblas_int incl,
+                        const bblas_enum_t *side, const bblas_enum_t *uplo,
+                        const bblas_enum_t *transa, const bblas_enum_t *diag,
+                        const bblas_int *m, const bblas_int *n,
+                        const bblas_complex64_t *alpha, bblas_complex64_t const *const *A, const bblas_int *lda,
+                                                        bblas_complex64_t             **B, bblas_int const *ldb,
+                        const bblas_complex64_t *Ap, const bblas_int *offa,
+                              bblas_complex64_t *Bp, const bblas_int *offb,
+                        bblas_int *info)
+{
+	// Check input arguments 
+	if (group_count < 0) {
+		bblas_error("Illegal value of group_count");
+		info[0] = -1;
+		return;
+	}
+
+	bblas_int offset = 0;
+	bblas_int info_offset = 0;
+	bblas_int flag = 0;
+	bblas_int info_option = info[0];
+	// Check group_size and call fixed batch computation 
+	for (bblas_int group_iter = 0; group_iter < group_count; group_iter++) {
+
+		if (info_option == BblasErrorsReportAll) 
+			info_offset = offset+1;
+		else if (info_option == BblasErrorsReportGroup)
+			info_offset = group_iter+1;	
+		else 
+			info_offset = 0;
+		info[info_offset] = info_option;	
+
+		if (group_sizes[group_iter] < 0) {
+			bblas_error("Illegal values of group_sizes");
+			info[0] = -2;
+			return;
+		}
+
+		bblas_int group_offset = offset;
+		offset += group_sizes[group_iter];
+
+		// Skip the group where nothing needs to be done
+		if (imin(m[group_iter], n[group_iter]) == 0 || 
+				group_sizes[group_iter] == 0) {
+			bblas_success(info_option, &info[info_offset], group_sizes[group_iter]);
+			continue;
+		}
+
+		if (offa != NULL) {
+			ztrmm_batchf_offset(group_sizes[group_iter],
+			                    layout[incl*group_iter], side[group_iter], uplo[group_iter],
+			                    transa[group_iter], diag[group_iter],
+			                    m[group_iter], n[group_iter],
+			                    alpha[group_iter], Ap, offa+group_offset, lda[group_iter],
+			                                       Bp, offb+group_offset, ldb[group_iter],
+			                    &info[info_offset]);
+		}
+		else {
+			// Call to blas_zher2k_batchf
+			blas_ztrmm_batchf(group_sizes[group_iter],
+					  layout[incl*group_iter], side[group_iter], uplo[group_iter],
+					  transa[group_iter], diag[group_iter],
+					  m[group_iter], n[group_iter],
+					  alpha[group_iter], A+group_offset, lda[group_iter],
+					  		     B+group_offset, ldb[group_iter],
+					  &info[info_offset]);
+		}
+
+		// check for errors in batchf function
+		if (info[info_offset] != 0 && flag == 0) {
+			info[0] = info[info_offset];	
+			flag = 1;
+		}
+	}
+}
+
 /***************************************************************************//**
  *
  * @ingroup trmm_batch
@@ -121,7 +244,7 @@
  *          ldb[i] >= max(1,m[i]).
  *
  * @param[in,out] info
- * 		Array of int for error handling. On entry info[0] should have one of the 
+ * 		Array of bblas_int for error handling. On entry info[0] should have one of the 
  * 		following values
  *			- BblasErrorsReportAll    :  All errors will be specified on output.
  *						     Length of the array should be atleast
@@ -146,67 +269,131 @@
  * @sa strmm_batch
  *
  ******************************************************************************/
-void blas_ztrmm_batch(int group_count, const int *group_sizes,
+void blas_ztrmm_batch(bblas_int group_count, const bblas_int *group_sizes,
 		      bblas_enum_t layout, const bblas_enum_t *side, const bblas_enum_t *uplo,
 		      const bblas_enum_t *transa, const bblas_enum_t *diag,
-		      const int *m, const int *n, 
-		      const bblas_complex64_t *alpha, bblas_complex64_t const *const *A, const int *lda,
-		      				      bblas_complex64_t 	    **B, int const *ldb,
-		      int *info)
-
-
+		      const bblas_int *m, const bblas_int *n, 
+		      const bblas_complex64_t *alpha, bblas_complex64_t const *const *A, const bblas_int *lda,
+		      				      bblas_complex64_t 	    **B, bblas_int const *ldb,
+		      bblas_int *info)
 {
-	// Check input arguments 
-	if (group_count < 0) {
-		bblas_error("Illegal value of group_count");
-		info[0] = -1;
-		return;
-	}
-
-	int offset = 0;
-	int info_offset = 0;
-	int flag = 0;
-	int info_option = info[0];
-	// Check group_size and call fixed batch computation 
-	for (int group_iter = 0; group_iter < group_count; group_iter++) {
-
-		if (info_option == BblasErrorsReportAll) 
-			info_offset = offset+1;
-		else if (info_option == BblasErrorsReportGroup)
-			info_offset = group_iter+1;	
-		else 
-			info_offset = 0;
-		info[info_offset] = info_option;	
-
-		if (group_sizes[group_iter] < 0) {
-			bblas_error("Illegal values of group_sizes");
-			info[0] = -2;
-			return;
-		}
-
-		// Skip the group where nothing needs to be done
-		if (imin(m[group_iter], n[group_iter]) == 0 || 
-				group_sizes[group_iter] == 0) {
-			bblas_success(info_option, &info[info_offset], group_sizes[group_iter]);
-			continue;
-		}
-
-		// Call to blas_zher2k_batchf 
-		blas_ztrmm_batchf(group_sizes[group_iter], 
-				  layout, side[group_iter], uplo[group_iter],
-				  transa[group_iter], diag[group_iter],
-				  m[group_iter], n[group_iter],
-				  alpha[group_iter], A+offset, lda[group_iter],
-				  		     B+offset, ldb[group_iter],
-				  &info[info_offset]);    
-
-		// check for errors in batchf function
-		if (info[info_offset] != 0 && flag == 0) {
-			info[0] = info[info_offset];	
-			flag = 1;
-		}
+	ztrmm_batch(group_count, group_sizes, &layout, 0, side, uplo, transa,
+	            diag, m, n, alpha, A, lda, B, ldb,
+	            NULL, NULL, NULL, NULL, info);
+}
 
-		offset += group_sizes[group_iter];    
-	}
+/***************************************************************************//**
+ *
+ * @ingroup trmm_batch
+ *
+ *  blas_ztrmm_batch_layouts is the version of blas_ztrmm_batch with one layout
+ *  per group, so that groups of row major and column major matrices are
+ *  computed by one call. A row major group is computed in place, as by
+ *  blas_ztrmm_batch with BblasRowMajor, as the column major problem on the
+ *  same storage with the operands swapped; no matrix is copied.
+ *
+ *******************************************************************************
+ *
+ * @param[in] layout
+ *          Array of length group_count; layout[i] is BblasRowMajor or
+ *          BblasColMajor, the storage of the matrices of group i.
+ *
+ * @param[in] group_count, group_sizes, side, uplo, transa, diag, m, n, alpha,
+ *          A, lda, B, ldb
+ *          As in blas_ztrmm_batch.
+ *
+ * @param[in,out] info
+ *          Array of bblas_int for error handling, as in blas_ztrmm_batch.
+ *
+ ******************************************************************************
+ *
+ * @retval BblasSuccess successful exit
+ *
+ *******************************************************************************
+ *
+ * @sa ztrmm_batch_layouts
+ * @sa ctrmm_batch_layouts
+ * @sa dtrmm_batch_layouts
+ * @sa strmm_batch_layouts
+ *
+ ******************************************************************************/
+void blas_ztrmm_batch_layouts(bblas_int group_count, const bblas_int *group_sizes,
+                              const bblas_enum_t *layout, const bblas_enum_t *side, const bblas_enum_t *uplo,
+                              const bblas_enum_t *transa, const bblas_enum_t *diag,
+                              const bblas_int *m, const bblas_int *n,
+                              const bblas_complex64_t *alpha, bblas_complex64_t const *const *A, const bblas_int *lda,
+                                                              bblas_complex64_t             **B, bblas_int const *ldb,
+                              bblas_int *info)
+{
+	ztrmm_batch(group_count, group_sizes, layout, 1, side, uplo, transa,
+	            diag, m, n, alpha, A, lda, B, ldb,
+	            NULL, NULL, NULL, NULL, info);
 }
 
+/***************************************************************************//**
+ *
+ * @ingroup batch_offset
+ *
+ * blas_ztrmm_batch_offset is the version of blas_ztrmm_batch whose
+ * matrices are addressed by offsets into pools, instead of arrays of
+ * pointers. It performs the triangular matrix-matrix multiplications
+ *
+ *  \f[ B[i] = \alpha op( A[i] ) \times B[i], \f]
+ *
+ *  or
+ *
+ *  \f[ B[i] = \alpha B[i] \times op( A[i] ), \f]
+ *
+ *  where A[i] = A + offa[i] and B[i] = B + offb[i].
+ *  Each group is computed by blas_ztrmm_batchf on the pointers of
+ *  BBLAS_OFFSET_CHUNK matrices at a time, resolved into arrays on the
+ *  stack; see blas_zgemm_batch_offset.
+ *
+ ******************************************************************************
+ *
+ * @param[in] group_count, group_sizes, layout, side, uplo, transa, diag, m, n, alpha
+ *          As in blas_ztrmm_batch.
+ *
+ * @param[in] A
+ *          The pool of the matrices A[i].
+ *
+ * @param[in] offa
+ *          Array of length batch_count; offa[i] is the offset of A[i] in A,
+ *          in elements.
+ *
+ * @param[in] lda
+ *          As in blas_ztrmm_batch.
+ *
+ * @param[in,out] B, offb
+ *          The pool of the matrices B[i] and their offsets, as for A.
+ *
+ * @param[in] ldb
+ *          As in blas_ztrmm_batch.
+ *
+ * @param[in,out] info
+ *          Array of bblas_int for error handling, as in blas_ztrmm_batch.
+ *
+ ******************************************************************************
+ *
+ * @retval BblasSuccess successful exit
+ *
+ *******************************************************************************
+ *
+ * @sa ztrmm_batch_offset
+ * @sa ctrmm_batch_offset
+ * @sa dtrmm_batch_offset
+ * @sa strmm_batch_offset
+ *
+ ******************************************************************************/
+void blas_ztrmm_batch_offset(bblas_int group_count, const bblas_int *group_sizes,
+                             bblas_enum_t layout, const bblas_enum_t *side, const bblas_enum_t *uplo,
+                             const bblas_enum_t *transa, const bblas_enum_t *diag,
+                             const bblas_int *m, const bblas_int *n,
+                             const bblas_complex64_t *alpha, const bblas_complex64_t *A, const bblas_int *offa, const bblas_int *lda,
+                                                                   bblas_complex64_t *B, const bblas_int *offb, const bblas_int *ldb,
+                             bblas_int *info)
+{
+	ztrmm_batch(group_count, group_sizes, &layout, 0, side, uplo, transa, diag, m, n,
+	            alpha, NULL, lda, NULL, ldb,
+	            A, offa, B, offb, info);
+}
@@ -0,0 +1,280 @@
+/**
+ *
+ * @file
+ *
+ *  BBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+
+// mmap() flags and posix_memalign() under -std=c99
+#define _DEFAULT_SOURCE
+#define _POSIX_C_SOURCE 200112L
+
+#include "core.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+/******************************************************************************/
+// One arena of matrices, from bblas_batch_alloc.
+struct bblas_arena_s {
+    void *base;     ///< first byte of the arena
+    size_t bytes;   ///< length of the mapping, or 0 if base is from the heap
+};
+
+/******************************************************************************/
+// Rounds x up to a multiple of the power of two align.
+static inline size_t round_up(size_t x, size_t align)
+{
+    return (x + align-1) & ~(align-1);
+}
+
+/******************************************************************************/
+// Bytes of an operand in the arena: whole cache lines, plus one if the
+// next operand would otherwise start in the same L1 set.
+static inline size_t operand_bytes(bblas_int ld, bblas_int cols, size_t size)
+{
+    size_t set_stride = BBLAS_L1_SIZE/BBLAS_L1_WAYS;
+    size_t bytes = round_up((size_t)ld*cols*size, BBLAS_CACHE_LINE);
+    if (bytes % set_stride == 0)
+        bytes += BBLAS_CACHE_LINE;
+    return bytes;
+}
+
+/******************************************************************************/
+// Greatest common divisor.
+static size_t gcd(size_t a, size_t b)
+{
+    while (b != 0) {
+        size_t r = a % b;
+        a = b;
+        b = r;
+    }
+    return a;
+}
+
+/******************************************************************************/
+// Whether walking along a row of a matrix with cols columns, stride bytes
+// apart, touches too few L1 sets to keep the row panels used by gemm-like
+// kernels in cache: the lines of a row fall into sets/gcd(stride, sets)
+// sets, each of which should keep at most half its ways for them.
+static bool aliases(size_t stride, bblas_int cols)
+{
+    size_t sets = BBLAS_L1_SIZE/(BBLAS_L1_WAYS*BBLAS_CACHE_LINE);
+    if (stride % BBLAS_CACHE_LINE != 0)
+        return false;
+    size_t distinct = sets/gcd(stride/BBLAS_CACHE_LINE % sets, sets);
+    size_t ways = imax(1, BBLAS_L1_WAYS/2);
+    size_t need = ((size_t)cols + ways-1)/ways;
+    return distinct < (need < sets ? need : sets);
+}
+
+/******************************************************************************/
+// Maps bytes of anonymous memory aligned to BBLAS_HUGE_PAGE, backed by huge
+// pages if possible; sets *mapped to the length of the mapping.
+static void *map_huge(size_t bytes, size_t *mapped)
+{
+#if defined(__linux__)
+    size_t len = round_up(bytes, BBLAS_HUGE_PAGE);
+
+#if defined(MAP_HUGETLB)
+    // Explicit huge pages, if the system has reserved any.
+    void *p = mmap(NULL, len, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (p != MAP_FAILED) {
+        *mapped = len;
+        return p;
+    }
+#endif
+
+    // Otherwise, transparent huge pages, which need an aligned range:
+    // map one more huge page and trim both ends.
+    char *q = (char*)mmap(NULL, len + BBLAS_HUGE_PAGE, PROT_READ | PROT_WRITE,
+                          MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if ((void*)q == MAP_FAILED)
+        return NULL;
+    char *start = (char*)round_up((uintptr_t)q, BBLAS_HUGE_PAGE);
+    size_t head = (size_t)(start - q);
+    if (head > 0)
+        munmap(q, head);
+    munmap(start + len, BBLAS_HUGE_PAGE - head);
+#if defined(MADV_HUGEPAGE)
+    madvise(start, len, MADV_HUGEPAGE);
+#endif
+    *mapped = len;
+    return start;
+#else
+    (void)bytes;
+    (void)mapped;
+    return NULL;
+#endif
+}
+
+/***************************************************************************//**
+ *
+ * @defgroup bblas_alloc Batch allocation
+ *
+ * Allocation of the matrices of a batch from one arena.
+ *
+ ******************************************************************************/
+
+/***************************************************************************//**
+ * @ingroup bblas_alloc
+ *
+ * Allocates the matrices of a batch from one arena and sets the pointers to
+ * them, instead of one malloc per matrix, which scatters the matrices over
+ * as many pages and TLB entries.
+ *
+ * The operands of each matrix of the batch, e.g., A[i], B[i] and C[i], are
+ * consecutive in the arena, in the order of the batch, each aligned to
+ * BBLAS_CACHE_LINE. An operand whose size is a multiple of the L1 set
+ * stride is followed by one unused line, so that consecutive operands do
+ * not start in the same set. The leading dimensions are the caller's;
+ * bblas_advise_ld recommends ones that avoid aliasing within each matrix.
+ * Batches of at least BBLAS_HUGE_PAGE bytes are mapped
+ * directly, on Linux, with explicit huge pages if the system has reserved
+ * any and with transparent huge pages otherwise, so that a whole batch
+ * takes a few TLB entries. Smaller batches come from the heap.
+ *
+ * @param[in] group_count
+ *          The number of groups. group_count >= 0.
+ *
+ * @param[in] group_sizes
+ *          Array of length group_count; the number of matrices of each group.
+ *
+ * @param[in] count
+ *          The number of operands of each matrix of the batch.
+ *
+ * @param[in] ld
+ *          Array of count arrays of length group_count; ld[j][g] is the
+ *          leading dimension of the j-th operand in group g.
+ *
+ * @param[in] cols
+ *          Array of count arrays of length group_count; cols[j][g] is the
+ *          number of columns (rows, in row major) of the j-th operand
+ *          in group g.
+ *
+ * @param[in] size
+ *          Array of length count; the size in bytes of the elements of each
+ *          operand.
+ *
+ * @param[out] X
+ *          Array of count arrays of batch_count pointers. On exit, X[j][i]
+ *          points to the ld*cols elements of the j-th operand of matrix i.
+ *
+ * @return The arena, to be freed with bblas_batch_free, or NULL if it
+ *         cannot be allocated.
+ ******************************************************************************/
+bblas_arena_t bblas_batch_alloc(bblas_int group_count, const bblas_int *group_sizes,
+                                bblas_int count, const bblas_int *const *ld,
+                                const bblas_int *const *cols, const size_t *size,
+                                void **const *X)
+{
+    // Size of the arena.
+    size_t bytes = 0;
+    for (bblas_int g = 0; g < group_count; g++) {
+        size_t matrix = 0;
+        for (bblas_int j = 0; j < count; j++)
+            matrix += operand_bytes(ld[j][g], cols[j][g], size[j]);
+        bytes += matrix*group_sizes[g];
+    }
+
+    bblas_arena_t arena = (bblas_arena_t)malloc(sizeof(*arena));
+    if (arena == NULL)
+        return NULL;
+    arena->base = NULL;
+    arena->bytes = 0;
+    if (bytes >= BBLAS_HUGE_PAGE)
+        arena->base = map_huge(bytes, &arena->bytes);
+    if (arena->base == NULL) {
+        arena->bytes = 0;
+        if (posix_memalign(&arena->base, BBLAS_CACHE_LINE,
+                           bytes > 0 ? bytes : BBLAS_CACHE_LINE) != 0) {
+            free(arena);
+            return NULL;
+        }
+    }
+
+    char *next = (char*)arena->base;
+    bblas_int i = 0;
+    for (bblas_int g = 0; g < group_count; g++) {
+        for (bblas_int l = 0; l < group_sizes[g]; l++, i++) {
+            for (bblas_int j = 0; j < count; j++) {
+                X[j][i] = next;
+                next += operand_bytes(ld[j][g], cols[j][g], size[j]);
+            }
+        }
+    }
+    return arena;
+}
+
+/***************************************************************************//**
+ * @ingroup bblas_alloc
+ *
+ * Frees all the matrices of an arena at once. A NULL arena is ignored.
+ *
+ * @param[in] arena
+ *          The arena, from bblas_batch_alloc.
+ ******************************************************************************/
+void bblas_batch_free(bblas_arena_t arena)
+{
+    if (arena == NULL)
+        return;
+#if defined(__linux__)
+    if (arena->bytes > 0)
+        munmap(arena->base, arena->bytes);
+    else
+#endif
+        free(arena->base);
+    free(arena);
+}
+
+/***************************************************************************//**
+ * @ingroup bblas_alloc
+ *
+ * Recommends leading dimensions that avoid cache set aliasing.
+ *
+ * With a leading dimension of a large power of two bytes, e.g., 64-by-64
+ * doubles with ld = 64, the elements of a row are a multiple of the L1 set
+ * stride apart and fall into a few sets of the cache, so that the row
+ * panels read by gemm-like kernels evict each other. A leading dimension
+ * is padded, to whole cache lines and then one line at a time, until a row
+ * of the matrix spreads over enough sets, for an L1 cache of BBLAS_L1_SIZE
+ * bytes and BBLAS_L1_WAYS ways. Leading dimensions without aliasing are
+ * left as they are; e.g., 16-by-16 doubles keep ld = 16.
+ *
+ * @param[in] group_count
+ *          The number of groups. group_count >= 0.
+ *
+ * @param[in] cols
+ *          Array of length group_count; the number of columns (rows, in
+ *          row major) of the matrices of each group.
+ *
+ * @param[in] size
+ *          The size in bytes of the elements of the matrices.
+ *
+ * @param[in,out] ld
+ *          Array of length group_count. On entry, the smallest leading
+ *          dimension of the matrices of each group. On exit, the
+ *          recommended one, not smaller.
+ ******************************************************************************/
+void bblas_advise_ld(bblas_int group_count, const bblas_int *cols, size_t size,
+                     bblas_int *ld)
+{
+    size_t line = (size < BBLAS_CACHE_LINE) ? BBLAS_CACHE_LINE/size : 1;
+    for (bblas_int g = 0; g < group_count; g++) {
+        if (!aliases((size_t)ld[g]*size, cols[g]))
+            continue;
+        size_t padded = round_up((size_t)ld[g], line);
+        while (aliases(padded*size, cols[g]))
+            padded += line;
+        if (padded <= INT_MAX)
+            ld[g] = (bblas_int)padded;
+    }
+}
@@ -0,0 +1,131 @@
+/**
+ *
+ * @file
+ *
+ *  BBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+
+#include "core.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+/******************************************************************************/
+// Hash of the shape of item i.
+static inline uint32_t shape_hash(bblas_int nkeys, const bblas_int *const *keys,
+                                  bblas_int i)
+{
+    // FNV-1a on the key values.
+    uint32_t h = 2166136261u;
+    for (bblas_int j = 0; j < nkeys; j++) {
+        h ^= (uint32_t)keys[j][i];
+        h *= 16777619u;
+    }
+    // Mix the high bits down, since the table is indexed by the low ones.
+    return h ^ (h >> 16);
+}
+
+/******************************************************************************/
+// Whether items i and l have the same shape.
+static inline bool same_shape(bblas_int nkeys, const bblas_int *const *keys,
+                              bblas_int i, bblas_int l)
+{
+    for (bblas_int j = 0; j < nkeys; j++)
+        if (keys[j][i] != keys[j][l])
+            return false;
+    return true;
+}
+
+/***************************************************************************//**
+ * Sorts the items of a variable size batch into groups of the same shape,
+ * for the vbatch routines to call the fixed size routines on each group.
+ *
+ * Each item is looked up in an open addressing hash table keyed by its
+ * shape, which gives its group in one pass; a counting sort by group then
+ * gives the permutation in a second pass. The cost is O(batch_count*nkeys),
+ * independent of the number of groups.
+ *
+ * @param[in] batch_count
+ *          The number of items. batch_count >= 0.
+ *
+ * @param[in] nkeys
+ *          The number of integers that make up the shape of an item.
+ *
+ * @param[in] keys
+ *          Array of nkeys arrays of length batch_count. The shape of item i
+ *          is keys[0][i], ..., keys[nkeys-1][i].
+ *
+ * @param[out] perm
+ *          Array of length batch_count. On exit, the items group by group,
+ *          the groups in the order of their first item and the items of
+ *          each group in increasing order.
+ *
+ * @param[out] start
+ *          Array of length batch_count+1. On exit, group g consists of
+ *          the items perm[start[g]], ..., perm[start[g+1]-1].
+ *
+ * @return The number of groups, or -1 if the workspace cannot be allocated.
+ ******************************************************************************/
+bblas_int bblas_bucket(bblas_int batch_count, bblas_int nkeys,
+                       const bblas_int *const *keys,
+                       bblas_int *perm, bblas_int *start)
+{
+    if (batch_count == 0) {
+        start[0] = 0;
+        return 0;
+    }
+
+    // Table at most half full, so that probe sequences stay short.
+    size_t size = 2;
+    while (size < 2*(size_t)batch_count)
+        size *= 2;
+    size_t mask = size-1;
+
+    // For each slot, the first item of its group and the group, or -1.
+    // For each item, its group.
+    bblas_int *first = (bblas_int*)malloc(size*sizeof(bblas_int));
+    bblas_int *group = (bblas_int*)malloc(size*sizeof(bblas_int));
+    bblas_int *item_group = (bblas_int*)malloc((size_t)batch_count*sizeof(bblas_int));
+    if (first == NULL || group == NULL || item_group == NULL) {
+        free(first);
+        free(group);
+        free(item_group);
+        return -1;
+    }
+    for (size_t s = 0; s < size; s++)
+        first[s] = -1;
+
+    // First pass: number the groups and count their items in start[g+1].
+    bblas_int group_count = 0;
+    start[0] = 0;
+    for (bblas_int i = 0; i < batch_count; i++) {
+        size_t s = shape_hash(nkeys, keys, i) & mask;
+        while (first[s] >= 0 && !same_shape(nkeys, keys, first[s], i))
+            s = (s+1) & mask;
+        if (first[s] < 0) {
+            first[s] = i;
+            group[s] = group_count;
+            start[++group_count] = 0;
+        }
+        item_group[i] = group[s];
+        start[group[s]+1]++;
+    }
+
+    // Second pass: counting sort, keeping the items of a group in order.
+    for (bblas_int g = 0; g < group_count; g++)
+        start[g+1] += start[g];
+    for (bblas_int i = 0; i < batch_count; i++)
+        perm[start[item_group[i]]++] = i;
+    // Each start[g] is now the former start[g+1]; shift back.
+    for (bblas_int g = group_count; g > 0; g--)
+        start[g] = start[g-1];
+    start[0] = 0;
+
+    free(first);
+    free(group);
+    free(item_group);
+    return group_count;
+}
@@ -123,6 +123,7 @@ bblas_enum_t bblas_storev_const(char lapack_char)
  * @retval BblasNoTrans   if lapack_char = 'N'
  * @retval BblasTrans     if lapack_char = 'T'
  * @retval BblasConjTrans if lapack_char = 'C'
+ * @retval BblasConjNoTrans if lapack_char = 'R'
  ******************************************************************************/
 bblas_enum_t bblas_trans_const(char lapack_char)
 {
@@ -130,6 +131,7 @@ bblas_enum_t bblas_trans_const(char lapack_char)
     case 'N': case 'n': return BblasNoTrans;
     case 'T': case 't': return BblasTrans;
     case 'C': case 'c': return BblasConjTrans;
+    case 'R': case 'r': return BblasConjNoTrans;
     default:            return BblasInvalid;
     }
 }
@@ -0,0 +1,185 @@
+/**
+ *
+ * @file
+ *
+ *  BBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+
+// posix_memalign() under -std=c99
+#define _POSIX_C_SOURCE 200112L
+
+#include "core.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+/***************************************************************************//**
+ *
+ * @defgroup bblas_packed Packed operands
+ *
+ * Storage of the operands packed by the *_pack_batch routines.
+ *
+ ******************************************************************************/
+
+/***************************************************************************//**
+ * @ingroup bblas_packed
+ *
+ * Allocates a packed batch of group_sizes[g] matrices per group and sets its
+ * pointers; the matrices are left for the caller to fill.
+ *
+ * All the matrices are carved out of one pool, aligned to BBLAS_CACHE_LINE.
+ * With bytes NULL, they are m[g]-by-k[g] copies stored in the given layout,
+ * each leading dimension rounded up to a whole number of cache lines, so
+ * that every column (or row, in row major) starts on a cache line boundary.
+ * Otherwise, each matrix of group g takes bytes[g] bytes, rounded up to a
+ * whole number of cache lines, in the format of the BLAS's own packing
+ * routine, and ld[g] is only the smallest valid leading dimension.
+ *
+ * @param[in] routine
+ *          "zgemm", "cgemm", "dgemm" or "sgemm", a string literal checked by
+ *          the routines using the batch.
+ *
+ * @param[in] layout
+ *          BblasColMajor or BblasRowMajor.
+ *
+ * @param[in] group_count, group_sizes, m, n, k
+ *          The groups and dimensions of the products. They must be valid.
+ *
+ * @param[in] size
+ *          The size in bytes of an element, which must divide
+ *          BBLAS_CACHE_LINE.
+ *
+ * @param[in] bytes
+ *          NULL, or the size in bytes of a packed matrix of each group.
+ *
+ * @return The packed batch, or NULL if it cannot be allocated.
+ ******************************************************************************/
+bblas_packed_t bblas_packed_create(const char *routine, bblas_enum_t layout,
+                                   bblas_int group_count, const bblas_int *group_sizes,
+                                   const bblas_int *m, const bblas_int *n,
+                                   const bblas_int *k, size_t size,
+                                   const size_t *bytes)
+{
+    bblas_packed_t packed = (bblas_packed_t)calloc(1, sizeof(*packed));
+    if (packed == NULL)
+        return NULL;
+
+    packed->routine = routine;
+    packed->layout = layout;
+    packed->vendor = bytes != NULL;
+    packed->group_count = group_count;
+    packed->batch_count = 0;
+    for (bblas_int g = 0; g < group_count; g++)
+        packed->batch_count += group_sizes[g];
+
+    size_t count = (size_t)group_count+1;
+    packed->group_sizes = (bblas_int*)malloc(count*sizeof(bblas_int));
+    packed->m = (bblas_int*)malloc(count*sizeof(bblas_int));
+    packed->n = (bblas_int*)malloc(count*sizeof(bblas_int));
+    packed->k = (bblas_int*)malloc(count*sizeof(bblas_int));
+    packed->ld = (bblas_int*)malloc(count*sizeof(bblas_int));
+    packed->zero = (bool*)calloc(count, sizeof(bool));
+    packed->A = (void**)malloc(((size_t)packed->batch_count+1)*sizeof(void*));
+    if (packed->group_sizes == NULL || packed->m == NULL ||
+        packed->n == NULL || packed->k == NULL || packed->ld == NULL ||
+        packed->zero == NULL || packed->A == NULL) {
+        bblas_packed_free(packed);
+        return NULL;
+    }
+
+    // Leading dimensions, sizes of the matrices in bytes, and the size
+    // of the pool.
+    size_t line = BBLAS_CACHE_LINE/size;
+    size_t *each = (size_t*)malloc(count*sizeof(size_t));
+    if (each == NULL) {
+        bblas_packed_free(packed);
+        return NULL;
+    }
+    size_t total = 0;
+    for (bblas_int g = 0; g < group_count; g++) {
+        bblas_int rows = (layout == BblasColMajor) ? m[g] : k[g];
+        bblas_int cols = (layout == BblasColMajor) ? k[g] : m[g];
+        size_t ld = (size_t)imax(1, rows);
+        if (bytes == NULL)
+            ld = (ld + line-1)/line*line;
+        if (ld > INT_MAX) {
+            free(each);
+            bblas_packed_free(packed);
+            return NULL;
+        }
+        packed->group_sizes[g] = group_sizes[g];
+        packed->m[g] = m[g];
+        packed->n[g] = n[g];
+        packed->k[g] = k[g];
+        packed->ld[g] = (bblas_int)ld;
+        if (bytes == NULL) {
+            if (cols > 0 && ld*cols > SIZE_MAX/size) {
+                free(each);
+                bblas_packed_free(packed);
+                return NULL;
+            }
+            each[g] = ld*cols*size;
+        }
+        else {
+            if (bytes[g] > SIZE_MAX - BBLAS_CACHE_LINE) {
+                free(each);
+                bblas_packed_free(packed);
+                return NULL;
+            }
+            each[g] = (bytes[g] + BBLAS_CACHE_LINE-1)
+                      /BBLAS_CACHE_LINE*BBLAS_CACHE_LINE;
+        }
+        if (group_sizes[g] > 0 &&
+            each[g] > (SIZE_MAX - total)/group_sizes[g]) {
+            free(each);
+            bblas_packed_free(packed);
+            return NULL;
+        }
+        total += each[g]*group_sizes[g];
+    }
+
+    size_t pool = (total > 0) ? total : BBLAS_CACHE_LINE;
+    if (posix_memalign(&packed->pool, BBLAS_CACHE_LINE, pool) != 0) {
+        packed->pool = NULL;
+        free(each);
+        bblas_packed_free(packed);
+        return NULL;
+    }
+
+    char *next = (char*)packed->pool;
+    bblas_int i = 0;
+    for (bblas_int g = 0; g < group_count; g++) {
+        for (bblas_int j = 0; j < group_sizes[g]; j++) {
+            packed->A[i++] = next;
+            next += each[g];
+        }
+    }
+    free(each);
+    return packed;
+}
+
+/***************************************************************************//**
+ * @ingroup bblas_packed
+ *
+ * Frees a packed batch and its pool. A NULL batch is ignored.
+ *
+ * @param[in] packed
+ *          The packed batch, from a *_pack_batch routine.
+ ******************************************************************************/
+void bblas_packed_free(bblas_packed_t packed)
+{
+    if (packed == NULL)
+        return;
+    free(packed->pool);
+    free(packed->group_sizes);
+    free(packed->m);
+    free(packed->n);
+    free(packed->k);
+    free(packed->ld);
+    free(packed->zero);
+    free(packed->A);
+    free(packed);
+}
@@ -0,0 +1,100 @@
+/**
+ *
+ * @file
+ *
+ *  BBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+
+#include "core.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/***************************************************************************//**
+ *
+ * @defgroup bblas_stream Streaming stores
+ *
+ * Writing of results that are not read again soon, bypassing the cache.
+ *
+ ******************************************************************************/
+
+/***************************************************************************//**
+ * @ingroup bblas_stream
+ *
+ * Copies the rows-by-cols matrix W to X, both stored column by column
+ * (row by row, in row major, with rows and cols swapped) with leading
+ * dimensions ldw and ldx, with non-temporal stores into X where the
+ * hardware has them: the whole cache lines of X are neither read nor
+ * brought into the cache, which saves the read for ownership of each line
+ * and leaves the cache to the operands of the next matrices. W should be
+ * in cache. Columns shorter than a few cache lines gain little.
+ *
+ * The stores are weakly ordered; call bblas_stream_fence before X is read
+ * or handed back to the caller.
+ *
+ * @param[in] rows, cols
+ *          The dimensions of W and X, in their storage.
+ *
+ * @param[in] W
+ *          The source matrix.
+ *
+ * @param[in] ldw
+ *          The leading dimension of W. ldw >= max(1, rows).
+ *
+ * @param[out] X
+ *          The destination matrix.
+ *
+ * @param[in] ldx
+ *          The leading dimension of X. ldx >= max(1, rows).
+ *
+ * @param[in] size
+ *          The size in bytes of the elements.
+ ******************************************************************************/
+void bblas_stream(bblas_int rows, bblas_int cols, const void *W, bblas_int ldw,
+                  void *X, bblas_int ldx, size_t size)
+{
+    size_t bytes = (size_t)imax(0, rows)*size;
+    for (bblas_int j = 0; j < cols; j++) {
+        const char *w = (const char*)W + (size_t)ldw*j*size;
+        char *x = (char*)X + (size_t)ldx*j*size;
+        size_t done = 0;
+#if defined(__SSE2__)
+        // Only whole cache lines are streamed: a partly written line
+        // would be flushed from the write-combining buffers on its own.
+        // The partial lines at both ends go through the cache.
+        size_t head = (BBLAS_CACHE_LINE - (uintptr_t)x % BBLAS_CACHE_LINE)
+                      % BBLAS_CACHE_LINE;
+        if (head > bytes)
+            head = bytes;
+        memcpy(x, w, head);
+        done = head;
+        for (; done+BBLAS_CACHE_LINE <= bytes; done += BBLAS_CACHE_LINE) {
+            for (int b = 0; b < BBLAS_CACHE_LINE; b += 16) {
+                __m128i v = _mm_loadu_si128((const __m128i*)(w+done+b));
+                _mm_stream_si128((__m128i*)(x+done+b), v);
+            }
+        }
+#endif
+        memcpy(x+done, w+done, bytes-done);
+    }
+}
+
+/***************************************************************************//**
+ * @ingroup bblas_stream
+ *
+ * Orders the stores of the preceding calls to bblas_stream before any
+ * later memory access.
+ ******************************************************************************/
+void bblas_stream_fence(void)
+{
+#if defined(__SSE2__)
+    _mm_sfence();
+#endif
+}
@@ -0,0 +1,105 @@
+/**
+ *
+ * @file
+ *
+ *  BBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+
+#include "bblas_types.h"
+#include "bblas_error.h"
+
+/***************************************************************************//**
+ * @addtogroup bblas_tune
+ * Run time tuning parameters.
+ * They are global to the library and should be set before, not during,
+ * calls to the batched routines.
+ * @{
+ ******************************************************************************/
+
+// Current values, in the same order as the parameters are declared
+// in bblas_types.h.
+static int bblas_gemm_3m = 0;
+static int bblas_prefetch_dist = 2;
+static int bblas_stream_c = 0;
+
+/***************************************************************************//**
+ * Sets a tuning parameter.
+ *
+ * @param[in] param
+ *          - BblasTuneGemm3M: nonzero to compute complex gemm with
+ *            the 3M algorithm (see core_zgemm3m), zero for the
+ *            conventional algorithm. Default: 0.
+ *          - BblasTunePrefetch: how many matrices ahead the batchf loops
+ *            prefetch the operands of, while computing the current one
+ *            (see bblas_prefetch_next), or 0 for no prefetching.
+ *            Default: 2.
+ *          - BblasTuneStream: nonzero for gemm with beta = 0 to never read
+ *            C[i] and write it with non-temporal stores (see
+ *            bblas_stream), for large batches whose results are not used
+ *            again soon; zero to write C[i] through the cache. Default: 0.
+ *
+ * @param[in] value
+ *          The new value of the parameter.
+ *
+ * @retval BblasSuccess on success
+ * @retval BblasFail if param is unknown
+ ******************************************************************************/
+int bblas_set(bblas_enum_t param, int value)
+{
+    switch (param) {
+    case BblasTuneGemm3M:
+        bblas_gemm_3m = (value != 0);
+        return BblasSuccess;
+    case BblasTunePrefetch:
+        if (value < 0) {
+            bblas_error("illegal value of prefetch distance");
+            return BblasFail;
+        }
+        bblas_prefetch_dist = value;
+        return BblasSuccess;
+    case BblasTuneStream:
+        bblas_stream_c = (value != 0);
+        return BblasSuccess;
+    default:
+        bblas_error("unknown tuning parameter");
+        return BblasFail;
+    }
+}
+
+/***************************************************************************//**
+ * Gets a tuning parameter.
+ *
+ * @param[in] param
+ *          One of the parameters of bblas_set.
+ *
+ * @param[out] value
+ *          The current value of the parameter.
+ *
+ * @retval BblasSuccess on success
+ * @retval BblasFail if param is unknown
+ ******************************************************************************/
+int bblas_get(bblas_enum_t param, int *value)
+{
+    switch (param) {
+    case BblasTuneGemm3M:
+        *value = bblas_gemm_3m;
+        return BblasSuccess;
+    case BblasTunePrefetch:
+        *value = bblas_prefetch_dist;
+        return BblasSuccess;
+    case BblasTuneStream:
+        *value = bblas_stream_c;
+        return BblasSuccess;
+    default:
+        bblas_error("unknown tuning parameter");
+        return BblasFail;
+    }
+}
+
+/***************************************************************************//**
+ * @}
+ * end group bblas_tune
+ ******************************************************************************/
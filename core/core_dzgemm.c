@@ -0,0 +1,196 @@
+/**
+ *
+ * @file
+ *
+ *  BBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions realcomplex dz -> sc
+ *
+ **/
+
+#include "bblas.h"
+
+/******************************************************************************/
+// C = alpha*(Tr + i*Ti) + beta*C for the m-by-n column major matrices
+// Tr and Ti, both with leading dimension ldt. C is not read if beta = 0.
+static void combine(bblas_int m, bblas_int n,
+                    bblas_complex64_t alpha, const double *Tr, const double *Ti,
+                    bblas_int ldt,
+                    bblas_complex64_t beta, bblas_complex64_t *C, bblas_int ldc)
+{
+	for (bblas_int j = 0; j < n; j++) {
+		const double *tr = &Tr[(size_t)ldt*j];
+		const double *ti = &Ti[(size_t)ldt*j];
+		bblas_complex64_t *c = &C[(size_t)ldc*j];
+		if (beta == (bblas_complex64_t)0.0) {
+			for (bblas_int i = 0; i < m; i++)
+				c[i] = alpha*(tr[i] + I*ti[i]);
+		}
+		else {
+			for (bblas_int i = 0; i < m; i++)
+				c[i] = alpha*(tr[i] + I*ti[i]) + beta*c[i];
+		}
+	}
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_batched_blas
+ *
+ *  Column major real-times-complex matrix-matrix multiply
+ *
+ *      \f[ C = \alpha [op( A ) \times op( B )] + \beta C, \f]
+ *
+ *  where A is real and B and C are complex.
+ *
+ *  The real and imaginary parts of op( B ) are copied side by side into
+ *  the k-by-2n real matrix [Re op( B ), Im op( B )], so that a single real
+ *  gemm computes op( A ) times both parts. This takes half the flops of
+ *  promoting A to complex and never stores a complex copy of A.
+ *
+ *******************************************************************************
+ *
+ * @param[in] transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc
+ *          As in blas_dzgemm_batchf, in column major.
+ *
+ * @param[out] work
+ *          Workspace of at least 2*k*n + 2*m*n real numbers.
+ *
+ ******************************************************************************/
+void core_dzgemm(bblas_enum_t transa, bblas_enum_t transb,
+                 bblas_int m, bblas_int n, bblas_int k,
+                 bblas_complex64_t alpha, const double *A, bblas_int lda,
+                                          const bblas_complex64_t *B, bblas_int ldb,
+                 bblas_complex64_t beta,        bblas_complex64_t *C, bblas_int ldc,
+                 double *work)
+{
+	bblas_int ldw = imax(1, k);
+	bblas_int ldt = imax(1, m);
+	double *W = work;
+	double *T = work + (size_t)2*ldw*n;
+
+	// W = [Re op( B ), Im op( B )]
+	for (bblas_int j = 0; j < n; j++) {
+		double *wr = &W[(size_t)ldw*j];
+		double *wi = &W[(size_t)ldw*(n+j)];
+		if (transb == BblasNoTrans) {
+			const bblas_complex64_t *b = &B[(size_t)ldb*j];
+			for (bblas_int l = 0; l < k; l++) {
+				wr[l] = creal(b[l]);
+				wi[l] = cimag(b[l]);
+			}
+		}
+		else {
+			double sign = (transb == BblasConjTrans) ? -1.0 : 1.0;
+			for (bblas_int l = 0; l < k; l++) {
+				bblas_complex64_t b = B[(size_t)ldb*l + j];
+				wr[l] = creal(b);
+				wi[l] = sign*cimag(b);
+			}
+		}
+	}
+
+	// T = op( A )*W
+	cblas_dgemm(CblasColMajor, (CBLAS_TRANSPOSE)transa, CblasNoTrans,
+	            m, 2*n, k,
+	            1.0, A, lda,
+	                 W, ldw,
+	            0.0, T, ldt);
+
+	combine(m, n, alpha, T, &T[(size_t)ldt*n], ldt, beta, C, ldc);
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_batched_blas
+ *
+ *  Column major complex-times-real matrix-matrix multiply
+ *
+ *      \f[ C = \alpha [op( A ) \times op( B )] + \beta C, \f]
+ *
+ *  where B is real and A and C are complex.
+ *
+ *  If op( A ) = A, the complex m-by-k matrix A is used in place as a real
+ *  2m-by-k matrix with leading dimension 2*lda, whose rows alternate
+ *  between real and imaginary parts. One real gemm then gives A*B with the
+ *  same interleaving. If alpha and beta are also real, that gemm works
+ *  directly on C and no workspace is used. Otherwise, the real and
+ *  imaginary parts of op( A ) are first stacked into the 2m-by-k real matrix
+ *  [Re op( A ); Im op( A )].
+ *
+ *******************************************************************************
+ *
+ * @param[in] transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc
+ *          As in blas_zdgemm_batchf, in column major.
+ *
+ * @param[out] work
+ *          Workspace of at least 2*m*k + 2*m*n real numbers.
+ *
+ ******************************************************************************/
+void core_zdgemm(bblas_enum_t transa, bblas_enum_t transb,
+                 bblas_int m, bblas_int n, bblas_int k,
+                 bblas_complex64_t alpha, const bblas_complex64_t *A, bblas_int lda,
+                                          const double *B, bblas_int ldb,
+                 bblas_complex64_t beta,        bblas_complex64_t *C, bblas_int ldc,
+                 double *work)
+{
+	if (transa == BblasNoTrans) {
+		if (cimag(alpha) == 0.0 && cimag(beta) == 0.0) {
+			cblas_dgemm(CblasColMajor, CblasNoTrans, (CBLAS_TRANSPOSE)transb,
+			            2*m, n, k,
+			            creal(alpha), (const double*)A, 2*lda,
+			                          B, ldb,
+			            creal(beta),  (double*)C, 2*ldc);
+			return;
+		}
+		// T = A*B, interleaved as A.
+		bblas_int ldt = imax(1, m);
+		double *T = work;
+		cblas_dgemm(CblasColMajor, CblasNoTrans, (CBLAS_TRANSPOSE)transb,
+		            2*m, n, k,
+		            1.0, (const double*)A, 2*lda,
+		                 B, ldb,
+		            0.0, T, 2*ldt);
+
+		const bblas_complex64_t *Tz = (const bblas_complex64_t*)T;
+		for (bblas_int j = 0; j < n; j++) {
+			const bblas_complex64_t *t = &Tz[(size_t)ldt*j];
+			bblas_complex64_t *c = &C[(size_t)ldc*j];
+			if (beta == (bblas_complex64_t)0.0) {
+				for (bblas_int i = 0; i < m; i++)
+					c[i] = alpha*t[i];
+			}
+			else {
+				for (bblas_int i = 0; i < m; i++)
+					c[i] = alpha*t[i] + beta*c[i];
+			}
+		}
+		return;
+	}
+
+	bblas_int ldw = imax(1, 2*m);
+	double *W = work;
+	double *T = work + (size_t)ldw*k;
+
+	// W = [Re op( A ); Im op( A )], reading A (i.e., op( A ) by rows)
+	// column by column.
+	double sign = (transa == BblasConjTrans) ? -1.0 : 1.0;
+	for (bblas_int i = 0; i < m; i++) {
+		const bblas_complex64_t *a = &A[(size_t)lda*i];
+		for (bblas_int l = 0; l < k; l++) {
+			W[(size_t)ldw*l + i]   = creal(a[l]);
+			W[(size_t)ldw*l + m+i] = sign*cimag(a[l]);
+		}
+	}
+
+	// T = W*op( B )
+	cblas_dgemm(CblasColMajor, CblasNoTrans, (CBLAS_TRANSPOSE)transb,
+	            2*m, n, k,
+	            1.0, W, ldw,
+	                 B, ldb,
+	            0.0, T, ldw);
+
+	combine(m, n, alpha, T, &T[m], ldw, beta, C, ldc);
+}
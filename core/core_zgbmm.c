@@ -0,0 +1,134 @@
+/**
+ *
+ * @file
+ *
+ *  BBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+
+#include "bblas.h"
+
+#define COMPLEX
+
+/***************************************************************************//**
+ *
+ * @ingroup core_batched_blas
+ *
+ *  Native band matrix-matrix multiply,
+ *
+ *          \f[ C = \alpha [op( A ) \times B] + \beta C, \f]
+ *
+ *  where op( A ) is m-by-k, B is k-by-n and C is m-by-n, all column major,
+ *  and A is a band matrix with kl sub-diagonals and ku super-diagonals in
+ *  LAPACK band storage: A(i, l) is A[ku+i-l + lda*l]. Only the band is
+ *  read, so that a product costs O(m*n*(kl+ku)) instead of O(m*n*k).
+ *  The inner loops run down the columns of the band, which are contiguous:
+ *  with op( A ) = A, an axpy of a band column into a column of C per
+ *  element of B, otherwise a dot product of a band column with a column
+ *  of B per element of C.
+ *
+ *******************************************************************************
+ *
+ * @param[in] transa
+ *          - BblasNoTrans:   op( A ) = A, A is m-by-k;
+ *          - BblasTrans:     op( A ) = A^T, A is k-by-m;
+ *          - BblasConjTrans: op( A ) = A^H, A is k-by-m.
+ *
+ * @param[in] m, n, k
+ *          The dimensions of the product. m, n, k >= 0.
+ *
+ * @param[in] kl, ku
+ *          The number of sub-diagonals and super-diagonals of A.
+ *          kl, ku >= 0.
+ *
+ * @param[in] alpha
+ *          The scalar alpha.
+ *
+ * @param[in] A
+ *          The band of A, lda-by-k if transa = BblasNoTrans and lda-by-m
+ *          otherwise.
+ *
+ * @param[in] lda
+ *          The leading dimension of A. lda >= kl+ku+1.
+ *
+ * @param[in] B
+ *          The k-by-n matrix B.
+ *
+ * @param[in] ldb
+ *          The leading dimension of B. ldb >= max(1, k).
+ *
+ * @param[in] beta
+ *          The scalar beta. With beta = 0, C is not read.
+ *
+ * @param[in,out] C
+ *          The m-by-n matrix C.
+ *
+ * @param[in] ldc
+ *          The leading dimension of C. ldc >= max(1, m).
+ *
+ ******************************************************************************/
+void core_zgbmm(bblas_enum_t transa,
+                bblas_int m, bblas_int n, bblas_int k,
+                bblas_int kl, bblas_int ku,
+                bblas_complex64_t alpha, const bblas_complex64_t *A, bblas_int lda,
+                                         const bblas_complex64_t *B, bblas_int ldb,
+                bblas_complex64_t beta,        bblas_complex64_t *C, bblas_int ldc)
+{
+	if (transa == BblasNoTrans) {
+		for (bblas_int j = 0; j < n; j++) {
+			const bblas_complex64_t *b = &B[(size_t)ldb*j];
+			bblas_complex64_t *c = &C[(size_t)ldc*j];
+			if (beta == (bblas_complex64_t)0.0) {
+				for (bblas_int i = 0; i < m; i++)
+					c[i] = 0.0;
+			}
+			else if (beta != (bblas_complex64_t)1.0) {
+				for (bblas_int i = 0; i < m; i++)
+					c[i] *= beta;
+			}
+			// Column l of A has rows max(0, l-ku) to min(m, l+kl+1)-1,
+			// and row i at a[i].
+			for (bblas_int l = 0; l < k; l++) {
+				bblas_complex64_t t = alpha*b[l];
+				const bblas_complex64_t *a = &A[(size_t)lda*l + ku - l];
+				bblas_int first = imax(0, l-ku);
+				bblas_int last = imin(m, l+kl+1);
+				for (bblas_int i = first; i < last; i++)
+					c[i] += t*a[i];
+			}
+		}
+	}
+	else {
+		for (bblas_int j = 0; j < n; j++) {
+			const bblas_complex64_t *b = &B[(size_t)ldb*j];
+			bblas_complex64_t *c = &C[(size_t)ldc*j];
+			// Row i of op( A ) is column i of A, with rows max(0, i-ku)
+			// to min(k, i+kl+1)-1.
+			for (bblas_int i = 0; i < m; i++) {
+				const bblas_complex64_t *a = &A[(size_t)lda*i + ku - i];
+				bblas_int first = imax(0, i-ku);
+				bblas_int last = imin(k, i+kl+1);
+				bblas_complex64_t s = 0.0;
+#ifdef COMPLEX
+				if (transa == BblasConjTrans) {
+					for (bblas_int l = first; l < last; l++)
+						s += conj(a[l])*b[l];
+				}
+				else
+#endif
+				{
+					for (bblas_int l = first; l < last; l++)
+						s += a[l]*b[l];
+				}
+				if (beta == (bblas_complex64_t)0.0)
+					c[i] = alpha*s;
+				else
+					c[i] = alpha*s + beta*c[i];
+			}
+		}
+	}
+}
@@ -0,0 +1,168 @@
+/**
+ *
+ * @file
+ *
+ *  BBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+
+#include "bblas.h"
+
+#include <stdlib.h>
+
+#define COMPLEX
+
+#ifdef COMPLEX
+/******************************************************************************/
+// Whether m-by-n-by-k products are to be computed by the 3M algorithm.
+static bool use_3m(bblas_int m, bblas_int n, bblas_int k)
+{
+	int gemm_3m;
+	bblas_get(BblasTuneGemm3M, &gemm_3m);
+	return gemm_3m && imin(m, imin(n, k)) >= BBLAS_GEMM_3M_MIN;
+}
+
+/******************************************************************************/
+// Copies the conjugate of the rows-by-cols matrix X to W with leading
+// dimension max(1, rows).
+static void conj_copy(bblas_int rows, bblas_int cols,
+                      const bblas_complex64_t *X, bblas_int ldx,
+                      bblas_complex64_t *W)
+{
+	for (bblas_int j = 0; j < cols; j++) {
+		const bblas_complex64_t *x = &X[(size_t)ldx*j];
+		bblas_complex64_t *w = &W[(size_t)rows*j];
+		for (bblas_int i = 0; i < rows; i++)
+			w[i] = conj(x[i]);
+	}
+}
+#endif
+
+/***************************************************************************//**
+ *
+ * @ingroup core_batched_blas
+ *
+ *  Allocates the workspace core_zgemm needs for a group of m-by-n-by-k
+ *  products, if any. This is the workspace of the 3M algorithm, when
+ *  enabled with bblas_set(BblasTuneGemm3M, 1) and
+ *  min(m, n, k) >= BBLAS_GEMM_3M_MIN. Otherwise, operands with
+ *  transa or transb = BblasConjNoTrans, which BLAS does not have, are
+ *  conjugated into the workspace, one matrix at a time, so that the copy
+ *  stays in cache.
+ *
+ *******************************************************************************
+ *
+ * @param[in] transa, transb, m, n, k
+ *          As in blas_zgemm_batchf.
+ *
+ * @param[out] work
+ *          On exit, the workspace, to be released with free(), or NULL if
+ *          none is needed or the one of the 3M algorithm cannot be
+ *          allocated; core_zgemm then uses the conventional algorithm.
+ *
+ * @retval false if the workspace is needed for conjugated operands but
+ *         cannot be allocated.
+ *
+ ******************************************************************************/
+bool core_zgemm_workspace(bblas_enum_t transa, bblas_enum_t transb,
+                          bblas_int m, bblas_int n, bblas_int k,
+                          double **work)
+{
+	*work = NULL;
+#ifdef COMPLEX
+	bool conj = transa == BblasConjNoTrans || transb == BblasConjNoTrans;
+	if (use_3m(m, n, k)) {
+		*work = (double*)malloc(
+			3*((size_t)m*k + (size_t)k*n + (size_t)m*n)*sizeof(double));
+	}
+	else if (conj) {
+		*work = (double*)malloc(
+			((size_t)m*k + (size_t)k*n + 1)*sizeof(bblas_complex64_t));
+	}
+	return *work != NULL || !conj;
+#else
+	return true;
+#endif
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_batched_blas
+ *
+ *  One matrix-matrix multiply of a gemm batch,
+ *
+ *      \f[ C = \alpha [op( A ) \times op( B )] + \beta C, \f]
+ *
+ *  by core_zgemm3m if work is for the 3M algorithm, and by cblas_zgemm
+ *  otherwise.
+ *
+ *******************************************************************************
+ *
+ * @param[in] layout, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc
+ *          As in blas_zgemm_batchf.
+ *
+ * @param[out] work
+ *          The workspace from core_zgemm_workspace(transa, transb, m, n, k).
+ *
+ ******************************************************************************/
+void core_zgemm(bblas_enum_t layout, bblas_enum_t transa, bblas_enum_t transb,
+                bblas_int m, bblas_int n, bblas_int k,
+                bblas_complex64_t alpha, const bblas_complex64_t *A, bblas_int lda,
+                                         const bblas_complex64_t *B, bblas_int ldb,
+                bblas_complex64_t beta,        bblas_complex64_t *C, bblas_int ldc,
+                double *work)
+{
+#ifdef COMPLEX
+	if (work != NULL && use_3m(m, n, k)) {
+		// A row major product is the column major product of
+		// the transposes in reverse order.
+		if (layout == BblasColMajor)
+			core_zgemm3m(transa, transb, m, n, k,
+			             alpha, A, lda,
+			                    B, ldb,
+			             beta,  C, ldc, work);
+		else
+			core_zgemm3m(transb, transa, n, m, k,
+			             alpha, B, ldb,
+			                    A, lda,
+			             beta,  C, ldc, work);
+		return;
+	}
+
+	// BLAS has no conjugation without transposition: such an operand is
+	// conjugated into the workspace, where the product reads it.
+	bblas_complex64_t *W = (bblas_complex64_t*)work;
+	if (transa == BblasConjNoTrans) {
+		bblas_int rows = (layout == BblasColMajor) ? m : k;
+		bblas_int cols = (layout == BblasColMajor) ? k : m;
+		conj_copy(rows, cols, A, lda, W);
+		A = W;
+		lda = imax(1, rows);
+		transa = BblasNoTrans;
+		W += (size_t)m*k;
+	}
+	if (transb == BblasConjNoTrans) {
+		bblas_int rows = (layout == BblasColMajor) ? k : n;
+		bblas_int cols = (layout == BblasColMajor) ? n : k;
+		conj_copy(rows, cols, B, ldb, W);
+		B = W;
+		ldb = imax(1, rows);
+		transb = BblasNoTrans;
+	}
+#else
+	// In real arithmetic, conjugation does nothing.
+	if (transa == BblasConjNoTrans)
+		transa = BblasNoTrans;
+	if (transb == BblasConjNoTrans)
+		transb = BblasNoTrans;
+#endif
+	cblas_zgemm(layout, transa, transb,
+	            m, n, k,
+	            CBLAS_SADDR(alpha), A, lda,
+	                                B, ldb,
+	            CBLAS_SADDR(beta),  C, ldc);
+}
@@ -0,0 +1,129 @@
+/**
+ *
+ * @file
+ *
+ *  BBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> c
+ *
+ **/
+
+#include "bblas.h"
+
+/******************************************************************************/
+// Splits the rows-by-cols matrix op( X ) into its real part Xr, imaginary
+// part Xi and their sum Xs, each column major with leading dimension rows.
+static void split(bblas_enum_t trans, bblas_int rows, bblas_int cols,
+                  const bblas_complex64_t *X, bblas_int ldx,
+                  double *Xr, double *Xi, double *Xs)
+{
+	if (!bblas_transposed(trans)) {
+		// Conjugation only flips the sign of Xi.
+		double sign = (trans == BblasConjNoTrans) ? -1.0 : 1.0;
+		for (bblas_int j = 0; j < cols; j++) {
+			for (bblas_int i = 0; i < rows; i++) {
+				bblas_complex64_t x = X[(size_t)ldx*j + i];
+				Xr[(size_t)rows*j + i] = creal(x);
+				Xi[(size_t)rows*j + i] = sign*cimag(x);
+				Xs[(size_t)rows*j + i] = creal(x) + sign*cimag(x);
+			}
+		}
+	}
+	else {
+		// Read X by columns, i.e., op( X ) by rows.
+		double sign = (trans == BblasConjTrans) ? -1.0 : 1.0;
+		for (bblas_int i = 0; i < rows; i++) {
+			for (bblas_int j = 0; j < cols; j++) {
+				bblas_complex64_t x = X[(size_t)ldx*i + j];
+				Xr[(size_t)rows*j + i] = creal(x);
+				Xi[(size_t)rows*j + i] = sign*cimag(x);
+				Xs[(size_t)rows*j + i] = creal(x) + sign*cimag(x);
+			}
+		}
+	}
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_batched_blas
+ *
+ *  Column major complex matrix-matrix multiply
+ *
+ *      \f[ C = \alpha [op( A ) \times op( B )] + \beta C \f]
+ *
+ *  by the 3M (Gauss) algorithm. With op( A ) = Ar + i Ai and
+ *  op( B ) = Br + i Bi,
+ *
+ *      \f[ T_1 = A_r B_r, \quad T_2 = A_i B_i,
+ *          \quad T_3 = (A_r + A_i)(B_r + B_i), \f]
+ *      \f[ op( A ) \times op( B ) = (T_1 - T_2) + i (T_3 - T_1 - T_2), \f]
+ *
+ *  i.e., three real gemms instead of the four real multiplications
+ *  of every complex multiply-add: 25% fewer flops for large enough m, n, k.
+ *
+ *  Accuracy: the real part is as accurate as with the conventional
+ *  algorithm. The error in the imaginary part is bounded relative to
+ *  (|Ar| + |Ai|)(|Br| + |Bi|) instead of |Ar||Bi| + |Ai||Br|, so it can be
+ *  much larger than usual when the imaginary part of the product is small
+ *  compared to the operands, i.e., after cancellation. Each element is
+ *  still accurate relative to the norms of op( A ) and op( B ), so the
+ *  normwise error bound is only a small constant factor weaker
+ *  (N. J. Higham, Accuracy and Stability of Numerical Algorithms,
+ *  2nd ed., Sec. 23.2.4).
+ *
+ *******************************************************************************
+ *
+ * @param[in] transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc
+ *          As in blas_zgemm_batchf, in column major.
+ *
+ * @param[out] work
+ *          Workspace of at least 3*(m*k + k*n + m*n) real numbers.
+ *
+ ******************************************************************************/
+void core_zgemm3m(bblas_enum_t transa, bblas_enum_t transb,
+                  bblas_int m, bblas_int n, bblas_int k,
+                  bblas_complex64_t alpha, const bblas_complex64_t *A, bblas_int lda,
+                                           const bblas_complex64_t *B, bblas_int ldb,
+                  bblas_complex64_t beta,        bblas_complex64_t *C, bblas_int ldc,
+                  double *work)
+{
+	size_t asize = (size_t)m*k;
+	size_t bsize = (size_t)k*n;
+	size_t csize = (size_t)m*n;
+	double *Ar = work;
+	double *Ai = Ar + asize;
+	double *As = Ai + asize;
+	double *Br = As + asize;
+	double *Bi = Br + bsize;
+	double *Bs = Bi + bsize;
+	double *T1 = Bs + bsize;
+	double *T2 = T1 + csize;
+	double *T3 = T2 + csize;
+
+	split(transa, m, k, A, lda, Ar, Ai, As);
+	split(transb, k, n, B, ldb, Br, Bi, Bs);
+
+	bblas_int ldw = imax(1, m);
+	bblas_int ldb2 = imax(1, k);
+	cblas_dgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, m, n, k,
+	            1.0, Ar, ldw, Br, ldb2, 0.0, T1, ldw);
+	cblas_dgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, m, n, k,
+	            1.0, Ai, ldw, Bi, ldb2, 0.0, T2, ldw);
+	cblas_dgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, m, n, k,
+	            1.0, As, ldw, Bs, ldb2, 0.0, T3, ldw);
+
+	for (bblas_int j = 0; j < n; j++) {
+		bblas_complex64_t *c = &C[(size_t)ldc*j];
+		for (bblas_int i = 0; i < m; i++) {
+			size_t ij = (size_t)ldw*j + i;
+			bblas_complex64_t p = (T1[ij] - T2[ij]) +
+			                      I*(T3[ij] - T1[ij] - T2[ij]);
+			if (beta == (bblas_complex64_t)0.0)
+				c[i] = alpha*p;
+			else
+				c[i] = alpha*p + beta*c[i];
+		}
+	}
+}
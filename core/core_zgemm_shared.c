@@ -0,0 +1,279 @@
+/**
+ *
+ * @file
+ *
+ *  BBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+
+#include "bblas.h"
+
+#include <stdlib.h>
+
+#define COMPLEX
+
+/******************************************************************************/
+// Copies the rows-by-cols matrix op( X ), with X column major, to W with
+// leading dimension ldw.
+static void copy_op(bblas_enum_t trans, bblas_int rows, bblas_int cols,
+                    const bblas_complex64_t *X, bblas_int ldx,
+                    bblas_complex64_t *W, bblas_int ldw)
+{
+	for (bblas_int j = 0; j < cols; j++) {
+		bblas_complex64_t *w = &W[(size_t)ldw*j];
+		if (!bblas_transposed(trans)) {
+			const bblas_complex64_t *x = &X[(size_t)ldx*j];
+#ifdef COMPLEX
+			if (trans == BblasConjNoTrans) {
+				for (bblas_int i = 0; i < rows; i++)
+					w[i] = conj(x[i]);
+				continue;
+			}
+#endif
+			for (bblas_int i = 0; i < rows; i++)
+				w[i] = x[i];
+		}
+#ifdef COMPLEX
+		else if (trans == BblasConjTrans) {
+			for (bblas_int i = 0; i < rows; i++)
+				w[i] = conj(X[(size_t)ldx*i + j]);
+		}
+#endif
+		else {
+			for (bblas_int i = 0; i < rows; i++)
+				w[i] = X[(size_t)ldx*i + j];
+		}
+	}
+}
+
+/******************************************************************************/
+// Copies the rows-by-cols column major matrix X to Y.
+static void copy(bblas_int rows, bblas_int cols,
+                 const bblas_complex64_t *X, bblas_int ldx,
+                 bblas_complex64_t *Y, bblas_int ldy)
+{
+	copy_op(BblasNoTrans, rows, cols, X, ldx, Y, ldy);
+}
+
+/******************************************************************************/
+// C[i] = alpha*op( A )*op( B[i] ) + beta*C[i], column major, with A shared:
+// [C[0] .. C[g-1]] = alpha*op( A )*[op( B[0] ) .. op( B[g-1] )] + beta*[..].
+static bool shared_left(bblas_enum_t transa, bblas_enum_t transb,
+                        bblas_int m, bblas_int n, bblas_int k,
+                        bblas_complex64_t alpha, const bblas_complex64_t *A, bblas_int lda,
+                        bblas_complex64_t const *const *B, bblas_int ldb,
+                        bblas_complex64_t beta, bblas_complex64_t **C, bblas_int ldc,
+                        bblas_int group_size)
+{
+	// B[i] and C[i] side by side: the group is already one wide matrix.
+	if (transb == BblasNoTrans &&
+	    bblas_is_coalesced(BblasColMajor, true, k, n,
+	                       (const void *const *)B, ldb,
+	                       sizeof(bblas_complex64_t), group_size) &&
+	    bblas_is_coalesced(BblasColMajor, true, m, n,
+	                       (const void *const *)C, ldc,
+	                       sizeof(bblas_complex64_t), group_size)) {
+		double *work;
+		if (!core_zgemm_workspace(transa, BblasNoTrans,
+		                          m, n*group_size, k, &work))
+			return false;
+		core_zgemm(BblasColMajor, transa, BblasNoTrans,
+		           m, n*group_size, k,
+		           alpha, A, lda,
+		                  B[0], ldb,
+		           beta,  C[0], ldc, work);
+		free(work);
+		return true;
+	}
+
+	// Wide enough operands make efficient gemms on their own.
+	if (n >= BBLAS_SHARED_COLS)
+		return false;
+
+	// Gather chunks of op( B[i] ) and C[i] side by side.
+	bblas_int chunk = imin(group_size, BBLAS_SHARED_COLS/imax(1, n));
+	bblas_int ldw = imax(1, k);
+	bblas_int ldt = imax(1, m);
+	bblas_complex64_t *W = (bblas_complex64_t*)malloc(
+		((size_t)ldw + ldt)*n*chunk*sizeof(bblas_complex64_t));
+	if (W == NULL)
+		return false;
+	bblas_complex64_t *T = W + (size_t)ldw*n*chunk;
+	double *work;
+	if (!core_zgemm_workspace(transa, BblasNoTrans, m, n*chunk, k, &work)) {
+		free(W);
+		return false;
+	}
+
+	for (bblas_int first = 0; first < group_size; first += chunk) {
+		bblas_int count = imin(chunk, group_size-first);
+		for (bblas_int i = 0; i < count; i++) {
+			copy_op(transb, k, n, B[first+i], ldb, &W[(size_t)ldw*n*i], ldw);
+			if (beta != (bblas_complex64_t)0.0)
+				copy(m, n, C[first+i], ldc, &T[(size_t)ldt*n*i], ldt);
+		}
+		core_zgemm(BblasColMajor, transa, BblasNoTrans,
+		           m, n*count, k,
+		           alpha, A, lda,
+		                  W, ldw,
+		           beta,  T, ldt, work);
+		for (bblas_int i = 0; i < count; i++)
+			copy(m, n, &T[(size_t)ldt*n*i], ldt, C[first+i], ldc);
+	}
+	free(work);
+	free(W);
+	return true;
+}
+
+/******************************************************************************/
+// C[i] = alpha*op( A[i] )*op( B ) + beta*C[i], column major, with B shared:
+// [C[0]; ..; C[g-1]] = alpha*[op( A[0] ); ..; op( A[g-1] )]*op( B ) + beta*[..].
+static bool shared_right(bblas_enum_t transa, bblas_enum_t transb,
+                         bblas_int m, bblas_int n, bblas_int k,
+                         bblas_complex64_t alpha, bblas_complex64_t const *const *A, bblas_int lda,
+                         const bblas_complex64_t *B, bblas_int ldb,
+                         bblas_complex64_t beta, bblas_complex64_t **C, bblas_int ldc,
+                         bblas_int group_size)
+{
+	// A[i] and C[i] on top of each other: the group is already one tall matrix.
+	if (transa == BblasNoTrans &&
+	    bblas_is_coalesced(BblasColMajor, false, m, k,
+	                       (const void *const *)A, lda,
+	                       sizeof(bblas_complex64_t), group_size) &&
+	    bblas_is_coalesced(BblasColMajor, false, m, n,
+	                       (const void *const *)C, ldc,
+	                       sizeof(bblas_complex64_t), group_size)) {
+		double *work;
+		if (!core_zgemm_workspace(BblasNoTrans, transb,
+		                          m*group_size, n, k, &work))
+			return false;
+		core_zgemm(BblasColMajor, BblasNoTrans, transb,
+		           m*group_size, n, k,
+		           alpha, A[0], lda,
+		                  B, ldb,
+		           beta,  C[0], ldc, work);
+		free(work);
+		return true;
+	}
+
+	// Tall enough operands make efficient gemms on their own.
+	if (m >= BBLAS_SHARED_COLS)
+		return false;
+
+	// Gather chunks of op( A[i] ) and C[i] on top of each other.
+	bblas_int chunk = imin(group_size, BBLAS_SHARED_COLS/imax(1, m));
+	bblas_complex64_t *W = (bblas_complex64_t*)malloc(
+		(size_t)m*chunk*((size_t)k + n)*sizeof(bblas_complex64_t));
+	if (W == NULL)
+		return false;
+	bblas_complex64_t *T = W + (size_t)m*chunk*k;
+	double *work;
+	if (!core_zgemm_workspace(BblasNoTrans, transb, m*chunk, n, k, &work)) {
+		free(W);
+		return false;
+	}
+
+	for (bblas_int first = 0; first < group_size; first += chunk) {
+		bblas_int count = imin(chunk, group_size-first);
+		bblas_int ldw = imax(1, m*count);
+		for (bblas_int i = 0; i < count; i++) {
+			copy_op(transa, m, k, A[first+i], lda, &W[m*i], ldw);
+			if (beta != (bblas_complex64_t)0.0)
+				copy(m, n, C[first+i], ldc, &T[m*i], ldw);
+		}
+		core_zgemm(BblasColMajor, BblasNoTrans, transb,
+		           m*count, n, k,
+		           alpha, W, ldw,
+		                  B, ldb,
+		           beta,  T, ldw, work);
+		for (bblas_int i = 0; i < count; i++)
+			copy(m, n, &T[m*i], ldw, C[first+i], ldc);
+	}
+	free(work);
+	free(W);
+	return true;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_batched_blas
+ *
+ *  Computes a gemm group whose matrices all share the same A or the same B
+ *  with few large gemms instead of group_size small ones.
+ *
+ *  With a shared A in column major, C[i] = alpha*op( A )*op( B[i] ) +
+ *  beta*C[i] is one block column of
+ *
+ *      \f[ [C_0 \dots C_{g-1}] = \alpha op( A ) [op( B_0 ) \dots op( B_{g-1} )]
+ *          + \beta [C_0 \dots C_{g-1}]. \f]
+ *
+ *  If B[i] = B[0] + i*ldb*n and C[i] = C[0] + i*ldc*n, and op( B[i] ) = B[i],
+ *  these block rows are already stored as single matrices and one gemm
+ *  computes the whole group. Otherwise, op( B[i] ) and C[i] are gathered
+ *  into a workspace, up to BBLAS_SHARED_COLS columns at a time, so that
+ *  op( A ) is packed once per chunk instead of once per matrix, and the
+ *  results are copied back to C[i]. A shared B is the same with block rows,
+ *  and row major is column major for the transposes.
+ *
+ *  The gather is skipped when n (or m for a shared B) is already at least
+ *  BBLAS_SHARED_COLS, since each gemm is then efficient on its own.
+ *
+ *******************************************************************************
+ *
+ * @param[in] group_size, layout, transa, transb, m, n, k, alpha, A, lda,
+ *            B, ldb, beta, C, ldc
+ *          As in blas_zgemm_batchf. The arguments must be valid.
+ *
+ *******************************************************************************
+ *
+ * @retval true  if the group has been computed.
+ * @retval false if no operand is shared, the operands are too large to
+ *               benefit, or the workspace cannot be allocated. Nothing
+ *               has been computed.
+ *
+ ******************************************************************************/
+bool core_zgemm_shared(bblas_int group_size, bblas_enum_t layout,
+                       bblas_enum_t transa, bblas_enum_t transb,
+                       bblas_int m, bblas_int n, bblas_int k,
+                       bblas_complex64_t alpha, bblas_complex64_t const *const *A, bblas_int lda,
+                                                bblas_complex64_t const *const *B, bblas_int ldb,
+                       bblas_complex64_t beta,  bblas_complex64_t             **C, bblas_int ldc)
+{
+	if (group_size < 2)
+		return false;
+
+	// A row major product is the column major product of
+	// the transposes in reverse order.
+	if (layout == BblasRowMajor) {
+		bblas_enum_t trans = transa;
+		transa = transb;
+		transb = trans;
+		bblas_int tmp = m;
+		m = n;
+		n = tmp;
+		bblas_complex64_t const *const *X = A;
+		A = B;
+		B = X;
+		tmp = lda;
+		lda = ldb;
+		ldb = tmp;
+	}
+
+	if (bblas_is_shared((const void *const *)A, group_size))
+		return shared_left(transa, transb, m, n, k,
+		                   alpha, A[0], lda,
+		                          B, ldb,
+		                   beta,  C, ldc, group_size);
+
+	if (bblas_is_shared((const void *const *)B, group_size))
+		return shared_right(transa, transb, m, n, k,
+		                    alpha, A, lda,
+		                           B[0], ldb,
+		                    beta,  C, ldc, group_size);
+
+	return false;
+}
@@ -0,0 +1,95 @@
+/**
+ *
+ * @file
+ *
+ *  BBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+
+#include "bblas.h"
+
+#include <math.h>
+
+#define COMPLEX
+
+/***************************************************************************//**
+ *
+ * @ingroup core_batched_blas
+ *
+ *  Computes the unblocked QR factorization A = Q R of the column major
+ *  m-by-n matrix A, as LAPACK zgeqr2: Q = H(0) H(1) .. H(k-1), with
+ *  k = min(m, n), is a product of elementary reflectors
+ *  H(i) = I - tau(i) v(i) v(i)^H, where v(i) has zeros before a unit
+ *  element i and its elements below it are stored below A(i, i).
+ *
+ *  The reflectors are generated as by LAPACK zlarfg, without its
+ *  rescaling of tiny columns, and applied to the trailing columns with
+ *  plain loops, which the compiler vectorizes, instead of one BLAS call
+ *  per column: for the small matrices of a batch, the calls would cost
+ *  more than the arithmetic.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *          The number of rows of A. m >= 0.
+ *
+ * @param[in] n
+ *          The number of columns of A. n >= 0.
+ *
+ * @param[in,out] A
+ *          On entry, the m-by-n matrix A. On exit, R on and above the
+ *          diagonal and the reflectors below it.
+ *
+ * @param[in] lda
+ *          The leading dimension of A. lda >= max(1, m).
+ *
+ * @param[out] tau
+ *          The min(m, n) scalar factors of the reflectors.
+ *
+ ******************************************************************************/
+void core_zgeqr2(bblas_int m, bblas_int n,
+                 bblas_complex64_t *A, bblas_int lda,
+                 bblas_complex64_t *tau)
+{
+	bblas_int k = imin(m, n);
+	for (bblas_int i = 0; i < k; i++) {
+		bblas_complex64_t *ai = &A[(size_t)lda*i + i];
+		bblas_complex64_t *x  = ai+1;
+		bblas_int len = m-i-1;
+
+		// Generate H(i) to annihilate A(i+1:m-1, i).
+		double xnorm = cblas_dznrm2(len, x, 1);
+		bblas_complex64_t alpha = ai[0];
+#ifdef COMPLEX
+		if (xnorm == 0.0 && cimag(alpha) == 0.0) {
+#else
+		if (xnorm == 0.0) {
+#endif
+			tau[i] = 0.0;
+			continue;
+		}
+		double beta = -copysign(hypot(cabs(alpha), xnorm), creal(alpha));
+		tau[i] = (beta-alpha)/beta;
+		bblas_complex64_t scal = 1.0/(alpha-beta);
+		for (bblas_int r = 0; r < len; r++)
+			x[r] *= scal;
+		ai[0] = beta;
+
+		// Apply H(i)^H = I - conj(tau(i)) v v^H to A(i:m-1, i+1:n-1).
+		bblas_complex64_t ctau = conj(tau[i]);
+		for (bblas_int j = i+1; j < n; j++) {
+			bblas_complex64_t *aj = &A[(size_t)lda*j + i];
+			bblas_complex64_t w = aj[0];
+			for (bblas_int r = 0; r < len; r++)
+				w += conj(x[r])*aj[r+1];
+			w *= ctau;
+			aj[0] -= w;
+			for (bblas_int r = 0; r < len; r++)
+				aj[r+1] -= w*x[r];
+		}
+	}
+}
@@ -0,0 +1,219 @@
+/**
+ *
+ * @file
+ *
+ *  BBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+
+#include "bblas.h"
+
+#include <math.h>
+
+#define COMPLEX
+
+/***************************************************************************//**
+ *
+ * @ingroup core_batched_blas
+ *
+ *  Copies the m-by-n matrices X[l], l = 0 .. lanes-1, whose element (k, j)
+ *  is X[l][k*incx + j*ldx], to the interleaved workspace W, where it is
+ *  W[(j*m + k)*lanes + l]: element k of every vector is followed by element
+ *  k+1, lanes apart. A vector is the case n = 1.
+ *
+ ******************************************************************************/
+void core_zgather_lanes(bblas_int lanes, bblas_int m, bblas_int n,
+                        bblas_complex64_t const *const *X, bblas_int incx, bblas_int ldx,
+                        bblas_complex64_t *W)
+{
+	for (bblas_int l = 0; l < lanes; l++) {
+		for (bblas_int j = 0; j < n; j++) {
+			const bblas_complex64_t *x = &X[l][(size_t)ldx*j];
+			bblas_complex64_t *w = &W[(size_t)m*j*lanes + l];
+			for (bblas_int k = 0; k < m; k++)
+				w[(size_t)k*lanes] = x[(size_t)incx*k];
+		}
+	}
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_batched_blas
+ *
+ *  Copies the interleaved workspace W back to the matrices X[l];
+ *  the inverse of core_zgather_lanes.
+ *
+ ******************************************************************************/
+void core_zscatter_lanes(bblas_int lanes, bblas_int m, bblas_int n,
+                         const bblas_complex64_t *W,
+                         bblas_complex64_t **X, bblas_int incx, bblas_int ldx)
+{
+	for (bblas_int l = 0; l < lanes; l++) {
+		for (bblas_int j = 0; j < n; j++) {
+			bblas_complex64_t *x = &X[l][(size_t)ldx*j];
+			const bblas_complex64_t *w = &W[(size_t)m*j*lanes + l];
+			for (bblas_int k = 0; k < m; k++)
+				x[(size_t)incx*k] = w[(size_t)k*lanes];
+		}
+	}
+}
+
+/******************************************************************************/
+// The 1-norm of z, as a cheaper magnitude for the choice of the pivots.
+static inline double cabs1(bblas_complex64_t z)
+{
+#ifdef COMPLEX
+	return fabs(creal(z)) + fabs(cimag(z));
+#else
+	return fabs(z);
+#endif
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_batched_blas
+ *
+ *  Solves lanes tridiagonal systems A[l] X[l] = B[l] at once, by Gaussian
+ *  elimination with partial pivoting as LAPACK zgtsv, on interleaved
+ *  operands: element k of the vectors of system l is at index k*inct + l,
+ *  and element (k, j) of B[l] at k*incb + j*ldb + l.
+ *
+ *  The elimination is sequential along each system, but the systems are
+ *  independent: the innermost loops run across the systems, on consecutive
+ *  elements, and vectorize with one system per lane. The row interchanges
+ *  are chosen per system by selects rather than branches.
+ *
+ *******************************************************************************
+ *
+ * @param[in] lanes
+ *          The number of systems. 0 <= lanes <= BBLAS_TRIDIAG_LANES.
+ *
+ * @param[in] n
+ *          The order of the matrices A[l]. n >= 0.
+ *
+ * @param[in] nrhs
+ *          The number of columns of the matrices B[l]. nrhs >= 0.
+ *
+ * @param[in,out] dl
+ *          On entry, the n-1 sub-diagonal elements of the A[l].
+ *          On exit, the n-2 elements of the second super-diagonal of the
+ *          factors U[l], as by LAPACK zgtsv.
+ *
+ * @param[in,out] d
+ *          On entry, the n diagonal elements of the A[l].
+ *          On exit, the diagonals of the U[l].
+ *
+ * @param[in,out] du
+ *          On entry, the n-1 super-diagonal elements of the A[l].
+ *          On exit, the first super-diagonals of the U[l].
+ *
+ * @param[in] inct
+ *          The distance between consecutive elements of a system in dl, d
+ *          and du. inct >= lanes.
+ *
+ * @param[in,out] B
+ *          On entry, the right hand sides B[l]; on exit, the solutions X[l].
+ *
+ * @param[in] incb, ldb
+ *          The distances between consecutive rows and columns of B[l].
+ *
+ * @param[out] info
+ *          Array of length lanes; info[l] = 0 if system l was solved, and
+ *          k+1 if U[l](k, k) is exactly zero, in which case X[l] is not
+ *          computed reliably.
+ *
+ ******************************************************************************/
+void core_zgtsv_lanes(bblas_int lanes, bblas_int n, bblas_int nrhs,
+                      bblas_complex64_t *dl, bblas_complex64_t *d, bblas_complex64_t *du,
+                      bblas_int inct,
+                      bblas_complex64_t *B, bblas_int incb, bblas_int ldb,
+                      bblas_int *info)
+{
+	for (bblas_int l = 0; l < lanes; l++)
+		info[l] = 0;
+	if (n == 0)
+		return;
+
+	// Multiplier and row interchange of each system at the current step.
+	bblas_complex64_t mult[BBLAS_TRIDIAG_LANES];
+	bool swap[BBLAS_TRIDIAG_LANES];
+
+	// Forward elimination, rows k and k+1 interchanged where the
+	// sub-diagonal element is the larger pivot.
+	for (bblas_int k = 0; k < n-1; k++) {
+		bblas_complex64_t *dlk = &dl[(size_t)inct*k];
+		bblas_complex64_t *dk  = &d [(size_t)inct*k];
+		bblas_complex64_t *dk1 = &d [(size_t)inct*(k+1)];
+		bblas_complex64_t *duk = &du[(size_t)inct*k];
+		for (bblas_int l = 0; l < lanes; l++) {
+			bblas_complex64_t a = dk[l];
+			bblas_complex64_t c = dlk[l];
+			bblas_complex64_t u = duk[l];
+			bblas_complex64_t v = dk1[l];
+			bool s = cabs1(a) < cabs1(c);
+			bblas_complex64_t piv = s ? c : a;
+			bblas_complex64_t other = s ? a : c;
+			bblas_complex64_t f = (other == (bblas_complex64_t)0.0) ?
+				(bblas_complex64_t)0.0 : other/piv;
+			info[l] = (info[l] == 0 && piv == (bblas_complex64_t)0.0) ?
+				k+1 : info[l];
+			dk[l]  = piv;
+			dk1[l] = s ? u - f*v : v - f*u;
+			duk[l] = s ? v : u;
+			mult[l] = f;
+			swap[l] = s;
+		}
+		// The interchange moves du[k+1] to the second super-diagonal,
+		// stored in dl[k].
+		if (k < n-2) {
+			bblas_complex64_t *du1 = &du[(size_t)inct*(k+1)];
+			for (bblas_int l = 0; l < lanes; l++) {
+				bblas_complex64_t w = du1[l];
+				dlk[l] = swap[l] ? w : 0.0;
+				du1[l] = swap[l] ? -mult[l]*w : w;
+			}
+		}
+		for (bblas_int j = 0; j < nrhs; j++) {
+			bblas_complex64_t *bk  = &B[(size_t)incb*k + (size_t)ldb*j];
+			bblas_complex64_t *bk1 = &B[(size_t)incb*(k+1) + (size_t)ldb*j];
+			for (bblas_int l = 0; l < lanes; l++) {
+				bblas_complex64_t x = bk[l];
+				bblas_complex64_t y = bk1[l];
+				bk[l]  = swap[l] ? y : x;
+				bk1[l] = swap[l] ? x - mult[l]*y : y - mult[l]*x;
+			}
+		}
+	}
+	bblas_complex64_t *dn = &d[(size_t)inct*(n-1)];
+	for (bblas_int l = 0; l < lanes; l++)
+		info[l] = (info[l] == 0 && dn[l] == (bblas_complex64_t)0.0) ? n : info[l];
+
+	// Back substitution with U, which has two super-diagonals.
+	for (bblas_int j = 0; j < nrhs; j++) {
+		bblas_complex64_t *b = &B[(size_t)ldb*j];
+		bblas_complex64_t *bn = &b[(size_t)incb*(n-1)];
+		for (bblas_int l = 0; l < lanes; l++)
+			bn[l] = bn[l]/dn[l];
+		if (n > 1) {
+			bblas_complex64_t *bk  = &b[(size_t)incb*(n-2)];
+			bblas_complex64_t *dk  = &d [(size_t)inct*(n-2)];
+			bblas_complex64_t *duk = &du[(size_t)inct*(n-2)];
+			for (bblas_int l = 0; l < lanes; l++)
+				bk[l] = (bk[l] - duk[l]*bn[l])/dk[l];
+		}
+		for (bblas_int k = n-3; k >= 0; k--) {
+			bblas_complex64_t *bk  = &b[(size_t)incb*k];
+			bblas_complex64_t *bk1 = &b[(size_t)incb*(k+1)];
+			bblas_complex64_t *bk2 = &b[(size_t)incb*(k+2)];
+			bblas_complex64_t *dlk = &dl[(size_t)inct*k];
+			bblas_complex64_t *dk  = &d [(size_t)inct*k];
+			bblas_complex64_t *duk = &du[(size_t)inct*k];
+			for (bblas_int l = 0; l < lanes; l++)
+				bk[l] = (bk[l] - duk[l]*bk1[l] - dlk[l]*bk2[l])/dk[l];
+		}
+	}
+}
@@ -0,0 +1,114 @@
+/**
+ *
+ * @file
+ *
+ *  BBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+
+#include "bblas.h"
+
+#include <math.h>
+
+/***************************************************************************//**
+ *
+ * @ingroup core_batched_blas
+ *
+ *  Returns the norm of the column major m-by-n matrix A, as LAPACK zlange:
+ *
+ *  - BblasMaxNorm:       max |A(i, j)|;
+ *  - BblasOneNorm:       the largest column sum of the |A(i, j)|;
+ *  - BblasInfNorm:       the largest row sum of the |A(i, j)|;
+ *  - BblasFrobeniusNorm: sqrt( sum |A(i, j)|^2 ).
+ *
+ *  A is read once, column by column, and the row sums of the infinity
+ *  norm are accumulated in work along the columns, so that every inner
+ *  loop runs with unit stride. A NaN in A propagates to the norm.
+ *
+ *******************************************************************************
+ *
+ * @param[in] norm
+ *          The norm, one of the above.
+ *
+ * @param[in] m
+ *          The number of rows of A. m >= 0.
+ *
+ * @param[in] n
+ *          The number of columns of A. n >= 0.
+ *
+ * @param[in] A
+ *          The m-by-n matrix A.
+ *
+ * @param[in] lda
+ *          The leading dimension of A. lda >= max(1, m).
+ *
+ * @param[out] work
+ *          Workspace of m elements if norm = BblasInfNorm; not referenced
+ *          otherwise.
+ *
+ * @return The norm of A, 0 if m or n is 0.
+ *
+ ******************************************************************************/
+double core_zlange(bblas_enum_t norm, bblas_int m, bblas_int n,
+                   const bblas_complex64_t *A, bblas_int lda,
+                   double *work)
+{
+	double value = 0.0;
+	if (m == 0 || n == 0)
+		return value;
+
+	switch (norm) {
+	case BblasMaxNorm:
+		for (bblas_int j = 0; j < n; j++) {
+			const bblas_complex64_t *aj = &A[(size_t)lda*j];
+			for (bblas_int i = 0; i < m; i++) {
+				double a = cabs(aj[i]);
+				if (value < a || isnan(a))
+					value = a;
+			}
+		}
+		break;
+
+	case BblasOneNorm:
+		for (bblas_int j = 0; j < n; j++) {
+			const bblas_complex64_t *aj = &A[(size_t)lda*j];
+			double sum = 0.0;
+			for (bblas_int i = 0; i < m; i++)
+				sum += cabs(aj[i]);
+			if (value < sum || isnan(sum))
+				value = sum;
+		}
+		break;
+
+	case BblasInfNorm:
+		for (bblas_int i = 0; i < m; i++)
+			work[i] = 0.0;
+		for (bblas_int j = 0; j < n; j++) {
+			const bblas_complex64_t *aj = &A[(size_t)lda*j];
+			for (bblas_int i = 0; i < m; i++)
+				work[i] += cabs(aj[i]);
+		}
+		for (bblas_int i = 0; i < m; i++) {
+			if (value < work[i] || isnan(work[i]))
+				value = work[i];
+		}
+		break;
+
+	case BblasFrobeniusNorm: {
+		double scale = 0.0;
+		double sumsq = 1.0;
+		for (bblas_int j = 0; j < n; j++)
+			core_zlassq(m, &A[(size_t)lda*j], &scale, &sumsq);
+		value = scale*sqrt(sumsq);
+		break;
+	}
+
+	default:
+		break;
+	}
+	return value;
+}
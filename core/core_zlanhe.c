@@ -0,0 +1,135 @@
+/**
+ *
+ * @file
+ *
+ *  BBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> c
+ *
+ **/
+
+#include "bblas.h"
+
+#include <math.h>
+
+/***************************************************************************//**
+ *
+ * @ingroup core_batched_blas
+ *
+ *  Returns the norm of the column major n-by-n Hermitian matrix A, of
+ *  which only the uplo triangle is stored, as LAPACK zlanhe. The one and
+ *  infinity norms are equal, and the imaginary parts of the diagonal are
+ *  not referenced. See core_zlange for the norms.
+ *
+ *  The stored triangle is read once, column by column: the sums of the
+ *  elements of column j outside the triangle, which are the rows of the
+ *  triangle, are accumulated in work while sweeping the columns, so that
+ *  every inner loop runs with unit stride.
+ *
+ *******************************************************************************
+ *
+ * @param[in] norm
+ *          The norm, as for core_zlange.
+ *
+ * @param[in] uplo
+ *          - BblasUpper: the upper triangle of A is stored;
+ *          - BblasLower: the lower triangle of A is stored.
+ *
+ * @param[in] n
+ *          The order of A. n >= 0.
+ *
+ * @param[in] A
+ *          The n-by-n Hermitian matrix A.
+ *
+ * @param[in] lda
+ *          The leading dimension of A. lda >= max(1, n).
+ *
+ * @param[out] work
+ *          Workspace of n elements if norm = BblasOneNorm or
+ *          BblasInfNorm; not referenced otherwise.
+ *
+ * @return The norm of A, 0 if n is 0.
+ *
+ ******************************************************************************/
+double core_zlanhe(bblas_enum_t norm, bblas_enum_t uplo, bblas_int n,
+                   const bblas_complex64_t *A, bblas_int lda,
+                   double *work)
+{
+	double value = 0.0;
+	if (n == 0)
+		return value;
+
+	switch (norm) {
+	case BblasMaxNorm:
+		for (bblas_int j = 0; j < n; j++) {
+			const bblas_complex64_t *aj = &A[(size_t)lda*j];
+			bblas_int first = (uplo == BblasUpper) ? 0 : j;
+			bblas_int last  = (uplo == BblasUpper) ? j+1 : n;
+			for (bblas_int i = first; i < last; i++) {
+				double a = (i == j) ? fabs(creal(aj[i])) : cabs(aj[i]);
+				if (value < a || isnan(a))
+					value = a;
+			}
+		}
+		break;
+
+	case BblasOneNorm:
+	case BblasInfNorm:
+		for (bblas_int i = 0; i < n; i++)
+			work[i] = 0.0;
+		if (uplo == BblasUpper) {
+			for (bblas_int j = 0; j < n; j++) {
+				const bblas_complex64_t *aj = &A[(size_t)lda*j];
+				double sum = 0.0;
+				for (bblas_int i = 0; i < j; i++) {
+					double a = cabs(aj[i]);
+					sum += a;
+					work[i] += a;
+				}
+				work[j] = sum + fabs(creal(aj[j]));
+			}
+		}
+		else {
+			for (bblas_int j = 0; j < n; j++) {
+				const bblas_complex64_t *aj = &A[(size_t)lda*j];
+				double sum = work[j] + fabs(creal(aj[j]));
+				for (bblas_int i = j+1; i < n; i++) {
+					double a = cabs(aj[i]);
+					sum += a;
+					work[i] += a;
+				}
+				work[j] = sum;
+			}
+		}
+		for (bblas_int i = 0; i < n; i++) {
+			if (value < work[i] || isnan(work[i]))
+				value = work[i];
+		}
+		break;
+
+	case BblasFrobeniusNorm: {
+		// The elements off the diagonal count twice.
+		double scale = 0.0;
+		double sumsq = 1.0;
+		for (bblas_int j = 0; j < n; j++) {
+			if (uplo == BblasUpper)
+				core_zlassq(j, &A[(size_t)lda*j], &scale, &sumsq);
+			else
+				core_zlassq(n-1-j, &A[(size_t)lda*j + j+1], &scale, &sumsq);
+		}
+		sumsq *= 2.0;
+		for (bblas_int j = 0; j < n; j++) {
+			bblas_complex64_t ajj = creal(A[(size_t)lda*j + j]);
+			core_zlassq(1, &ajj, &scale, &sumsq);
+		}
+		value = scale*sqrt(sumsq);
+		break;
+	}
+
+	default:
+		break;
+	}
+	return value;
+}
@@ -0,0 +1,153 @@
+/**
+ *
+ * @file
+ *
+ *  BBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+
+#include "bblas.h"
+
+#include <math.h>
+
+/******************************************************************************/
+// Rows first .. last-1 of column j of the m-row trapezoid, without the
+// diagonal if it is unit.
+static inline void trapezoid_rows(bblas_enum_t uplo, bool unit,
+                                  bblas_int m, bblas_int j,
+                                  bblas_int *first, bblas_int *last)
+{
+	if (uplo == BblasUpper) {
+		*first = 0;
+		*last  = imin(m, unit ? j : j+1);
+	}
+	else {
+		*first = unit ? j+1 : j;
+		*last  = m;
+	}
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_batched_blas
+ *
+ *  Returns the norm of the column major m-by-n trapezoidal matrix A, as
+ *  LAPACK zlantr. See core_zlange for the norms. With a unit diagonal,
+ *  the diagonal elements of A are not referenced and count as ones.
+ *
+ *  The trapezoid is read once, column by column, with the row sums of the
+ *  infinity norm accumulated in work, so that every inner loop runs with
+ *  unit stride.
+ *
+ *******************************************************************************
+ *
+ * @param[in] norm
+ *          The norm, as for core_zlange.
+ *
+ * @param[in] uplo
+ *          - BblasUpper: A is upper trapezoidal;
+ *          - BblasLower: A is lower trapezoidal.
+ *
+ * @param[in] diag
+ *          - BblasNonUnit: A has a non-unit diagonal;
+ *          - BblasUnit:    A has a unit diagonal.
+ *
+ * @param[in] m
+ *          The number of rows of A. m >= 0.
+ *
+ * @param[in] n
+ *          The number of columns of A. n >= 0.
+ *
+ * @param[in] A
+ *          The m-by-n trapezoidal matrix A.
+ *
+ * @param[in] lda
+ *          The leading dimension of A. lda >= max(1, m).
+ *
+ * @param[out] work
+ *          Workspace of m elements if norm = BblasInfNorm; not referenced
+ *          otherwise.
+ *
+ * @return The norm of A, 0 if m or n is 0.
+ *
+ ******************************************************************************/
+double core_zlantr(bblas_enum_t norm, bblas_enum_t uplo, bblas_enum_t diag,
+                   bblas_int m, bblas_int n,
+                   const bblas_complex64_t *A, bblas_int lda,
+                   double *work)
+{
+	double value = 0.0;
+	if (m == 0 || n == 0)
+		return value;
+
+	bool unit = diag == BblasUnit;
+	bblas_int k = imin(m, n);
+
+	switch (norm) {
+	case BblasMaxNorm:
+		if (unit)
+			value = 1.0;
+		for (bblas_int j = 0; j < n; j++) {
+			const bblas_complex64_t *aj = &A[(size_t)lda*j];
+			bblas_int first, last;
+			trapezoid_rows(uplo, unit, m, j, &first, &last);
+			for (bblas_int i = first; i < last; i++) {
+				double a = cabs(aj[i]);
+				if (value < a || isnan(a))
+					value = a;
+			}
+		}
+		break;
+
+	case BblasOneNorm:
+		for (bblas_int j = 0; j < n; j++) {
+			const bblas_complex64_t *aj = &A[(size_t)lda*j];
+			bblas_int first, last;
+			trapezoid_rows(uplo, unit, m, j, &first, &last);
+			double sum = (unit && j < k) ? 1.0 : 0.0;
+			for (bblas_int i = first; i < last; i++)
+				sum += cabs(aj[i]);
+			if (value < sum || isnan(sum))
+				value = sum;
+		}
+		break;
+
+	case BblasInfNorm:
+		for (bblas_int i = 0; i < m; i++)
+			work[i] = (unit && i < k) ? 1.0 : 0.0;
+		for (bblas_int j = 0; j < n; j++) {
+			const bblas_complex64_t *aj = &A[(size_t)lda*j];
+			bblas_int first, last;
+			trapezoid_rows(uplo, unit, m, j, &first, &last);
+			for (bblas_int i = first; i < last; i++)
+				work[i] += cabs(aj[i]);
+		}
+		for (bblas_int i = 0; i < m; i++) {
+			if (value < work[i] || isnan(work[i]))
+				value = work[i];
+		}
+		break;
+
+	case BblasFrobeniusNorm: {
+		double scale = unit ? 1.0 : 0.0;
+		double sumsq = unit ? (double)k : 1.0;
+		for (bblas_int j = 0; j < n; j++) {
+			bblas_int first, last;
+			trapezoid_rows(uplo, unit, m, j, &first, &last);
+			if (first < last)
+				core_zlassq(last-first, &A[(size_t)lda*j + first],
+				            &scale, &sumsq);
+		}
+		value = scale*sqrt(sumsq);
+		break;
+	}
+
+	default:
+		break;
+	}
+	return value;
+}
@@ -0,0 +1,118 @@
+/**
+ *
+ * @file
+ *
+ *  BBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+
+#include "bblas.h"
+
+/***************************************************************************//**
+ *
+ * @ingroup core_batched_blas
+ *
+ *  Applies the block reflector H = I - V T V^H, or its conjugate
+ *  transpose H^H, to the m-by-n matrix C,
+ *
+ *    \f[ C = op( H ) \times C \f] or \f[ C = C \times op( H ), \f]
+ *
+ *  as LAPACK zlarfb, but with the reflectors expanded into the explicit
+ *  V by core_zlarf_expand. Applying from the left is
+ *  C -= V (op( T ) (V^H C)), two gemm and a trmm with the k-by-n
+ *  workspace W; from the right, C -= ((C V) op( T )) V^H.
+ *
+ *******************************************************************************
+ *
+ * @param[in] layout
+ *          The storage of the matrices, BblasColMajor or BblasRowMajor.
+ *
+ * @param[in] side
+ *          - BblasLeft:  C = op( H ) C, V is m-by-k;
+ *          - BblasRight: C = C op( H ), V is n-by-k.
+ *
+ * @param[in] trans
+ *          - BblasNoTrans:    op( H ) = H;
+ *          - Bblas_ConjTrans: op( H ) = H^H.
+ *
+ * @param[in] direct
+ *          - BblasForward:  T is upper triangular;
+ *          - BblasBackward: T is lower triangular.
+ *
+ * @param[in] m, n
+ *          The dimensions of C. m, n >= 0.
+ *
+ * @param[in] k
+ *          The order of T. k >= 0.
+ *
+ * @param[in] V
+ *          The expanded reflectors.
+ *
+ * @param[in] ldv
+ *          The leading dimension of V.
+ *
+ * @param[in] T
+ *          The k-by-k triangular factor of the block reflector.
+ *
+ * @param[in] ldt
+ *          The leading dimension of T. ldt >= max(1, k).
+ *
+ * @param[in,out] C
+ *          The m-by-n matrix C.
+ *
+ * @param[in] ldc
+ *          The leading dimension of C.
+ *
+ * @param[out] W
+ *          Workspace of k*n elements if side = BblasLeft, m*k otherwise.
+ *
+ ******************************************************************************/
+void core_zlarfb(bblas_enum_t layout, bblas_enum_t side, bblas_enum_t trans,
+                 bblas_enum_t direct,
+                 bblas_int m, bblas_int n, bblas_int k,
+                 const bblas_complex64_t *V, bblas_int ldv,
+                 const bblas_complex64_t *T, bblas_int ldt,
+                 bblas_complex64_t *C, bblas_int ldc,
+                 bblas_complex64_t *W)
+{
+	if (m == 0 || n == 0 || k == 0)
+		return;
+
+	const bblas_complex64_t zone  =  1.0;
+	const bblas_complex64_t zmone = -1.0;
+	const bblas_complex64_t zzero =  0.0;
+	bblas_enum_t uplo = (direct == BblasForward) ? BblasUpper : BblasLower;
+
+	if (side == BblasLeft) {
+		// W = V^H C, k-by-n
+		bblas_int ldw = (layout == BblasColMajor) ? k : n;
+		cblas_zgemm(layout, BblasConjTrans, BblasNoTrans, k, n, m,
+		            CBLAS_SADDR(zone),  V, ldv,
+		                                C, ldc,
+		            CBLAS_SADDR(zzero), W, ldw);
+		cblas_ztrmm(layout, BblasLeft, uplo, trans, BblasNonUnit, k, n,
+		            CBLAS_SADDR(zone), T, ldt, W, ldw);
+		cblas_zgemm(layout, BblasNoTrans, BblasNoTrans, m, n, k,
+		            CBLAS_SADDR(zmone), V, ldv,
+		                                W, ldw,
+		            CBLAS_SADDR(zone),  C, ldc);
+	}
+	else {
+		// W = C V, m-by-k
+		bblas_int ldw = (layout == BblasColMajor) ? m : k;
+		cblas_zgemm(layout, BblasNoTrans, BblasNoTrans, m, k, n,
+		            CBLAS_SADDR(zone),  C, ldc,
+		                                V, ldv,
+		            CBLAS_SADDR(zzero), W, ldw);
+		cblas_ztrmm(layout, BblasRight, uplo, trans, BblasNonUnit, m, k,
+		            CBLAS_SADDR(zone), T, ldt, W, ldw);
+		cblas_zgemm(layout, BblasNoTrans, BblasConjTrans, m, n, k,
+		            CBLAS_SADDR(zmone), W, ldw,
+		                                V, ldv,
+		            CBLAS_SADDR(zone),  C, ldc);
+	}
+}
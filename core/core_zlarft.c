@@ -0,0 +1,189 @@
+/**
+ *
+ * @file
+ *
+ *  BBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+
+#include "bblas.h"
+
+#define COMPLEX
+
+/******************************************************************************/
+// Offset of element (r, c) of a matrix with leading dimension ld.
+static inline size_t elem(bblas_enum_t layout, bblas_int ld,
+                          bblas_int r, bblas_int c)
+{
+	return (layout == BblasColMajor) ? (size_t)ld*c + r : (size_t)ld*r + c;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_batched_blas
+ *
+ *  Expands the k elementary reflectors stored in V, as by LAPACK zlarft,
+ *  into the explicit nv-by-k matrix W whose columns are the vectors v(i)
+ *  of the reflectors H(i) = I - tau(i) v(i) v(i)^H, with their unit
+ *  elements and zeros set, so that the block reflector is
+ *
+ *    \f[ H = I - W T W^H \f]
+ *
+ *  for either storev, and core_zlarft and core_zlarfb only need
+ *  matrix products instead of a case per direct and storev.
+ *
+ *******************************************************************************
+ *
+ * @param[in] layout
+ *          The storage of V and W, BblasColMajor or BblasRowMajor.
+ *
+ * @param[in] direct
+ *          - BblasForward:  v(i) has a unit element i and zeros above;
+ *          - BblasBackward: v(i) has a unit element nv-k+i and zeros below.
+ *
+ * @param[in] storev
+ *          - BblasColumnwise: v(i) is column i of the nv-by-k V;
+ *          - BblasRowwise:    v(i)^H is row i of the k-by-nv V.
+ *
+ * @param[in] nv
+ *          The order of the reflectors. nv >= k.
+ *
+ * @param[in] k
+ *          The number of reflectors. k >= 0.
+ *
+ * @param[in] V
+ *          The reflectors. The unit elements and zeros are not read.
+ *
+ * @param[in] ldv
+ *          The leading dimension of V.
+ *
+ * @param[out] W
+ *          The nv-by-k matrix of the vectors.
+ *
+ * @param[in] ldw
+ *          The leading dimension of W.
+ *
+ ******************************************************************************/
+void core_zlarf_expand(bblas_enum_t layout, bblas_enum_t direct,
+                       bblas_enum_t storev, bblas_int nv, bblas_int k,
+                       const bblas_complex64_t *V, bblas_int ldv,
+                       bblas_complex64_t *W, bblas_int ldw)
+{
+	for (bblas_int i = 0; i < k; i++) {
+		// Row of the unit element of v(i).
+		bblas_int one = (direct == BblasForward) ? i : nv-k+i;
+		for (bblas_int r = 0; r < nv; r++) {
+			bblas_complex64_t v;
+			if (r == one)
+				v = 1.0;
+			else if ((direct == BblasForward) ? r < one : r > one)
+				v = 0.0;
+			else if (storev == BblasColumnwise)
+				v = V[elem(layout, ldv, r, i)];
+			else
+				v = conj(V[elem(layout, ldv, i, r)]);
+			W[elem(layout, ldw, r, i)] = v;
+		}
+	}
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_batched_blas
+ *
+ *  Forms the k-by-k triangular factor T of the block reflector
+ *  H = I - W T W^H of the reflectors expanded by core_zlarf_expand, as
+ *  LAPACK zlarft: H = H(0) H(1) .. H(k-1) and T is upper triangular if
+ *  direct = BblasForward, H = H(k-1) .. H(1) H(0) and T is lower
+ *  triangular if direct = BblasBackward. A column of T costs a gemv with
+ *  the reflectors before it and a trmv with the part of T already formed.
+ *
+ *******************************************************************************
+ *
+ * @param[in] layout
+ *          The storage of W and T, BblasColMajor or BblasRowMajor.
+ *
+ * @param[in] direct
+ *          BblasForward or BblasBackward, as for core_zlarf_expand.
+ *
+ * @param[in] nv
+ *          The order of the reflectors. nv >= k.
+ *
+ * @param[in] k
+ *          The number of reflectors. k >= 0.
+ *
+ * @param[in] W
+ *          The nv-by-k matrix of the vectors of the reflectors.
+ *
+ * @param[in] ldw
+ *          The leading dimension of W.
+ *
+ * @param[in] tau
+ *          The k scalar factors of the reflectors.
+ *
+ * @param[out] T
+ *          The k-by-k triangular factor. Its other triangle is not
+ *          referenced.
+ *
+ * @param[in] ldt
+ *          The leading dimension of T. ldt >= max(1, k).
+ *
+ ******************************************************************************/
+void core_zlarft(bblas_enum_t layout, bblas_enum_t direct,
+                 bblas_int nv, bblas_int k,
+                 const bblas_complex64_t *W, bblas_int ldw,
+                 const bblas_complex64_t *tau,
+                 bblas_complex64_t *T, bblas_int ldt)
+{
+	const bblas_complex64_t zzero = 0.0;
+	// Distances between consecutive elements of a column.
+	bblas_int incw = (layout == BblasColMajor) ? 1 : ldw;
+	bblas_int inct = (layout == BblasColMajor) ? 1 : ldt;
+
+	if (direct == BblasForward) {
+		for (bblas_int i = 0; i < k; i++) {
+			if (tau[i] == (bblas_complex64_t)0.0) {
+				// H(i) = I
+				for (bblas_int r = 0; r < i; r++)
+					T[elem(layout, ldt, r, i)] = 0.0;
+			}
+			else if (i > 0) {
+				// T(0:i-1, i) = T(0:i-1, 0:i-1) (-tau(i) W(:, 0:i-1)^H W(:, i))
+				bblas_complex64_t mtau = -tau[i];
+				cblas_zgemv(layout, BblasConjTrans, nv, i,
+				            CBLAS_SADDR(mtau), W, ldw,
+				                               W+elem(layout, ldw, 0, i), incw,
+				            CBLAS_SADDR(zzero), T+elem(layout, ldt, 0, i), inct);
+				cblas_ztrmv(layout, BblasUpper, BblasNoTrans, BblasNonUnit,
+				            i, T, ldt, T+elem(layout, ldt, 0, i), inct);
+			}
+			T[elem(layout, ldt, i, i)] = tau[i];
+		}
+	}
+	else {
+		for (bblas_int i = k-1; i >= 0; i--) {
+			if (tau[i] == (bblas_complex64_t)0.0) {
+				// H(i) = I
+				for (bblas_int r = i+1; r < k; r++)
+					T[elem(layout, ldt, r, i)] = 0.0;
+			}
+			else if (i < k-1) {
+				// T(i+1:k-1, i) = T(i+1:k-1, i+1:k-1)
+				//                 (-tau(i) W(:, i+1:k-1)^H W(:, i))
+				bblas_complex64_t mtau = -tau[i];
+				cblas_zgemv(layout, BblasConjTrans, nv, k-1-i,
+				            CBLAS_SADDR(mtau), W+elem(layout, ldw, 0, i+1), ldw,
+				                               W+elem(layout, ldw, 0, i), incw,
+				            CBLAS_SADDR(zzero), T+elem(layout, ldt, i+1, i), inct);
+				cblas_ztrmv(layout, BblasLower, BblasNoTrans, BblasNonUnit,
+				            k-1-i, T+elem(layout, ldt, i+1, i+1), ldt,
+				            T+elem(layout, ldt, i+1, i), inct);
+			}
+			T[elem(layout, ldt, i, i)] = tau[i];
+		}
+	}
+}
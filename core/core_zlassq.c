@@ -0,0 +1,107 @@
+/**
+ *
+ * @file
+ *
+ *  BBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+
+#include "bblas.h"
+
+#include <math.h>
+
+#define COMPLEX
+
+/***************************************************************************//**
+ *
+ * @ingroup core_batched_blas
+ *
+ *  Updates the scaled sum of squares of the contiguous vector x, as LAPACK
+ *  zlassq,
+ *
+ *    \f[ scale^2 \times sumsq = scale^2 \times sumsq + \sum |x(i)|^2, \f]
+ *
+ *  where the real and imaginary parts count as separate elements. The
+ *  vector is swept twice, for the largest element and then for the sum of
+ *  squares scaled by it, so that both loops vectorize and no square
+ *  overflows or underflows. As LAPACK, a NaN in x sets sumsq to NaN,
+ *  which no later call changes, and otherwise an infinity in x sets
+ *  scale to infinity.
+ *
+ *******************************************************************************
+ *
+ * @param[in] n
+ *          The number of elements of x. n >= 0.
+ *
+ * @param[in] x
+ *          The vector x.
+ *
+ * @param[in,out] scale
+ *          On entry, the scale of the sum so far, initially 0. On exit,
+ *          the largest of its entry value and the magnitudes of the parts
+ *          of x.
+ *
+ * @param[in,out] sumsq
+ *          On entry, the scaled sum so far, initially 1. On exit, the
+ *          updated sum, scaled by the exit value of scale.
+ *
+ ******************************************************************************/
+void core_zlassq(bblas_int n, const bblas_complex64_t *x,
+                 double *scale, double *sumsq)
+{
+	// A NaN sum stays so.
+	if (isnan(*sumsq))
+		return;
+
+	// The comparisons skip NaNs, which are looked for separately.
+	double amax = 0.0;
+	bool nan = false;
+	for (bblas_int i = 0; i < n; i++) {
+#ifdef COMPLEX
+		double re = fabs(creal(x[i]));
+		double im = fabs(cimag(x[i]));
+		if (amax < re)
+			amax = re;
+		if (amax < im)
+			amax = im;
+		nan |= isnan(re) || isnan(im);
+#else
+		double a = fabs(x[i]);
+		if (amax < a)
+			amax = a;
+		nan |= isnan(a);
+#endif
+	}
+	if (nan) {
+		*sumsq = NAN;
+		return;
+	}
+	if (amax == 0.0)
+		return;
+	if (isinf(amax)) {
+		*scale = amax;
+		*sumsq = 1.0;
+		return;
+	}
+
+	if (*scale < amax) {
+		*sumsq *= (*scale/amax)*(*scale/amax);
+		*scale = amax;
+	}
+	double sum = 0.0;
+	for (bblas_int i = 0; i < n; i++) {
+#ifdef COMPLEX
+		double re = creal(x[i])/(*scale);
+		double im = cimag(x[i])/(*scale);
+		sum += re*re + im*im;
+#else
+		double a = x[i]/(*scale);
+		sum += a*a;
+#endif
+	}
+	*sumsq += sum;
+}
@@ -0,0 +1,121 @@
+/**
+ *
+ * @file
+ *
+ *  BBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+
+#include "bblas.h"
+
+#define COMPLEX
+
+/***************************************************************************//**
+ *
+ * @ingroup core_batched_blas
+ *
+ *  Solves lanes Hermitian positive definite tridiagonal systems
+ *  A[l] X[l] = B[l] at once, by the factorization A[l] = L[l] D[l] L[l]^H
+ *  as LAPACK zptsv, on interleaved operands: element k of the vectors of
+ *  system l is at index k*inct + l, and element (k, j) of B[l] at
+ *  k*incb + j*ldb + l. As in core_zgtsv_lanes, the innermost loops run
+ *  across the systems, with one system per vector lane; no pivoting is
+ *  needed.
+ *
+ *******************************************************************************
+ *
+ * @param[in] lanes
+ *          The number of systems. lanes >= 0.
+ *
+ * @param[in] n
+ *          The order of the matrices A[l]. n >= 0.
+ *
+ * @param[in] nrhs
+ *          The number of columns of the matrices B[l]. nrhs >= 0.
+ *
+ * @param[in,out] d
+ *          On entry, the n diagonal elements of the A[l].
+ *          On exit, the diagonals of the D[l].
+ *
+ * @param[in,out] e
+ *          On entry, the n-1 sub-diagonal elements of the A[l].
+ *          On exit, the sub-diagonals of the unit bidiagonal L[l].
+ *
+ * @param[in] inct
+ *          The distance between consecutive elements of a system in d
+ *          and e. inct >= lanes.
+ *
+ * @param[in,out] B
+ *          On entry, the right hand sides B[l]; on exit, the solutions X[l].
+ *
+ * @param[in] incb, ldb
+ *          The distances between consecutive rows and columns of B[l].
+ *
+ * @param[out] info
+ *          Array of length lanes; info[l] = 0 if system l was solved, and
+ *          k+1 if the leading minor of order k+1 of A[l] is not positive,
+ *          in which case X[l] is not computed reliably.
+ *
+ ******************************************************************************/
+void core_zptsv_lanes(bblas_int lanes, bblas_int n, bblas_int nrhs,
+                      double *d, bblas_complex64_t *e, bblas_int inct,
+                      bblas_complex64_t *B, bblas_int incb, bblas_int ldb,
+                      bblas_int *info)
+{
+	for (bblas_int l = 0; l < lanes; l++)
+		info[l] = 0;
+	if (n == 0)
+		return;
+
+	// Factorization A = L D L^H.
+	for (bblas_int k = 0; k < n-1; k++) {
+		double *dk  = &d[(size_t)inct*k];
+		double *dk1 = &d[(size_t)inct*(k+1)];
+		bblas_complex64_t *ek = &e[(size_t)inct*k];
+		for (bblas_int l = 0; l < lanes; l++) {
+			info[l] = (info[l] == 0 && !(dk[l] > 0.0)) ? k+1 : info[l];
+			bblas_complex64_t f = ek[l]/dk[l];
+#ifdef COMPLEX
+			dk1[l] -= creal(f)*creal(ek[l]) + cimag(f)*cimag(ek[l]);
+#else
+			dk1[l] -= f*ek[l];
+#endif
+			ek[l] = f;
+		}
+	}
+	double *dn = &d[(size_t)inct*(n-1)];
+	for (bblas_int l = 0; l < lanes; l++)
+		info[l] = (info[l] == 0 && !(dn[l] > 0.0)) ? n : info[l];
+
+	for (bblas_int j = 0; j < nrhs; j++) {
+		bblas_complex64_t *b = &B[(size_t)ldb*j];
+		// Solve L Y = B.
+		for (bblas_int k = 1; k < n; k++) {
+			bblas_complex64_t *bk  = &b[(size_t)incb*k];
+			bblas_complex64_t *bk1 = &b[(size_t)incb*(k-1)];
+			bblas_complex64_t *ek1 = &e[(size_t)inct*(k-1)];
+			for (bblas_int l = 0; l < lanes; l++)
+				bk[l] -= bk1[l]*ek1[l];
+		}
+		// Solve D L^H X = Y.
+		bblas_complex64_t *bn = &b[(size_t)incb*(n-1)];
+		for (bblas_int l = 0; l < lanes; l++)
+			bn[l] /= dn[l];
+		for (bblas_int k = n-2; k >= 0; k--) {
+			bblas_complex64_t *bk  = &b[(size_t)incb*k];
+			bblas_complex64_t *bk1 = &b[(size_t)incb*(k+1)];
+			double *dk = &d[(size_t)inct*k];
+			bblas_complex64_t *ek = &e[(size_t)inct*k];
+			for (bblas_int l = 0; l < lanes; l++)
+#ifdef COMPLEX
+				bk[l] = bk[l]/dk[l] - bk1[l]*conj(ek[l]);
+#else
+				bk[l] = bk[l]/dk[l] - bk1[l]*ek[l];
+#endif
+		}
+	}
+}
@@ -0,0 +1,95 @@
+/**
+ *
+ * @file
+ *
+ *  BBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+
+#include "bblas.h"
+
+#define COMPLEX
+
+/******************************************************************************/
+// Scales the m-by-n matrix C, or its upper or lower triangle, by beta;
+// beta = 0 sets it to zero without reading it, so that NaNs in C are not
+// propagated, as in the reference BLAS.
+void core_zscale(bblas_enum_t layout, bblas_enum_t uplo,
+                 bblas_int m, bblas_int n,
+                 bblas_complex64_t beta, bblas_complex64_t *C, bblas_int ldc)
+{
+	// C in row major is C^T in column major, with the other triangle.
+	if (layout == BblasRowMajor) {
+		bblas_int t = m;
+		m = n;
+		n = t;
+		if (uplo == BblasUpper)
+			uplo = BblasLower;
+		else if (uplo == BblasLower)
+			uplo = BblasUpper;
+	}
+
+	for (bblas_int j = 0; j < n; j++) {
+		bblas_int first = 0;
+		bblas_int last = m;
+		if (uplo == BblasUpper)
+			last = imin(j+1, m);
+		else if (uplo == BblasLower)
+			first = imin(j, m);
+		bblas_complex64_t *c = &C[(size_t)ldc*j];
+		if (beta == (bblas_complex64_t)0.0) {
+			for (bblas_int i = first; i < last; i++)
+				c[i] = 0.0;
+		}
+		else {
+			for (bblas_int i = first; i < last; i++)
+				c[i] *= beta;
+		}
+	}
+}
+
+/******************************************************************************/
+// Computes C[i] := beta*C[i] for a group, or the upper or lower triangles
+// of the C[i], instead of a full gemm-like call per matrix with alpha = 0
+// or k = 0.
+void core_zscale_batch(bblas_int group_size, bblas_enum_t layout, bblas_enum_t uplo,
+                       bblas_int m, bblas_int n,
+                       bblas_complex64_t beta, bblas_complex64_t **C, bblas_int ldc)
+{
+	if (beta == (bblas_complex64_t)1.0)
+		return;
+
+	int dist;
+	bblas_get(BblasTunePrefetch, &dist);
+	for (bblas_int iter = 0; iter < group_size; iter++) {
+		bblas_prefetch_next(iter, dist, group_size, layout, m, n,
+		                    (const void *const *)C, ldc,
+		                    sizeof(bblas_complex64_t), true);
+		core_zscale(layout, uplo, m, n, beta, C[iter], ldc);
+	}
+}
+
+#ifdef COMPLEX
+/******************************************************************************/
+// As core_zscale_batch for the n-by-n Hermitian C[i] of herk and her2k,
+// whose diagonal is made real, as in the reference BLAS.
+void core_zscale_herm_batch(bblas_int group_size, bblas_enum_t layout, bblas_enum_t uplo,
+                            bblas_int n, double beta, bblas_complex64_t **C, bblas_int ldc)
+{
+	if (beta == 1.0)
+		return;
+
+	core_zscale_batch(group_size, layout, uplo, n, n,
+	                  (bblas_complex64_t)beta, C, ldc);
+	for (bblas_int iter = 0; iter < group_size; iter++) {
+		for (bblas_int j = 0; j < n; j++) {
+			bblas_complex64_t *c = &C[iter][(size_t)ldc*j + j];
+			*c = creal(*c);
+		}
+	}
+}
+#endif
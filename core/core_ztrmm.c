@@ -0,0 +1,248 @@
+/**
+ *
+ * @file
+ *
+ *  BBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+
+#include "bblas.h"
+
+#include <stdbool.h>
+
+#define COMPLEX
+
+/******************************************************************************/
+// Element (i, l) of op( A ) for a column major A.
+static inline bblas_complex64_t op_a(bblas_enum_t transa,
+                                     const bblas_complex64_t *A, bblas_int lda,
+                                     bblas_int i, bblas_int l)
+{
+	if (transa == BblasNoTrans)
+		return A[(size_t)lda*l + i];
+#ifdef COMPLEX
+	if (transa == BblasConjTrans)
+		return conj(A[(size_t)lda*i + l]);
+#endif
+	return A[(size_t)lda*i + l];
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_batched_blas
+ *
+ *  Native triangular matrix-matrix multiply for small matrices,
+ *
+ *          \f[C = \alpha [op( A ) \times B] \f], if side = BblasLeft  or
+ *          \f[C = \alpha [B \times op( A )] \f], if side = BblasRight.
+ *
+ *  C may be the same array as B (with ldc = ldb), in which case B is
+ *  overwritten in place as in cblas_ztrmm. Otherwise B is left unchanged.
+ *  The entries of C are computed in an order such that every entry of B
+ *  is read before the corresponding entry of C is written, so no
+ *  workspace is needed in either case.
+ *
+ *  The kernel is meant for matrices that fit in the L1 cache; larger
+ *  matrices should go through CBLAS.
+ *
+ *******************************************************************************
+ *
+ * @param[in] layout, side, uplo, transa, diag, m, n, alpha, A, lda
+ *          As in blas_ztrmm_batchf.
+ *
+ * @param[in] B
+ *          The m-by-n matrix B.
+ *
+ * @param[in] ldb
+ *          The leading dimension of B.
+ *
+ * @param[out] C
+ *          On exit, the m-by-n matrix alpha*op( A )*B or alpha*B*op( A ).
+ *          May be the same array as B if ldc = ldb.
+ *
+ * @param[in] ldc
+ *          The leading dimension of C.
+ *
+ ******************************************************************************/
+void core_ztrmm(bblas_enum_t layout, bblas_enum_t side, bblas_enum_t uplo,
+                bblas_enum_t transa, bblas_enum_t diag,
+                bblas_int m, bblas_int n,
+                bblas_complex64_t alpha, const bblas_complex64_t *A, bblas_int lda,
+                                         const bblas_complex64_t *B, bblas_int ldb,
+                                               bblas_complex64_t *C, bblas_int ldc)
+{
+	// A row major problem is the column major problem for the transposes,
+	// which swaps side, uplo and the dimensions but keeps transa.
+	if (layout == BblasRowMajor) {
+		side = (side == BblasLeft)  ? BblasRight : BblasLeft;
+		uplo = (uplo == BblasUpper) ? BblasLower : BblasUpper;
+		bblas_int tmp = m;
+		m = n;
+		n = tmp;
+	}
+	bool unit = (diag == BblasUnit);
+
+	// Whether the nonzeros of op( A ) are in its upper triangle.
+	bool upper = ((uplo == BblasUpper) == (transa == BblasNoTrans));
+
+	if (side == BblasLeft) {
+		for (bblas_int j = 0; j < n; j++) {
+			const bblas_complex64_t *b = &B[(size_t)ldb*j];
+			bblas_complex64_t       *c = &C[(size_t)ldc*j];
+			if (upper) {
+				// c[i] only needs b[i:m-1]: sweep down.
+				for (bblas_int i = 0; i < m; i++) {
+					bblas_complex64_t sum =
+						unit ? b[i] : op_a(transa, A, lda, i, i)*b[i];
+					for (bblas_int l = i+1; l < m; l++)
+						sum += op_a(transa, A, lda, i, l)*b[l];
+					c[i] = alpha*sum;
+				}
+			}
+			else {
+				// c[i] only needs b[0:i]: sweep up.
+				for (bblas_int i = m-1; i >= 0; i--) {
+					bblas_complex64_t sum =
+						unit ? b[i] : op_a(transa, A, lda, i, i)*b[i];
+					for (bblas_int l = 0; l < i; l++)
+						sum += op_a(transa, A, lda, i, l)*b[l];
+					c[i] = alpha*sum;
+				}
+			}
+		}
+	}
+	else {
+		// Column j of C needs columns l of B where op( A )(l, j) != 0,
+		// i.e., l <= j if upper, l >= j if lower.
+		for (bblas_int jj = 0; jj < n; jj++) {
+			bblas_int j = upper ? n-1-jj : jj;
+			const bblas_complex64_t *bj = &B[(size_t)ldb*j];
+			bblas_complex64_t       *c  = &C[(size_t)ldc*j];
+			bblas_complex64_t temp =
+				unit ? alpha : alpha*op_a(transa, A, lda, j, j);
+			for (bblas_int i = 0; i < m; i++)
+				c[i] = temp*bj[i];
+
+			bblas_int lbeg = upper ? 0 : j+1;
+			bblas_int lend = upper ? j : n;
+			for (bblas_int l = lbeg; l < lend; l++) {
+				temp = alpha*op_a(transa, A, lda, l, j);
+				if (temp != (bblas_complex64_t)0.0) {
+					const bblas_complex64_t *bl = &B[(size_t)ldb*l];
+					for (bblas_int i = 0; i < m; i++)
+						c[i] += temp*bl[i];
+				}
+			}
+		}
+	}
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_batched_blas
+ *
+ *  Variant of core_ztrmm for aligned operands, which the batchf routines
+ *  call when a whole group qualifies:
+ *
+ *  - B and C (and A, if side = BblasLeft) start on a BBLAS_SIMD_ALIGN
+ *    boundary and their leading dimensions keep every column on one,
+ *  - the columns are a whole number of vectors long: m (n in row major)
+ *    is a multiple of BBLAS_SIMD_ALIGN/sizeof(bblas_complex64_t).
+ *
+ *  Every column of C is then computed by axpys on whole aligned columns
+ *  of B (and of A), which the compiler vectorises with aligned loads and
+ *  stores and without remainder loops. For side = BblasLeft, this needs
+ *  op( A ) = A; the other cases go to core_ztrmm.
+ *
+ *******************************************************************************
+ *
+ * @param[in] layout, side, uplo, transa, diag, m, n, alpha, A, lda,
+ *            B, ldb, C, ldc
+ *          As in core_ztrmm, aligned as above.
+ *
+ ******************************************************************************/
+void core_ztrmm_aligned(bblas_enum_t layout, bblas_enum_t side, bblas_enum_t uplo,
+                        bblas_enum_t transa, bblas_enum_t diag,
+                        bblas_int m, bblas_int n,
+                        bblas_complex64_t alpha, const bblas_complex64_t *A, bblas_int lda,
+                                                 const bblas_complex64_t *B, bblas_int ldb,
+                                                       bblas_complex64_t *C, bblas_int ldc)
+{
+	if (layout == BblasRowMajor) {
+		side = (side == BblasLeft)  ? BblasRight : BblasLeft;
+		uplo = (uplo == BblasUpper) ? BblasLower : BblasUpper;
+		bblas_int tmp = m;
+		m = n;
+		n = tmp;
+	}
+	if (side == BblasLeft && transa != BblasNoTrans) {
+		core_ztrmm(BblasColMajor, side, uplo, transa, diag,
+		           m, n, alpha, A, lda, B, ldb, C, ldc);
+		return;
+	}
+	bool unit = (diag == BblasUnit);
+	bool upper = ((uplo == BblasUpper) == (transa == BblasNoTrans));
+
+	if (side == BblasLeft) {
+		// Column j of C = alpha*A*b is the sum of the columns k of A,
+		// scaled by alpha*b[k]. Each b[k] is read before c[k] is written,
+		// and c[i] is only updated after it has been set, so that C may
+		// be B.
+		for (bblas_int j = 0; j < n; j++) {
+			const bblas_complex64_t *b =
+				BBLAS_ASSUME_ALIGNED(&B[(size_t)ldb*j]);
+			bblas_complex64_t *c =
+				BBLAS_ASSUME_ALIGNED(&C[(size_t)ldc*j]);
+			if (upper) {
+				for (bblas_int k = 0; k < m; k++) {
+					const bblas_complex64_t *a =
+						BBLAS_ASSUME_ALIGNED(&A[(size_t)lda*k]);
+					bblas_complex64_t temp = alpha*b[k];
+					for (bblas_int i = 0; i < k; i++)
+						c[i] += temp*a[i];
+					c[k] = unit ? temp : temp*a[k];
+				}
+			}
+			else {
+				for (bblas_int k = m-1; k >= 0; k--) {
+					const bblas_complex64_t *a =
+						BBLAS_ASSUME_ALIGNED(&A[(size_t)lda*k]);
+					bblas_complex64_t temp = alpha*b[k];
+					c[k] = unit ? temp : temp*a[k];
+					for (bblas_int i = k+1; i < m; i++)
+						c[i] += temp*a[i];
+				}
+			}
+		}
+	}
+	else {
+		// As in core_ztrmm, on whole aligned columns.
+		for (bblas_int jj = 0; jj < n; jj++) {
+			bblas_int j = upper ? n-1-jj : jj;
+			const bblas_complex64_t *bj =
+				BBLAS_ASSUME_ALIGNED(&B[(size_t)ldb*j]);
+			bblas_complex64_t *c =
+				BBLAS_ASSUME_ALIGNED(&C[(size_t)ldc*j]);
+			bblas_complex64_t temp =
+				unit ? alpha : alpha*op_a(transa, A, lda, j, j);
+			for (bblas_int i = 0; i < m; i++)
+				c[i] = temp*bj[i];
+
+			bblas_int lbeg = upper ? 0 : j+1;
+			bblas_int lend = upper ? j : n;
+			for (bblas_int l = lbeg; l < lend; l++) {
+				temp = alpha*op_a(transa, A, lda, l, j);
+				if (temp != (bblas_complex64_t)0.0) {
+					const bblas_complex64_t *bl =
+						BBLAS_ASSUME_ALIGNED(&B[(size_t)ldb*l]);
+					for (bblas_int i = 0; i < m; i++)
+						c[i] += temp*bl[i];
+				}
+			}
+		}
+	}
+}
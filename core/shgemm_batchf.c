@@ -0,0 +1,231 @@
+/**
+ *
+ * @file
+ *
+ *  BBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions half sh -> sb
+ *
+ **/
+
+#include "bblas.h"
+
+#include <stdlib.h>
+
+/******************************************************************************/
+// Converts the rows-by-cols fp16 matrix A, stored in the given layout, to
+// the contiguous float array W and returns the leading dimension of W in
+// that same layout.
+static bblas_int upcast(bblas_enum_t layout, bblas_int rows, bblas_int cols,
+                  const bblas_half_t *A, bblas_int lda, float *W)
+{
+	if (layout == BblasRowMajor) {
+		bblas_int tmp = rows;
+		rows = cols;
+		cols = tmp;
+	}
+	for (bblas_int j = 0; j < cols; j++)
+		for (bblas_int i = 0; i < rows; i++)
+			W[(size_t)rows*j + i] = bblas_h2s(A[(size_t)lda*j + i]);
+
+	return imax(1, rows);
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup gemm_mixed_batchf
+ *
+ * shgemm_batchf is a mixed precision batch version of sgemm. It performs
+ * the matrix-matrix multiplications
+ *
+ *  \f[ C[i] = \alpha [op( A[i] )\times op( B[i] )] + \beta C[i], \f]
+ *
+ *  where A[i] and B[i] are fp16 numbers, while alpha, beta and C[i] are
+ *  in single precision and the products are accumulated in single precision.
+ *  Each A[i] and B[i] is converted to single precision in a workspace just
+ *  before it is used, so the operands are read from memory at half the width
+ *  of blas_sgemm_batchf.
+ *
+ *  Since the conversion is exact, the result is the same as calling
+ *  blas_sgemm_batchf on the single precision copies of A[i] and B[i].
+ *
+ *******************************************************************************
+ *
+ * @param[in] group_size, layout, transa, transb, m, n, k, alpha
+ *          As in blas_sgemm_batchf.
+ *
+ * @param[in] A
+ *          Array of pointers to the fp16 matrices A[i].
+ *          Dimensions as in blas_sgemm_batchf.
+ *
+ * @param[in] lda
+ *          The leading dimension of the arrays A[i].
+ *
+ * @param[in] B
+ *          Array of pointers to the fp16 matrices B[i].
+ *          Dimensions as in blas_sgemm_batchf.
+ *
+ * @param[in] ldb
+ *          The leading dimension of the arrays B[i].
+ *
+ * @param[in] beta, C, ldc
+ *          As in blas_sgemm_batchf.
+ *
+ * @param[in,out] info
+ *          As in blas_sgemm_batchf. If the workspace cannot be allocated,
+ *          the matrices of the group get BblasErrorOutOfMemory.
+ *
+ *******************************************************************************
+ *
+ * @sa shgemm_batchf
+ * @sa sbgemm_batchf
+ *
+ ******************************************************************************/
+void blas_shgemm_batchf(bblas_int group_size, bblas_enum_t layout, bblas_enum_t transa,
+                        bblas_enum_t transb, bblas_int m, bblas_int n, bblas_int k,
+                        float alpha, bblas_half_t const *const *A, bblas_int lda,
+                                     bblas_half_t const *const *B, bblas_int ldb,
+                        float beta,  float                   **C, bblas_int ldc,
+                        bblas_int *info)
+{
+	// Check input arguments
+	if ((layout != BblasRowMajor) &&
+        (layout != BblasColMajor)) {
+		bblas_error("Illegal value of layout");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 1);
+		}
+		return;
+	}
+	if ((transa != BblasNoTrans) &&
+        (transa != BblasTrans) &&
+        (transa != BblasConjTrans)) {
+		bblas_error("Illegal value of transa");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 2);
+		}
+		return;
+	}
+	if ((transb != BblasNoTrans) &&
+        (transb != BblasTrans) &&
+        (transb != BblasConjTrans)) {
+		bblas_error("Illegal value of transb");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 3);
+		}
+		return;
+	}
+	if (m < 0) {
+		bblas_error("Illegal value of m");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 4);
+		}
+		return;
+	}
+	if (n < 0) {
+		bblas_error("Illegal value of n");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 5);
+		}
+		return;
+	}
+	if (k < 0) {
+		bblas_error("Illegal value of k");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 6);
+		}
+		return;
+	}
+
+	// Stored dimensions of A[i] and B[i] in column major.
+	bblas_int am = (transa == BblasNoTrans) ? m : k;
+	bblas_int an = (transa == BblasNoTrans) ? k : m;
+	bblas_int bm = (transb == BblasNoTrans) ? k : n;
+	bblas_int bn = (transb == BblasNoTrans) ? n : k;
+	bblas_int cm = m;
+	if (layout == BblasRowMajor) {
+		am = an;
+		bm = bn;
+		cm = n;
+	}
+
+	if (lda < imax(1, am)) {
+		bblas_error("Illegal value of lda");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 7);
+		}
+		return;
+	}
+	if (ldb < imax(1, bm)) {
+		bblas_error("Illegal value of ldb");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 8);
+		}
+		return;
+	}
+	if (ldc < imax(1, cm)) {
+		bblas_error("Illegal value of ldc");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 9);
+		}
+		return;
+	}
+
+	// With alpha = 0 or k = 0, only C[i] := beta*C[i] is left to do.
+	if (alpha == 0.0f || k == 0) {
+		core_sscale_batch(group_size, layout, BblasGeneral, m, n,
+		                  beta, C, ldc);
+		// BblasSuccess
+		if (info[0] == BblasErrorsReportAll) {
+			for (bblas_int iter = 0; iter < group_size; iter++)
+				info[iter] = 0;
+		}
+		else {
+			info[0] = 0;
+		}
+		return;
+	}
+
+	// One workspace for the group, reused by every matrix, so that
+	// the converted operands stay in cache.
+	size_t asize = (size_t)m*k;
+	size_t bsize = (size_t)k*n;
+	float *W = (float*)malloc((asize+bsize+1)*sizeof(float));
+	if (W == NULL) {
+		bblas_error("malloc() failed");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size,
+			               BblasErrorOutOfMemory);
+		}
+		return;
+	}
+	float *WA = W;
+	float *WB = W+asize;
+
+	for (bblas_int iter = 0; iter < group_size; iter++) {
+		bblas_int ldwa = upcast(layout,
+		                  (transa == BblasNoTrans) ? m : k,
+		                  (transa == BblasNoTrans) ? k : m,
+		                  A[iter], lda, WA);
+		bblas_int ldwb = upcast(layout,
+		                  (transb == BblasNoTrans) ? k : n,
+		                  (transb == BblasNoTrans) ? n : k,
+		                  B[iter], ldb, WB);
+
+		cblas_sgemm(layout, transa, transb,
+                    m, n, k,
+                    alpha, WA, ldwa,
+                           WB, ldwb,
+                    beta,  C[iter], ldc);
+		// BblasSuccess
+		if (info[0] == BblasErrorsReportAll)
+			info[iter] = 0;
+	}
+	free(W);
+
+	// BblasSuccess
+	if (info[0] != BblasErrorsReportAll)
+		info[0] = 0;
+}
@@ -0,0 +1,201 @@
+/**
+ *
+ * @file
+ *
+ *  BBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions realcomplex dz -> sc
+ *
+ **/
+
+#include "bblas.h"
+
+#include <stdlib.h>
+
+/***************************************************************************//**
+ *
+ * @ingroup gemm_realcomplex_batchf
+ *
+ * zdgemm_batchf is a batch version of zgemm for a real B. It performs
+ * the matrix-matrix multiplications
+ *
+ *  \f[ C[i] = \alpha [op( A[i] )\times op( B[i] )] + \beta C[i], \f]
+ *
+ *  where B[i] are real matrices and A[i] and C[i] are complex matrices.
+ *  B[i] is never promoted to complex; each product costs about half the
+ *  flops of the complex product. See core_zdgemm.
+ *
+ *******************************************************************************
+ *
+ * @param[in] group_size, layout, transa, transb, m, n, k, alpha
+ *          As in blas_zgemm_batchf.
+ *
+ * @param[in] A
+ *          Array of pointers to the complex matrices A[i].
+ *          Dimensions as in blas_zgemm_batchf.
+ *
+ * @param[in] lda
+ *          The leading dimension of the arrays A[i].
+ *
+ * @param[in] B
+ *          Array of pointers to the real matrices B[i].
+ *          Dimensions as in blas_zgemm_batchf.
+ *
+ * @param[in] ldb
+ *          The leading dimension of the arrays B[i].
+ *
+ * @param[in] beta, C, ldc
+ *          As in blas_zgemm_batchf.
+ *
+ * @param[in,out] info
+ *          As in blas_zgemm_batchf. If the workspace cannot be allocated,
+ *          the matrices of the group get BblasErrorOutOfMemory.
+ *
+ *******************************************************************************
+ *
+ * @sa zdgemm_batchf
+ * @sa csgemm_batchf
+ *
+ ******************************************************************************/
+void blas_zdgemm_batchf(bblas_int group_size, bblas_enum_t layout, bblas_enum_t transa,
+                        bblas_enum_t transb, bblas_int m, bblas_int n, bblas_int k,
+                        bblas_complex64_t alpha, bblas_complex64_t const *const *A, bblas_int lda,
+                                                 double            const *const *B, bblas_int ldb,
+                        bblas_complex64_t beta,  bblas_complex64_t             **C, bblas_int ldc,
+                        bblas_int *info)
+{
+	// Check input arguments
+	if ((layout != BblasRowMajor) &&
+        (layout != BblasColMajor)) {
+		bblas_error("Illegal value of layout");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 1);
+		}
+		return;
+	}
+	if ((transa != BblasNoTrans) &&
+        (transa != BblasTrans) &&
+        (transa != BblasConjTrans)) {
+		bblas_error("Illegal value of transa");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 2);
+		}
+		return;
+	}
+	if ((transb != BblasNoTrans) &&
+        (transb != BblasTrans) &&
+        (transb != BblasConjTrans)) {
+		bblas_error("Illegal value of transb");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 3);
+		}
+		return;
+	}
+	if (m < 0) {
+		bblas_error("Illegal value of m");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 4);
+		}
+		return;
+	}
+	if (n < 0) {
+		bblas_error("Illegal value of n");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 5);
+		}
+		return;
+	}
+	if (k < 0) {
+		bblas_error("Illegal value of k");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 6);
+		}
+		return;
+	}
+
+	// Stored dimensions of A[i] and B[i] in column major.
+	bblas_int am = (transa == BblasNoTrans) ? m : k;
+	bblas_int an = (transa == BblasNoTrans) ? k : m;
+	bblas_int bm = (transb == BblasNoTrans) ? k : n;
+	bblas_int bn = (transb == BblasNoTrans) ? n : k;
+	bblas_int cm = m;
+	if (layout == BblasRowMajor) {
+		am = an;
+		bm = bn;
+		cm = n;
+	}
+
+	if (lda < imax(1, am)) {
+		bblas_error("Illegal value of lda");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 7);
+		}
+		return;
+	}
+	if (ldb < imax(1, bm)) {
+		bblas_error("Illegal value of ldb");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 8);
+		}
+		return;
+	}
+	if (ldc < imax(1, cm)) {
+		bblas_error("Illegal value of ldc");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 9);
+		}
+		return;
+	}
+
+	// With alpha = 0 or k = 0, only C[i] := beta*C[i] is left to do.
+	if (alpha == (bblas_complex64_t)0.0 || k == 0) {
+		core_zscale_batch(group_size, layout, BblasGeneral, m, n,
+		                  beta, C, ldc);
+		// BblasSuccess
+		if (info[0] == BblasErrorsReportAll) {
+			for (bblas_int iter = 0; iter < group_size; iter++)
+				info[iter] = 0;
+		}
+		else {
+			info[0] = 0;
+		}
+		return;
+	}
+
+	// One workspace for the group, reused by every matrix.
+	double *W = (double*)malloc(
+		(2*((size_t)m*k + (size_t)k*n + (size_t)m*n) + 1)*sizeof(double));
+	if (W == NULL) {
+		bblas_error("malloc() failed");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size,
+			               BblasErrorOutOfMemory);
+		}
+		return;
+	}
+
+	for (bblas_int iter = 0; iter < group_size; iter++) {
+		// A row major product is the column major product of the
+		// transposes in reverse order, with the real operand on the left.
+		if (layout == BblasColMajor)
+			core_zdgemm(transa, transb, m, n, k,
+			            alpha, A[iter], lda,
+			                   B[iter], ldb,
+			            beta,  C[iter], ldc, W);
+		else
+			core_dzgemm(transb, transa, n, m, k,
+			            alpha, B[iter], ldb,
+			                   A[iter], lda,
+			            beta,  C[iter], ldc, W);
+		// BblasSuccess
+		if (info[0] == BblasErrorsReportAll)
+			info[iter] = 0;
+	}
+	free(W);
+
+	// BblasSuccess
+	if (info[0] != BblasErrorsReportAll)
+		info[0] = 0;
+}
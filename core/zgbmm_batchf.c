@@ -0,0 +1,276 @@
+/**
+ *
+ * @file
+ *
+ *  BBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+
+#include "bblas.h"
+
+
+/***************************************************************************//**
+ *
+ * @ingroup gbmm_batchf
+ *
+ *  Performs the batch matrix-matrix operations
+ *
+ *    \f[ C[i] = \alpha [op( A[i] ) \times B[i]] + \beta C[i], \f]
+ *
+ *  where op( A[i] ) is one of
+ *    \f[ op( A[i] ) = A[i],   \f]
+ *    \f[ op( A[i] ) = A[i]^T, \f]
+ *    \f[ op( A[i] ) = A[i]^H, \f]
+ *
+ *  alpha and beta are scalars, op( A[i] ) is an m-by-k band matrix with kl
+ *  sub-diagonals and ku super-diagonals (as A[i], before op), B[i] is a
+ *  k-by-n matrix and C[i] an m-by-n matrix. Only the bands of the A[i] are
+ *  stored and read.
+ *
+ *  In column major, the A[i] are in LAPACK band storage and the products
+ *  are computed by a native kernel whose inner loops run down the columns
+ *  of the band. In row major, the A[i] are in the row major band storage
+ *  of CBLAS, and the products go through cblas_zgbmv, one column of B[i]
+ *  at a time.
+ *
+ *******************************************************************************
+ *
+ * @param[in] group_size
+ * 	    The number of matrices to operate on.
+ *
+ * @param[in] layout
+ * 	    Specifies if the matrix is stored in row major or column major
+ * 	    format:
+ * 	    - BblasRowMajor: Row major format
+ * 	    - BblasColMajor: Column major format
+ *
+ * @param[in] transa
+ *          Specifies whether the matrices A[i] are transposed, not transposed or
+ *          conjugate transposed:
+ *          - BblasNoTrans:   A[i]-s are not transposed;
+ *          - BblasTrans:     A[i]-s are transposed;
+ *          - BblasConjTrans: A[i]-s are conjugate transposed.
+ *
+ * @param[in] m
+ *          The number of rows of the matrices op( A[i] ) and C[i].
+ *          m >= 0.
+ *
+ * @param[in] n
+ *          The number of columns of the matrices B[i] and C[i].
+ *          n >= 0.
+ *
+ * @param[in] k
+ *          The number of columns of the matrices op( A[i] ) and the number
+ *          of rows of the matrices B[i]. k >= 0.
+ *
+ * @param[in] kl
+ *          The number of sub-diagonals of the matrices A[i]. kl >= 0.
+ *
+ * @param[in] ku
+ *          The number of super-diagonals of the matrices A[i]. ku >= 0.
+ *
+ * @param[in] alpha
+ *          The scalar alpha.
+ *
+ * @param[in] A
+ * 	    A is an array of pointers to matrices A[0], A[1] .. A[group_size-1],
+ * 	    where each A[i] holds the band of an am-by-ak matrix, where am = m
+ * 	    and ak = k if transa = BblasNoTrans, and am = k and ak = m
+ * 	    otherwise. In column major, element (r, c) of the matrix is
+ * 	    A[i][ku+r-c + lda*c]; in row major, it is A[i][kl+c-r + lda*r].
+ *
+ * @param[in] lda
+ *          The leading dimension of the arrays A[i]. lda >= kl+ku+1.
+ *
+ * @param[in] B
+ * 	    B is an array of pointers to matrices B[0], B[1] .. B[group_size-1],
+ * 	    where each B[i] is a k-by-n matrix.
+ *
+ * @param[in] ldb
+ *          The leading dimension of the arrays B[i]. ldb >= max(1, k) in
+ *          column major and ldb >= max(1, n) in row major.
+ *
+ * @param[in] beta
+ *          The scalar beta.
+ *
+ * @param[in,out] C
+ * 	    C is an array of pointers to matrices C[0], C[1] .. C[group_size-1],
+ * 	    where each C[i] is an m-by-n matrix. On exit, overwritten by
+ * 	    alpha*op( A[i] )*B[i] + beta*C[i].
+ *
+ * @param[in] ldc
+ *          The leading dimension of the arrays C[i]. ldc >= max(1, m) in
+ *          column major and ldc >= max(1, n) in row major.
+ *
+ * @param[in,out] info
+ * 		Array of bblas_int for error handling. On entry info[0] should have one of the
+ * 		following values
+ *			- BblasErrorsReportAll    :  All errors will be specified on output.
+ *						     Length of the array should be atleast
+ *						     group_size.
+ *			- BblasErrorsReportGroup  :  Single error from each group will be
+ *						     reported. Length of the array should
+ *						     be atleast 1.
+ *			- BblasErrorsReportAny    :  Occurence of an error will be indicated
+ *						     by a single integer value, and length
+ *						     of the array should be atleast 1.
+ *			- BblasErrorsReportNone   :  No error will be reported on output, and
+ *						     length of the array should be atleast 1.
+ ******************************************************************************
+ *
+ * @retval BblasSuccess successful exit
+ *
+ *******************************************************************************
+ *
+ * @sa zgbmm_batchf
+ * @sa cgbmm_batchf
+ * @sa dgbmm_batchf
+ * @sa sgbmm_batchf
+ *
+ ******************************************************************************/
+void blas_zgbmm_batchf(bblas_int group_size, bblas_enum_t layout, bblas_enum_t transa,
+                       bblas_int m, bblas_int n, bblas_int k,
+                       bblas_int kl, bblas_int ku,
+                       bblas_complex64_t alpha, bblas_complex64_t const *const *A, bblas_int lda,
+                                                bblas_complex64_t const* const *B, bblas_int ldb,
+                       bblas_complex64_t beta,  bblas_complex64_t            ** C, bblas_int ldc,
+                       bblas_int *info)
+{
+	// Check input arguments
+	if ((layout != BblasRowMajor) &&
+	    (layout != BblasColMajor)) {
+		bblas_error("Illegal value of layout");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 1);
+		}
+		return;
+	}
+	if ((transa != BblasNoTrans) &&
+	    (transa != BblasTrans) &&
+	    (transa != BblasConjTrans)) {
+		bblas_error("Illegal value of transa");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 2);
+		}
+		return;
+	}
+	if (m < 0) {
+		bblas_error("Illegal value of m");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 3);
+		}
+		return;
+	}
+	if (n < 0) {
+		bblas_error("Illegal value of n");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 4);
+		}
+		return;
+	}
+	if (k < 0) {
+		bblas_error("Illegal value of k");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 5);
+		}
+		return;
+	}
+	if (kl < 0) {
+		bblas_error("Illegal value of kl");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 6);
+		}
+		return;
+	}
+	if (ku < 0) {
+		bblas_error("Illegal value of ku");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 7);
+		}
+		return;
+	}
+	if (lda < kl+ku+1) {
+		bblas_error("Illegal value of lda");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 8);
+		}
+		return;
+	}
+	// Stored dimensions of B[i] and C[i].
+	bblas_int bm = (layout == BblasColMajor) ? k : n;
+	bblas_int cm = (layout == BblasColMajor) ? m : n;
+	if (ldb < imax(1, bm)) {
+		bblas_error("Illegal value of ldb");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 9);
+		}
+		return;
+	}
+	if (ldc < imax(1, cm)) {
+		bblas_error("Illegal value of ldc");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 10);
+		}
+		return;
+	}
+	// With alpha = 0 or k = 0, only C[i] := beta*C[i] is left to do.
+	if (alpha == (bblas_complex64_t)0.0 || k == 0) {
+		core_zscale_batch(group_size, layout, BblasGeneral, m, n,
+		                  beta, C, ldc);
+		// BblasSuccess
+		if (info[0] == BblasErrorsReportAll) {
+			for (bblas_int iter = 0; iter < group_size; iter++)
+				info[iter] = 0;
+		}
+		else {
+			info[0] = 0;
+		}
+		return;
+	}
+	// Stored dimensions of A[i]; the band of A[i] is kl+ku+1 by ak in
+	// column major and am by kl+ku+1 in row major.
+	bblas_int am = (transa == BblasNoTrans) ? m : k;
+	bblas_int ak = (transa == BblasNoTrans) ? k : m;
+	bblas_int bands = (layout == BblasColMajor) ? ak : am;
+	// Operands of the next matrices are prefetched while computing
+	// the current one.
+	int dist;
+	bblas_get(BblasTunePrefetch, &dist);
+	for (bblas_int iter = 0; iter < group_size; iter++) {
+		bblas_prefetch_next(iter, dist, group_size, BblasColMajor,
+		                    kl+ku+1, bands,
+		                    (const void *const *)A, lda,
+		                    sizeof(bblas_complex64_t), false);
+		bblas_prefetch_next(iter, dist, group_size, layout, k, n,
+		                    (const void *const *)B, ldb,
+		                    sizeof(bblas_complex64_t), false);
+		bblas_prefetch_next(iter, dist, group_size, layout, m, n,
+		                    (const void *const *)C, ldc,
+		                    sizeof(bblas_complex64_t), true);
+		if (layout == BblasColMajor) {
+			core_zgbmm(transa, m, n, k, kl, ku,
+			           alpha, A[iter], lda,
+			                  B[iter], ldb,
+			           beta,  C[iter], ldc);
+		}
+		else {
+			for (bblas_int j = 0; j < n; j++) {
+				cblas_zgbmv(layout, transa,
+				            am, ak, kl, ku,
+				            CBLAS_SADDR(alpha), A[iter], lda,
+				                                B[iter]+j, ldb,
+				            CBLAS_SADDR(beta),  C[iter]+j, ldc);
+			}
+		}
+		// BblasSuccess
+		if (info[0] == BblasErrorsReportAll)
+			info[iter] = 0;
+	}
+	// BblasSuccess
+	if (info[0] != BblasErrorsReportAll)
+		info[0] = 0;
+}
@@ -0,0 +1,230 @@
+/**
+ *
+ * @file
+ *
+ *  BBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+
+#include "bblas.h"
+
+
+/***************************************************************************//**
+ *
+ * @ingroup gbmv_batchf
+ *
+ *  Performs the batch matrix-vector operations
+ *
+ *    \f[ y[i] = \alpha op( A[i] ) \times x[i] + \beta y[i], \f]
+ *
+ *  where op( A[i] ) is one of
+ *    \f[ op( A[i] ) = A[i],   \f]
+ *    \f[ op( A[i] ) = A[i]^T, \f]
+ *    \f[ op( A[i] ) = A[i]^H, \f]
+ *
+ *  alpha and beta are scalars, A[i] is an m-by-n band matrix with kl
+ *  sub-diagonals and ku super-diagonals, of which only the band is stored,
+ *  and x[i] and y[i] are vectors.
+ *
+ *  In column major, with unit increments, the products are computed by the
+ *  native band kernel of gbmm; otherwise they go through cblas_zgbmv.
+ *
+ *******************************************************************************
+ *
+ * @param[in] group_size
+ * 	    The number of matrices to operate on.
+ *
+ * @param[in] layout
+ * 	    Specifies if the matrix is stored in row major or column major
+ * 	    format:
+ * 	    - BblasRowMajor: Row major format
+ * 	    - BblasColMajor: Column major format
+ *
+ * @param[in] trans
+ *          Specifies whether the matrices A[i] are transposed, not transposed or
+ *          conjugate transposed:
+ *          - BblasNoTrans:   A[i]-s are not transposed;
+ *          - BblasTrans:     A[i]-s are transposed;
+ *          - BblasConjTrans: A[i]-s are conjugate transposed.
+ *
+ * @param[in] m
+ *          The number of rows of the matrices A[i]. m >= 0.
+ *
+ * @param[in] n
+ *          The number of columns of the matrices A[i]. n >= 0.
+ *
+ * @param[in] kl
+ *          The number of sub-diagonals of the matrices A[i]. kl >= 0.
+ *
+ * @param[in] ku
+ *          The number of super-diagonals of the matrices A[i]. ku >= 0.
+ *
+ * @param[in] alpha
+ *          The scalar alpha.
+ *
+ * @param[in] A
+ * 	    A is an array of pointers to matrices A[0], A[1] .. A[group_size-1],
+ * 	    where each A[i] holds the band of an m-by-n matrix. In column
+ * 	    major, in LAPACK band storage, element (r, c) of the matrix is
+ * 	    A[i][ku+r-c + lda*c]; in row major, in the band storage of CBLAS,
+ * 	    it is A[i][kl+c-r + lda*r].
+ *
+ * @param[in] lda
+ *          The leading dimension of the arrays A[i]. lda >= kl+ku+1.
+ *
+ * @param[in] x
+ * 	    x is an array of pointers to vectors x[0], x[1] .. x[group_size-1],
+ * 	    of length n if trans = BblasNoTrans and m otherwise.
+ *
+ * @param[in] incx
+ *          The increment of the elements of the vectors x[i]. incx != 0.
+ *
+ * @param[in] beta
+ *          The scalar beta.
+ *
+ * @param[in,out] y
+ * 	    y is an array of pointers to vectors y[0], y[1] .. y[group_size-1],
+ * 	    of length m if trans = BblasNoTrans and n otherwise. On exit,
+ * 	    overwritten by alpha*op( A[i] )*x[i] + beta*y[i].
+ *
+ * @param[in] incy
+ *          The increment of the elements of the vectors y[i]. incy != 0.
+ *
+ * @param[in,out] info
+ * 		Array of bblas_int for error handling. On entry info[0] should have one of the
+ * 		following values
+ *			- BblasErrorsReportAll    :  All errors will be specified on output.
+ *						     Length of the array should be atleast
+ *						     group_size.
+ *			- BblasErrorsReportGroup  :  Single error from each group will be
+ *						     reported. Length of the array should
+ *						     be atleast 1.
+ *			- BblasErrorsReportAny    :  Occurence of an error will be indicated
+ *						     by a single integer value, and length
+ *						     of the array should be atleast 1.
+ *			- BblasErrorsReportNone   :  No error will be reported on output, and
+ *						     length of the array should be atleast 1.
+ ******************************************************************************
+ *
+ * @retval BblasSuccess successful exit
+ *
+ *******************************************************************************
+ *
+ * @sa zgbmv_batchf
+ * @sa cgbmv_batchf
+ * @sa dgbmv_batchf
+ * @sa sgbmv_batchf
+ *
+ ******************************************************************************/
+void blas_zgbmv_batchf(bblas_int group_size, bblas_enum_t layout, bblas_enum_t trans,
+                       bblas_int m, bblas_int n, bblas_int kl, bblas_int ku,
+                       bblas_complex64_t alpha, bblas_complex64_t const *const *A, bblas_int lda,
+                                                bblas_complex64_t const *const *x, bblas_int incx,
+                       bblas_complex64_t beta,  bblas_complex64_t            **y, bblas_int incy,
+                       bblas_int *info)
+{
+	// Check input arguments
+	if ((layout != BblasRowMajor) &&
+	    (layout != BblasColMajor)) {
+		bblas_error("Illegal value of layout");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 1);
+		}
+		return;
+	}
+	if ((trans != BblasNoTrans) &&
+	    (trans != BblasTrans) &&
+	    (trans != BblasConjTrans)) {
+		bblas_error("Illegal value of trans");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 2);
+		}
+		return;
+	}
+	if (m < 0) {
+		bblas_error("Illegal value of m");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 3);
+		}
+		return;
+	}
+	if (n < 0) {
+		bblas_error("Illegal value of n");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 4);
+		}
+		return;
+	}
+	if (kl < 0) {
+		bblas_error("Illegal value of kl");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 5);
+		}
+		return;
+	}
+	if (ku < 0) {
+		bblas_error("Illegal value of ku");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 6);
+		}
+		return;
+	}
+	if (lda < kl+ku+1) {
+		bblas_error("Illegal value of lda");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 7);
+		}
+		return;
+	}
+	if (incx == 0) {
+		bblas_error("Illegal value of incx");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 8);
+		}
+		return;
+	}
+	if (incy == 0) {
+		bblas_error("Illegal value of incy");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 9);
+		}
+		return;
+	}
+	// Lengths of op( A[i] )*x[i] and x[i].
+	bblas_int ym = (trans == BblasNoTrans) ? m : n;
+	bblas_int xm = (trans == BblasNoTrans) ? n : m;
+	bool native = layout == BblasColMajor && incx == 1 && incy == 1;
+	// Operands of the next matrices are prefetched while computing
+	// the current one.
+	int dist;
+	bblas_get(BblasTunePrefetch, &dist);
+	for (bblas_int iter = 0; iter < group_size; iter++) {
+		bblas_prefetch_next(iter, dist, group_size, BblasColMajor,
+		                    kl+ku+1, (layout == BblasColMajor) ? n : m,
+		                    (const void *const *)A, lda,
+		                    sizeof(bblas_complex64_t), false);
+		if (native) {
+			core_zgbmm(trans, ym, 1, xm, kl, ku,
+			           alpha, A[iter], lda,
+			                  x[iter], imax(1, xm),
+			           beta,  y[iter], imax(1, ym));
+		}
+		else {
+			cblas_zgbmv(layout, trans,
+			            m, n, kl, ku,
+			            CBLAS_SADDR(alpha), A[iter], lda,
+			                                x[iter], incx,
+			            CBLAS_SADDR(beta),  y[iter], incy);
+		}
+		// BblasSuccess
+		if (info[0] == BblasErrorsReportAll)
+			info[iter] = 0;
+	}
+	// BblasSuccess
+	if (info[0] != BblasErrorsReportAll)
+		info[0] = 0;
+}
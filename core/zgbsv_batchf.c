@@ -0,0 +1,202 @@
+/**
+ *
+ * @file
+ *
+ *  BBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+
+#include "bblas.h"
+
+
+/***************************************************************************//**
+ *
+ * @ingroup gbsv_batchf
+ *
+ *  Solves the batch of linear systems
+ *
+ *    \f[ A[i] \times X[i] = B[i], \f]
+ *
+ *  where A[i] is an n-by-n band matrix with kl sub-diagonals and ku
+ *  super-diagonals and X[i] and B[i] are n-by-nrhs matrices, by the LU
+ *  factorization with partial pivoting of the band, A[i] = P[i] L[i] U[i],
+ *  as LAPACK zgbsv. U[i] has kl+ku super-diagonals, for the fill-in of the
+ *  pivoting, so that the factorization costs O(n*kl*(kl+ku)) instead of
+ *  O(n^3) for the dense A[i].
+ *
+ *******************************************************************************
+ *
+ * @param[in] group_size
+ * 	    The number of matrices to operate on.
+ *
+ * @param[in] layout
+ * 	    Specifies if the matrix is stored in row major or column major
+ * 	    format:
+ * 	    - BblasRowMajor: Row major format
+ * 	    - BblasColMajor: Column major format
+ *
+ * @param[in] n
+ *          The order of the matrices A[i]. n >= 0.
+ *
+ * @param[in] kl
+ *          The number of sub-diagonals of the matrices A[i]. kl >= 0.
+ *
+ * @param[in] ku
+ *          The number of super-diagonals of the matrices A[i]. ku >= 0.
+ *
+ * @param[in] nrhs
+ *          The number of columns of the matrices B[i]. nrhs >= 0.
+ *
+ * @param[in,out] A
+ * 	    A is an array of pointers to matrices A[0], A[1] .. A[group_size-1].
+ * 	    On entry, each A[i] holds an n-by-n band matrix in rows kl to
+ * 	    2*kl+ku of the LAPACK band storage, with 2*kl+ku+1 rows and n
+ * 	    columns: element (r, c) of the matrix is A[i][kl+ku+r-c + lda*c].
+ * 	    In row major, the same array is stored row by row, as by
+ * 	    LAPACKE_zgbsv. Rows 0 to kl-1 need not be set.
+ * 	    On exit, the factors L[i] and U[i], as by LAPACK zgbsv.
+ *
+ * @param[in] lda
+ *          The leading dimension of the arrays A[i]. lda >= 2*kl+ku+1 in
+ *          column major and lda >= max(1, n) in row major.
+ *
+ * @param[out] ipiv
+ * 	    ipiv is an array of pointers to arrays ipiv[0] .. ipiv[group_size-1]
+ * 	    of length n, the pivot indices of the factorizations: row j of
+ * 	    A[i] was interchanged with row ipiv[i][j]-1.
+ *
+ * @param[in,out] B
+ * 	    B is an array of pointers to matrices B[0], B[1] .. B[group_size-1].
+ * 	    On entry, each B[i] is an n-by-nrhs right hand side matrix.
+ * 	    On exit, the solution X[i], unless A[i] is singular.
+ *
+ * @param[in] ldb
+ *          The leading dimension of the arrays B[i]. ldb >= max(1, n) in
+ *          column major and ldb >= max(1, nrhs) in row major.
+ *
+ * @param[in,out] info
+ * 		Array of bblas_int for error handling. On entry info[0] should have one of the
+ * 		following values
+ *			- BblasErrorsReportAll    :  All errors will be specified on output.
+ *						     Length of the array should be atleast
+ *						     group_size.
+ *			- BblasErrorsReportGroup  :  Single error from each group will be
+ *						     reported. Length of the array should
+ *						     be atleast 1.
+ *			- BblasErrorsReportAny    :  Occurence of an error will be indicated
+ *						     by a single integer value, and length
+ *						     of the array should be atleast 1.
+ *			- BblasErrorsReportNone   :  No error will be reported on output, and
+ *						     length of the array should be atleast 1.
+ *		A matrix A[i] whose factor U[i] is exactly singular is reported
+ *		as BblasErrorSingular; its factorization is completed, but
+ *		B[i] is left as it is.
+ ******************************************************************************
+ *
+ * @retval BblasSuccess successful exit
+ *
+ *******************************************************************************
+ *
+ * @sa zgbsv_batchf
+ * @sa cgbsv_batchf
+ * @sa dgbsv_batchf
+ * @sa sgbsv_batchf
+ *
+ ******************************************************************************/
+void blas_zgbsv_batchf(bblas_int group_size, bblas_enum_t layout,
+                       bblas_int n, bblas_int kl, bblas_int ku, bblas_int nrhs,
+                       bblas_complex64_t **A, bblas_int lda, bblas_int **ipiv,
+                       bblas_complex64_t **B, bblas_int ldb,
+                       bblas_int *info)
+{
+	// Check input arguments
+	if ((layout != BblasRowMajor) &&
+	    (layout != BblasColMajor)) {
+		bblas_error("Illegal value of layout");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 1);
+		}
+		return;
+	}
+	if (n < 0) {
+		bblas_error("Illegal value of n");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 2);
+		}
+		return;
+	}
+	if (kl < 0) {
+		bblas_error("Illegal value of kl");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 3);
+		}
+		return;
+	}
+	if (ku < 0) {
+		bblas_error("Illegal value of ku");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 4);
+		}
+		return;
+	}
+	if (nrhs < 0) {
+		bblas_error("Illegal value of nrhs");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 5);
+		}
+		return;
+	}
+	if ((layout == BblasColMajor && lda < 2*kl+ku+1) ||
+	    (layout == BblasRowMajor && lda < imax(1, n))) {
+		bblas_error("Illegal value of lda");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 6);
+		}
+		return;
+	}
+	if (ldb < imax(1, (layout == BblasColMajor) ? n : nrhs)) {
+		bblas_error("Illegal value of ldb");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 7);
+		}
+		return;
+	}
+
+	// Operands of the next matrices are prefetched while computing
+	// the current one.
+	int dist;
+	bblas_get(BblasTunePrefetch, &dist);
+	// info[0] is also the error of A[0] if all errors are reported.
+	bblas_int info_option = info[0];
+	bblas_int error = 0;
+	for (bblas_int iter = 0; iter < group_size; iter++) {
+		bblas_prefetch_next(iter, dist, group_size, layout,
+		                    2*kl+ku+1, n,
+		                    (const void *const *)A, lda,
+		                    sizeof(bblas_complex64_t), true);
+		bblas_prefetch_next(iter, dist, group_size, layout, n, nrhs,
+		                    (const void *const *)B, ldb,
+		                    sizeof(bblas_complex64_t), true);
+		// bblas_int has the width of lapack_int, as checked in core.h.
+		lapack_int ret = LAPACKE_zgbsv_work(layout, n, kl, ku, nrhs,
+		                                    A[iter], lda,
+		                                    (lapack_int*)ipiv[iter],
+		                                    B[iter], ldb);
+		bblas_int code = BblasSuccess;
+		if (ret > 0)
+			code = BblasErrorSingular;
+		else if (ret == LAPACK_WORK_MEMORY_ERROR)
+			code = BblasErrorOutOfMemory;
+		if (info_option == BblasErrorsReportAll)
+			info[iter] = code;
+		else if (error == 0)
+			error = code;
+	}
+	// BblasSuccess, or the first error of the group
+	if (info_option != BblasErrorsReportAll)
+		info[0] = (info_option == BblasErrorsReportNone) ? 0 : error;
+}
@@ -12,6 +12,8 @@
 
 #include "bblas.h"
 
+#include <stdlib.h>
+
 /***************************************************************************//**
  *
  * @ingroup gemm_batchf
@@ -26,10 +28,27 @@
  *    \f[ op( X ) = X,   \f]
  *    \f[ op( X ) = X^T, \f]
  *    \f[ op( X ) = X^H, \f]
+ *    \f[ op( X ) = \bar{X}, \f]
  *
  *  alpha and beta are scalars, and A[i], B[i] and C[i] are matrices, with 
  *  op( A[i] ) an m-by-k matrix, op( B[i] ) a k-by-n matrix and C[i] an m-by-n matrix.
  *
+ *  BLAS has no conjugation without transposition, so an operand with
+ *  BblasConjNoTrans is conjugated into a workspace one matrix at a time,
+ *  while it stays in cache, or, by the 3M algorithm, while it is split
+ *  into real and imaginary parts.
+ *
+ *  In complex precisions, after bblas_set(BblasTuneGemm3M, 1), groups with
+ *  m, n and k of at least BBLAS_GEMM_3M_MIN use the 3M algorithm, which
+ *  saves 25% of the flops at some cost in accuracy; see core_zgemm3m.
+ *
+ *  With beta = 0, after bblas_set(BblasTuneStream, 1), C[i] is not read and
+ *  is written with non-temporal stores; see bblas_stream.
+ *
+ *  If all A[i] or all B[i] are the same matrix, the group is computed by
+ *  one wide gemm, or by a few if the other operands are not stored side by
+ *  side; see core_zgemm_shared.
+ *
  *******************************************************************************i
  * @param[in] group_size
  * 	    The number of matrices to operate on
@@ -43,12 +62,14 @@
  * @param[in] transa
  *          - BblasNoTrans:   A[i] is not transposed,
  *          - BblasTrans:     A[i] is transposed,
- *          - BblasConjTrans: A[i] is conjugate transposed.
+ *          - BblasConjTrans: A[i] is conjugate transposed,
+ *          - BblasConjNoTrans: A[i] is conjugated, not transposed.
  *
  * @param[in] transb
  *          - BblasNoTrans:   B[i] is not transposed,
  *          - BblasTrans:     B[i] is transposed,
- *          - BblasConjTrans: B[i] is conjugate transposed.
+ *          - BblasConjTrans: B[i] is conjugate transposed,
+ *          - BblasConjNoTrans: B[i] is conjugated, not transposed.
  *
  * @param[in] m
  *          The number of rows of the matrix op( A[i] ) and of the matrix C[i].
@@ -106,7 +127,7 @@
  *          The leading dimension of the array C[i]. ldc >= max(1,m).
  *
  * @param[in,out] info
- * 		Array of int for error handling. On entry info[0] should have one of the 
+ * 		Array of bblas_int for error handling. On entry info[0] should have one of the 
  * 		following values
  *			- BblasErrorsReportAll    :  All errors will be specified on output.
  *						     Length of the array should be atleast
@@ -130,12 +151,12 @@
  * @sa sgemm_batchf
  *
  ******************************************************************************/
-void blas_zgemm_batchf(int group_size, bblas_enum_t layout, bblas_enum_t transa,
-                       bblas_enum_t transb, int m, int n, int k,
-                       bblas_complex64_t alpha, bblas_complex64_t const *const *A, int lda,
-                                                bblas_complex64_t const* const *B, int ldb,
-                       bblas_complex64_t beta,  bblas_complex64_t            ** C, int ldc,
-                       int *info)
+void blas_zgemm_batchf(bblas_int group_size, bblas_enum_t layout, bblas_enum_t transa,
+                       bblas_enum_t transb, bblas_int m, bblas_int n, bblas_int k,
+                       bblas_complex64_t alpha, bblas_complex64_t const *const *A, bblas_int lda,
+                                                bblas_complex64_t const* const *B, bblas_int ldb,
+                       bblas_complex64_t beta,  bblas_complex64_t            ** C, bblas_int ldc,
+                       bblas_int *info)
 {
 	// Check input arguments 
 	if ((layout != BblasRowMajor) &&
@@ -148,7 +169,8 @@ void blas_zgemm_batchf(int group_size, bblas_enum_t layout, bblas_enum_t transa,
 	}
 	if ((transa != BblasNoTrans) &&
         (transa != BblasTrans) &&
-        (transa != BblasConjTrans)) {
+        (transa != BblasConjTrans) &&
+        (transa != BblasConjNoTrans)) {
 		bblas_error("Illegal value of transa");
 		if (info[0] != BblasErrorsReportNone) {
 			bblas_set_info(info[0], &info[0], group_size, 2);
@@ -157,25 +179,14 @@ void blas_zgemm_batchf(int group_size, bblas_enum_t layout, bblas_enum_t transa,
 	}
 	if ((transb != BblasNoTrans) &&
         (transb != BblasTrans) &&
-        (transb != BblasConjTrans)) {
+        (transb != BblasConjTrans) &&
+        (transb != BblasConjNoTrans)) {
 		bblas_error("Illegal value of transb");
 		if (info[0] != BblasErrorsReportNone) {
 			bblas_set_info(info[0], &info[0], group_size, 3);
 		}
 		return;
 	}
-	if ( transa == BblasNoTrans ) { 
-		lda = m;
-	} 
-	else { 
-		lda = k;
-	}
-	if ( transb == BblasNoTrans ) { 
-		ldb = k;
-	} 
-	else { 
-		ldb = n;
-	}
 	if (m < 0) {
 		bblas_error("Illegal value of m");
 		if (info[0] != BblasErrorsReportNone) {
@@ -197,37 +208,141 @@ void blas_zgemm_batchf(int group_size, bblas_enum_t layout, bblas_enum_t transa,
 		}
 		return;
 	}
-	if (lda < imax(1, lda)) {
+	// Stored dimensions of A[i], B[i] and C[i].
+	bblas_int am = bblas_transposed(transa) ? k : m;
+	bblas_int bm = bblas_transposed(transb) ? n : k;
+	bblas_int cm = m;
+	if (layout == BblasRowMajor) {
+		am = bblas_transposed(transa) ? m : k;
+		bm = bblas_transposed(transb) ? k : n;
+		cm = n;
+	}
+	if (lda < imax(1, am)) {
 		bblas_error("Illegal value of lda");
 		if (info[0] != BblasErrorsReportNone) {
 			bblas_set_info(info[0], &info[0], group_size, 7);
 		}
 		return;
 	}
-	if (ldb < imax(1, ldb)) {
+	if (ldb < imax(1, bm)) {
 		bblas_error("Illegal value of ldb");
 		if (info[0] != BblasErrorsReportNone) {
 			bblas_set_info(info[0], &info[0], group_size, 8);
 		}
 		return;
 	}
-	if (ldc < imax(1, m)) {
+	if (ldc < imax(1, cm)) {
 		bblas_error("Illegal value of ldc");
 		if (info[0] != BblasErrorsReportNone) {
 			bblas_set_info(info[0], &info[0], group_size, 9);
 		}
 		return;
 	}
-	for (int iter = 0; iter < group_size; iter++) {
-		cblas_zgemm(layout, transa, transb,
-                    m, n, k,
-                    CBLAS_SADDR(alpha), A[iter], lda,
-                                        B[iter], ldb,
-                    CBLAS_SADDR(beta),  C[iter], ldc);
+
+	// With alpha = 0 or k = 0, only C[i] := beta*C[i] is left to do.
+	if (alpha == (bblas_complex64_t)0.0 || k == 0) {
+		core_zscale_batch(group_size, layout, BblasGeneral, m, n,
+		                  beta, C, ldc);
+		// BblasSuccess
+		if (info[0] == BblasErrorsReportAll) {
+			for (bblas_int iter = 0; iter < group_size; iter++)
+				info[iter] = 0;
+		}
+		else {
+			info[0] = 0;
+		}
+		return;
+	}
+
+	// Whether C[i] is to be streamed; see below.
+	int stream;
+	bblas_get(BblasTuneStream, &stream);
+	stream = stream && beta == (bblas_complex64_t)0.0;
+
+	// A group with a shared A or B is better done as a few wide gemms.
+	if (!stream &&
+	    core_zgemm_shared(group_size, layout, transa, transb,
+	                      m, n, k,
+	                      alpha, A, lda,
+	                             B, ldb,
+	                      beta,  C, ldc)) {
+		// BblasSuccess
+		if (info[0] == BblasErrorsReportAll) {
+			for (bblas_int iter = 0; iter < group_size; iter++)
+				info[iter] = 0;
+		}
+		else {
+			info[0] = 0;
+		}
+		return;
+	}
+
+	// Workspace of the 3M algorithm, if enabled and worthwhile,
+	// or for operands conjugated without transposition.
+	double *work;
+	if (!core_zgemm_workspace(transa, transb, m, n, k, &work)) {
+		bblas_error("malloc() failed");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size,
+			               BblasErrorOutOfMemory);
+		}
+		return;
+	}
+
+	// With beta = 0, after bblas_set(BblasTuneStream, 1), each product
+	// goes to a workspace that stays in cache and is streamed to C[i],
+	// which is then never read; without the workspace, C[i] is written
+	// through the cache as usual.
+	bblas_int cr = (layout == BblasColMajor) ? m : n;
+	bblas_int cc = (layout == BblasColMajor) ? n : m;
+	bblas_complex64_t *W = NULL;
+	if (stream)
+		W = (bblas_complex64_t*)malloc(
+			((size_t)cr*cc+1)*sizeof(bblas_complex64_t));
+
+	// Operands of the next matrices are prefetched while computing
+	// the current one.
+	int dist;
+	bblas_get(BblasTunePrefetch, &dist);
+	bblas_int ar = bblas_transposed(transa) ? k : m;
+	bblas_int ac = bblas_transposed(transa) ? m : k;
+	bblas_int br = bblas_transposed(transb) ? n : k;
+	bblas_int bc = bblas_transposed(transb) ? k : n;
+	for (bblas_int iter = 0; iter < group_size; iter++) {
+		bblas_prefetch_next(iter, dist, group_size, layout, ar, ac,
+		                    (const void *const *)A, lda,
+		                    sizeof(bblas_complex64_t), false);
+		bblas_prefetch_next(iter, dist, group_size, layout, br, bc,
+		                    (const void *const *)B, ldb,
+		                    sizeof(bblas_complex64_t), false);
+		if (W != NULL) {
+			core_zgemm(layout, transa, transb,
+			           m, n, k,
+			           alpha, A[iter], lda,
+			                  B[iter], ldb,
+			           beta,  W, imax(1, cr), work);
+			bblas_stream(cr, cc, W, imax(1, cr), C[iter], ldc,
+			             sizeof(bblas_complex64_t));
+		}
+		else {
+			bblas_prefetch_next(iter, dist, group_size, layout, m, n,
+			                    (const void *const *)C, ldc,
+			                    sizeof(bblas_complex64_t), true);
+			core_zgemm(layout, transa, transb,
+			           m, n, k,
+			           alpha, A[iter], lda,
+			                  B[iter], ldb,
+			           beta,  C[iter], ldc, work);
+		}
 		// BblasSuccess
 		if (info[0] == BblasErrorsReportAll)
 			info[iter] = 0;
 	}
+	if (W != NULL)
+		bblas_stream_fence();
+	free(W);
+	free(work);
+
 	// BblasSuccess
 	if (info[0] != BblasErrorsReportAll)
 		info[0] = 0;
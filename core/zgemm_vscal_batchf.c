@@ -0,0 +1,265 @@
+/**
+ *
+ * @file
+ *
+ *  BBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+
+#include "bblas.h"
+
+#include <stdlib.h>
+
+/***************************************************************************//**
+ *
+ * @ingroup gemm_vscal_batchf
+ *
+ * zgemm_vscal_batchf is a batch version of zgemm with one alpha and one beta
+ * per matrix. It performs matrix-matrix multiplication of matrices, where
+ * all the matrices of the batch have a fixed size.
+ *
+ *  \f[ C[i] = \alpha[i] [op( A[i] )\times op( B[i] )] + \beta[i] C[i], \f]
+ *
+ *  where op( X ) is one of:
+ *    \f[ op( X ) = X,   \f]
+ *    \f[ op( X ) = X^T, \f]
+ *    \f[ op( X ) = X^H, \f]
+ *    \f[ op( X ) = \bar{X}, \f]
+ *
+ *  alpha[i] and beta[i] are scalars, and A[i], B[i] and C[i] are matrices, with 
+ *  op( A[i] ) an m-by-k matrix, op( B[i] ) a k-by-n matrix and C[i] an m-by-n matrix.
+ *
+ *  In complex precisions, after bblas_set(BblasTuneGemm3M, 1), groups with
+ *  m, n and k of at least BBLAS_GEMM_3M_MIN use the 3M algorithm, which
+ *  saves 25% of the flops at some cost in accuracy; see core_zgemm3m.
+ *
+ *******************************************************************************i
+ * @param[in] group_size
+ * 	    The number of matrices to operate on
+ *
+ * @param[in] layout
+ * 	    Specifies if the matrix is stored in row major or column major
+ * 	    format:
+ * 	    - BblasRowMajor: Row major format
+ * 	    - BblasColMajor: Column major format
+ *
+ * @param[in] transa
+ *          - BblasNoTrans:   A[i] is not transposed,
+ *          - BblasTrans:     A[i] is transposed,
+ *          - BblasConjTrans: A[i] is conjugate transposed,
+ *          - BblasConjNoTrans: A[i] is conjugated, not transposed.
+ *
+ * @param[in] transb
+ *          - BblasNoTrans:   B[i] is not transposed,
+ *          - BblasTrans:     B[i] is transposed,
+ *          - BblasConjTrans: B[i] is conjugate transposed,
+ *          - BblasConjNoTrans: B[i] is conjugated, not transposed.
+ *
+ * @param[in] m
+ *          The number of rows of the matrix op( A[i] ) and of the matrix C[i].
+ *          m >= 0.
+ *
+ * @param[in] n
+ *          The number of columns of the matrix op( B[i] ) and of the matrix C[i].
+ *          n >= 0.
+ *
+ * @param[in] k
+ *          The number of columns of the matrix op( A[i] ) and the number of rows
+ *          of the matrix op( B[i] ). k >= 0.
+ *
+ * @param[in] alpha
+ *          Array of the group_size scalars alpha[i].
+ *
+ * @param[in] A
+ * 		A is an array of pointers to matrices A[0], A[1] .. A[group_size-1], 
+ * 		where each element A[i] is a pointer to a matrix of 
+ * 		dimension lda-by-ka, where ka is k when transa = 
+ * 		BblasNoTrans, and is m otherwise. When using transa = 
+ * 		BblasNoTrans the leading m-by-k part of A[i] 
+ * 		must contain the matrix elements, otherwise the leading  
+ * 		k-by-m part of A[i] must contain the matrix elements.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A[i].
+ *          When transa = BblasNoTrans, lda >= max(1,m),
+ *          otherwise, lda >= max(1,k).
+ *
+ * @param[in] B
+ * 		B is an array of pointers to matrices B[0], B[1],..,B[group_size-1],
+ * 		where each element B[i] is a pointer to a matrix of 
+ * 		dimension lda-by-kb, where kb is n when transb = 
+ * 		BblasNoTrans, and is k otherwise. When using transb = 
+ * 		BblasNoTrans the leading k-by-n part of B[i] 
+ * 		must contain the matrix elements, otherwise the leading  
+ * 		n-by-k part of B[i] must contain the matrix elements.
+ *
+ * @param[in] ldb
+ *          The leading dimension of the array B[i].
+ *          When transb = BblasNoTrans, ldb >= max(1,k),
+ *          otherwise, ldb >= max(1,n).
+ *
+ * @param[in] beta
+ *          Array of the group_size scalars beta[i].
+ *
+ * @param[in,out] C
+ * 		C is an array of pointers to matrices C[0], C[1],...,C[group_size-1],
+ *		where each element of C[i] is a pointer to a matrix of dimension 
+ *		ldc-by-n. On exit, each array C[i] is overwritten by the m-by-n
+ *		matrix ( alpha[i]*op(A[i] )*op( B[i] ) + beta[i]*C[i] ).
+ *
+ * @param[in] ldc
+ *          The leading dimension of the array C[i]. ldc >= max(1,m).
+ *
+ * @param[in,out] info
+ * 		Array of bblas_int for error handling. On entry info[0] should have one of the 
+ * 		following values
+ *			- BblasErrorsReportAll    :  All errors will be specified on output.
+ *						     Length of the array should be atleast
+ *						     \sum_{i=0}^{group_count-1}group_sizes[i]+1.
+ *			- BblasErrorsReportGroup  :  Single error from each group will be 
+ *						     reported. Length of the array should 
+ *						     be atleast group_count+1.
+ *			- BblasErrorsReportAny    :  Occurence of an error will be indicated
+ *						     by a single integer value, and length 
+ *						     of the array should be atleast 1.
+ *			- BblasErrorsReportNone   :  No error will be reported on output, and
+ *						     length of the array should be atleast 1.
+ ********************************************************************************
+ * @retval BblasSuccess successful exit
+ *
+ *******************************************************************************
+ *
+ * @sa zgemm_vscal_batchf
+ * @sa cgemm_vscal_batchf
+ * @sa dgemm_vscal_batchf
+ * @sa sgemm_vscal_batchf
+ *
+ ******************************************************************************/
+void blas_zgemm_vscal_batchf(bblas_int group_size, bblas_enum_t layout, bblas_enum_t transa,
+                             bblas_enum_t transb, bblas_int m, bblas_int n, bblas_int k,
+                             const bblas_complex64_t *alpha, bblas_complex64_t const *const *A, bblas_int lda,
+                                                             bblas_complex64_t const* const *B, bblas_int ldb,
+                             const bblas_complex64_t *beta,  bblas_complex64_t            ** C, bblas_int ldc,
+                             bblas_int *info)
+{
+	// Check input arguments 
+	if ((layout != BblasRowMajor) &&
+        (layout != BblasColMajor)) {
+		bblas_error("Illegal value of layout");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 1);
+		}
+		return;
+	}
+	if ((transa != BblasNoTrans) &&
+        (transa != BblasTrans) &&
+        (transa != BblasConjTrans) &&
+        (transa != BblasConjNoTrans)) {
+		bblas_error("Illegal value of transa");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 2);
+		}
+		return;
+	}
+	if ((transb != BblasNoTrans) &&
+        (transb != BblasTrans) &&
+        (transb != BblasConjTrans) &&
+        (transb != BblasConjNoTrans)) {
+		bblas_error("Illegal value of transb");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 3);
+		}
+		return;
+	}
+	if (m < 0) {
+		bblas_error("Illegal value of m");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 4);
+		}
+		return;
+	}
+	if (n < 0) {
+		bblas_error("Illegal value of n");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 5);
+		}
+		return;
+	}
+	if (k < 0) {
+		bblas_error("Illegal value of k");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 6);
+		}
+		return;
+	}
+	// Stored dimensions of A[i], B[i] and C[i].
+	bblas_int am = bblas_transposed(transa) ? k : m;
+	bblas_int bm = bblas_transposed(transb) ? n : k;
+	bblas_int cm = m;
+	if (layout == BblasRowMajor) {
+		am = bblas_transposed(transa) ? m : k;
+		bm = bblas_transposed(transb) ? k : n;
+		cm = n;
+	}
+	if (lda < imax(1, am)) {
+		bblas_error("Illegal value of lda");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 7);
+		}
+		return;
+	}
+	if (ldb < imax(1, bm)) {
+		bblas_error("Illegal value of ldb");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 8);
+		}
+		return;
+	}
+	if (ldc < imax(1, cm)) {
+		bblas_error("Illegal value of ldc");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 9);
+		}
+		return;
+	}
+
+	// Workspace of the 3M algorithm, if enabled and worthwhile,
+	// or for operands conjugated without transposition.
+	double *work;
+	if (!core_zgemm_workspace(transa, transb, m, n, k, &work)) {
+		bblas_error("malloc() failed");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size,
+			               BblasErrorOutOfMemory);
+		}
+		return;
+	}
+
+	for (bblas_int iter = 0; iter < group_size; iter++) {
+		// Scale only the matrix where alpha = 0 or k = 0
+		if (alpha[iter] == (bblas_complex64_t)0.0 || k == 0) {
+			if (beta[iter] != (bblas_complex64_t)1.0)
+				core_zscale(layout, BblasGeneral, m, n,
+				            beta[iter], C[iter], ldc);
+		}
+		else {
+			core_zgemm(layout, transa, transb,
+			           m, n, k,
+			           alpha[iter], A[iter], lda,
+			                        B[iter], ldb,
+			           beta[iter],  C[iter], ldc, work);
+		}
+		// BblasSuccess
+		if (info[0] == BblasErrorsReportAll)
+			info[iter] = 0;
+	}
+	free(work);
+
+	// BblasSuccess
+	if (info[0] != BblasErrorsReportAll)
+		info[0] = 0;
+}
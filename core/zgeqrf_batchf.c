@@ -0,0 +1,240 @@
+/**
+ *
+ * @file
+ *
+ *  BBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+
+#include "bblas.h"
+
+#include <stdlib.h>
+
+/******************************************************************************/
+// Copies the m-by-n matrix A, in the given layout, to or from the column
+// major W with leading dimension m.
+static void copy_in(bblas_enum_t layout, bblas_int m, bblas_int n,
+                    const bblas_complex64_t *A, bblas_int lda,
+                    bblas_complex64_t *W)
+{
+	for (bblas_int j = 0; j < n; j++)
+		for (bblas_int i = 0; i < m; i++)
+			W[(size_t)m*j + i] = (layout == BblasColMajor) ?
+				A[(size_t)lda*j + i] : A[(size_t)lda*i + j];
+}
+
+static void copy_out(bblas_enum_t layout, bblas_int m, bblas_int n,
+                     const bblas_complex64_t *W,
+                     bblas_complex64_t *A, bblas_int lda)
+{
+	for (bblas_int j = 0; j < n; j++)
+		for (bblas_int i = 0; i < m; i++) {
+			if (layout == BblasColMajor)
+				A[(size_t)lda*j + i] = W[(size_t)m*j + i];
+			else
+				A[(size_t)lda*i + j] = W[(size_t)m*j + i];
+		}
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup geqrf_batchf
+ *
+ *  Computes the QR factorizations
+ *
+ *    \f[ A[i] = Q[i] \times R[i] \f]
+ *
+ *  of the m-by-n matrices A[i], as LAPACK zgeqrf: R[i] is upper triangular
+ *  and Q[i] = H(0) H(1) .. H(k-1), with k = min(m, n), is a product of
+ *  elementary reflectors H(j) = I - tau[i][j] v(j) v(j)^H, stored as by
+ *  zgeqrf, so that blas_zlarft_batchf and blas_zlarfb_batchf with
+ *  BblasForward and BblasColumnwise apply them.
+ *
+ *  Matrices of at most BBLAS_GEQRF_SMALL elements are copied into a
+ *  contiguous workspace, which stays in L1, and factored there by the
+ *  unblocked core_zgeqr2. Larger ones are factored by panels of
+ *  BBLAS_GEQRF_NB columns, each factored by core_zgeqr2 and applied to
+ *  the trailing columns as a block reflector, by core_zlarft and
+ *  core_zlarfb, so that most of the work is in gemm. Row major matrices
+ *  are factored in a column major copy.
+ *
+ *******************************************************************************
+ *
+ * @param[in] group_size
+ * 	    The number of matrices to operate on.
+ *
+ * @param[in] layout
+ * 	    Specifies if the matrices are stored in row major or column major
+ * 	    format:
+ * 	    - BblasRowMajor: Row major format
+ * 	    - BblasColMajor: Column major format
+ *
+ * @param[in] m
+ *          The number of rows of the matrices A[i]. m >= 0.
+ *
+ * @param[in] n
+ *          The number of columns of the matrices A[i]. n >= 0.
+ *
+ * @param[in,out] A
+ * 	    A is an array of pointers to matrices A[0], A[1] .. A[group_size-1].
+ * 	    On exit, R[i] on and above the diagonal of each A[i] and the
+ * 	    reflectors below it.
+ *
+ * @param[in] lda
+ *          The leading dimension of the arrays A[i]. lda >= max(1, m) in
+ *          column major and lda >= max(1, n) in row major.
+ *
+ * @param[out] tau
+ * 	    tau is an array of pointers to vectors tau[0] .. tau[group_size-1]
+ * 	    of length min(m, n), the scalar factors of the reflectors.
+ *
+ * @param[in,out] info
+ * 		Array of bblas_int for error handling. On entry info[0] should have one of the
+ * 		following values
+ *			- BblasErrorsReportAll    :  All errors will be specified on output.
+ *						     Length of the array should be atleast
+ *						     group_size.
+ *			- BblasErrorsReportGroup  :  Single error from each group will be
+ *						     reported. Length of the array should
+ *						     be atleast 1.
+ *			- BblasErrorsReportAny    :  Occurence of an error will be indicated
+ *						     by a single integer value, and length
+ *						     of the array should be atleast 1.
+ *			- BblasErrorsReportNone   :  No error will be reported on output, and
+ *						     length of the array should be atleast 1.
+ ******************************************************************************
+ *
+ * @retval BblasSuccess successful exit
+ *
+ *******************************************************************************
+ *
+ * @sa zgeqrf_batchf
+ * @sa cgeqrf_batchf
+ * @sa dgeqrf_batchf
+ * @sa sgeqrf_batchf
+ *
+ ******************************************************************************/
+void blas_zgeqrf_batchf(bblas_int group_size, bblas_enum_t layout,
+                        bblas_int m, bblas_int n,
+                        bblas_complex64_t **A, bblas_int lda,
+                        bblas_complex64_t **tau,
+                        bblas_int *info)
+{
+	// Check input arguments
+	if ((layout != BblasRowMajor) &&
+	    (layout != BblasColMajor)) {
+		bblas_error("Illegal value of layout");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 1);
+		}
+		return;
+	}
+	if (m < 0) {
+		bblas_error("Illegal value of m");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 2);
+		}
+		return;
+	}
+	if (n < 0) {
+		bblas_error("Illegal value of n");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 3);
+		}
+		return;
+	}
+	if (lda < imax(1, (layout == BblasColMajor) ? m : n)) {
+		bblas_error("Illegal value of lda");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 4);
+		}
+		return;
+	}
+
+	bblas_int k = imin(m, n);
+	if (k > 0) {
+		// The copy of the A[i], unless they are factored in place, and
+		// for the blocked factorization, the expanded reflectors and
+		// the triangular factor of a panel, and the product of the
+		// trailing columns with the reflectors.
+		const bblas_int nb = BBLAS_GEQRF_NB;
+		bool small = (size_t)m*n <= BBLAS_GEQRF_SMALL;
+		bool copy = small || layout == BblasRowMajor;
+		size_t asize = copy ? (size_t)m*n : 0;
+		size_t vsize = small ? 0 : (size_t)m*nb;
+		size_t tsize = small ? 0 : (size_t)nb*nb;
+		size_t wsize = small ? 0 : (size_t)nb*n;
+		bblas_complex64_t *W = (bblas_complex64_t*)malloc(
+			(asize+vsize+tsize+wsize)*sizeof(bblas_complex64_t));
+		if (W == NULL) {
+			bblas_error("malloc() failed");
+			if (info[0] != BblasErrorsReportNone) {
+				bblas_set_info(info[0], &info[0], group_size,
+				               BblasErrorOutOfMemory);
+			}
+			return;
+		}
+		bblas_complex64_t *WA = W;
+		bblas_complex64_t *WV = W + asize;
+		bblas_complex64_t *WT = WV + vsize;
+		bblas_complex64_t *WW = WT + tsize;
+
+		// Operands of the next matrices are prefetched while computing
+		// the current one.
+		int dist;
+		bblas_get(BblasTunePrefetch, &dist);
+		for (bblas_int iter = 0; iter < group_size; iter++) {
+			bblas_prefetch_next(iter, dist, group_size, layout, m, n,
+			                    (const void *const *)A, lda,
+			                    sizeof(bblas_complex64_t), true);
+			bblas_complex64_t *Ai = A[iter];
+			bblas_int ldai = lda;
+			if (copy) {
+				copy_in(layout, m, n, A[iter], lda, WA);
+				Ai = WA;
+				ldai = m;
+			}
+
+			if (small) {
+				core_zgeqr2(m, n, Ai, ldai, tau[iter]);
+			}
+			else {
+				for (bblas_int j = 0; j < k; j += nb) {
+					bblas_int jb = imin(nb, k-j);
+					bblas_complex64_t *Ajj = &Ai[(size_t)ldai*j + j];
+					core_zgeqr2(m-j, jb, Ajj, ldai, tau[iter]+j);
+					if (j+jb < n) {
+						// Apply the panel to the trailing columns,
+						// A(j:m-1, j+jb:n-1) = H^H A(j:m-1, j+jb:n-1).
+						core_zlarf_expand(BblasColMajor, BblasForward,
+						                  BblasColumnwise, m-j, jb,
+						                  Ajj, ldai, WV, m-j);
+						core_zlarft(BblasColMajor, BblasForward, m-j, jb,
+						            WV, m-j, tau[iter]+j, WT, nb);
+						core_zlarfb(BblasColMajor, BblasLeft, Bblas_ConjTrans,
+						            BblasForward, m-j, n-j-jb, jb,
+						            WV, m-j, WT, nb,
+						            Ajj+(size_t)ldai*jb, ldai, WW);
+					}
+				}
+			}
+
+			if (copy)
+				copy_out(layout, m, n, WA, A[iter], lda);
+		}
+		free(W);
+	}
+
+	// BblasSuccess
+	if (info[0] == BblasErrorsReportAll) {
+		for (bblas_int iter = 0; iter < group_size; iter++)
+			info[iter] = 0;
+	}
+	else {
+		info[0] = 0;
+	}
+}
@@ -0,0 +1,199 @@
+/**
+ *
+ * @file
+ *
+ *  BBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+
+#include "bblas.h"
+
+#include <stdlib.h>
+
+/***************************************************************************//**
+ *
+ * @ingroup gtsv_batchf
+ *
+ *  Solves the batch of tridiagonal linear systems
+ *
+ *    \f[ A[i] \times X[i] = B[i], \f]
+ *
+ *  where A[i] is an n-by-n tridiagonal matrix and X[i] and B[i] are
+ *  n-by-nrhs matrices, by Gaussian elimination with partial pivoting, as
+ *  LAPACK zgtsv.
+ *
+ *  The elimination is sequential within a system, so the systems are
+ *  solved BBLAS_TRIDIAG_LANES at a time by core_zgtsv_lanes, which
+ *  vectorizes across them: their operands are interleaved into a
+ *  workspace, solved, and copied back.
+ *
+ *******************************************************************************
+ *
+ * @param[in] group_size
+ * 	    The number of matrices to operate on.
+ *
+ * @param[in] layout
+ * 	    Specifies if the matrices B[i] are stored in row major or column
+ * 	    major format:
+ * 	    - BblasRowMajor: Row major format
+ * 	    - BblasColMajor: Column major format
+ *
+ * @param[in] n
+ *          The order of the matrices A[i]. n >= 0.
+ *
+ * @param[in] nrhs
+ *          The number of columns of the matrices B[i]. nrhs >= 0.
+ *
+ * @param[in,out] dl
+ * 	    dl is an array of pointers to the vectors dl[0] .. dl[group_size-1].
+ * 	    On entry, the n-1 sub-diagonal elements of the A[i].
+ * 	    On exit, the n-2 elements of the second super-diagonals of the
+ * 	    factors U[i] of the A[i].
+ *
+ * @param[in,out] d
+ * 	    d is an array of pointers to the vectors d[0] .. d[group_size-1].
+ * 	    On entry, the n diagonal elements of the A[i].
+ * 	    On exit, the diagonals of the U[i].
+ *
+ * @param[in,out] du
+ * 	    du is an array of pointers to the vectors du[0] .. du[group_size-1].
+ * 	    On entry, the n-1 super-diagonal elements of the A[i].
+ * 	    On exit, the first super-diagonals of the U[i].
+ *
+ * @param[in,out] B
+ * 	    B is an array of pointers to matrices B[0], B[1] .. B[group_size-1].
+ * 	    On entry, each B[i] is an n-by-nrhs right hand side matrix.
+ * 	    On exit, the solution X[i], unless A[i] is singular.
+ *
+ * @param[in] ldb
+ *          The leading dimension of the arrays B[i]. ldb >= max(1, n) in
+ *          column major and ldb >= max(1, nrhs) in row major.
+ *
+ * @param[in,out] info
+ * 		Array of bblas_int for error handling. On entry info[0] should have one of the
+ * 		following values
+ *			- BblasErrorsReportAll    :  All errors will be specified on output.
+ *						     Length of the array should be atleast
+ *						     group_size.
+ *			- BblasErrorsReportGroup  :  Single error from each group will be
+ *						     reported. Length of the array should
+ *						     be atleast 1.
+ *			- BblasErrorsReportAny    :  Occurence of an error will be indicated
+ *						     by a single integer value, and length
+ *						     of the array should be atleast 1.
+ *			- BblasErrorsReportNone   :  No error will be reported on output, and
+ *						     length of the array should be atleast 1.
+ *		A matrix A[i] with an exactly zero pivot is reported as
+ *		BblasErrorSingular.
+ ******************************************************************************
+ *
+ * @retval BblasSuccess successful exit
+ *
+ *******************************************************************************
+ *
+ * @sa zgtsv_batchf
+ * @sa cgtsv_batchf
+ * @sa dgtsv_batchf
+ * @sa sgtsv_batchf
+ *
+ ******************************************************************************/
+void blas_zgtsv_batchf(bblas_int group_size, bblas_enum_t layout,
+                       bblas_int n, bblas_int nrhs,
+                       bblas_complex64_t **dl, bblas_complex64_t **d, bblas_complex64_t **du,
+                       bblas_complex64_t **B, bblas_int ldb,
+                       bblas_int *info)
+{
+	// Check input arguments
+	if ((layout != BblasRowMajor) &&
+	    (layout != BblasColMajor)) {
+		bblas_error("Illegal value of layout");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 1);
+		}
+		return;
+	}
+	if (n < 0) {
+		bblas_error("Illegal value of n");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 2);
+		}
+		return;
+	}
+	if (nrhs < 0) {
+		bblas_error("Illegal value of nrhs");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 3);
+		}
+		return;
+	}
+	if (ldb < imax(1, (layout == BblasColMajor) ? n : nrhs)) {
+		bblas_error("Illegal value of ldb");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 4);
+		}
+		return;
+	}
+
+	// Workspace of BBLAS_TRIDIAG_LANES interleaved systems.
+	const bblas_int lanes = BBLAS_TRIDIAG_LANES;
+	size_t len = (size_t)lanes*imax(1, n);
+	bblas_complex64_t *W = (bblas_complex64_t*)malloc(
+		(3+(size_t)nrhs)*len*sizeof(bblas_complex64_t));
+	if (W == NULL) {
+		bblas_error("malloc() failed");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, BblasErrorOutOfMemory);
+		}
+		return;
+	}
+	bblas_complex64_t *Wdl = W;
+	bblas_complex64_t *Wd  = W + len;
+	bblas_complex64_t *Wdu = W + 2*len;
+	bblas_complex64_t *WB  = W + 3*len;
+
+	// Distances between the rows and columns of the B[i].
+	bblas_int incb = (layout == BblasColMajor) ? 1 : ldb;
+	bblas_int ldx  = (layout == BblasColMajor) ? ldb : 1;
+
+	// info[0] is also the error of A[0] if all errors are reported.
+	bblas_int info_option = info[0];
+	bblas_int error = 0;
+	bblas_int info_lanes[BBLAS_TRIDIAG_LANES];
+	for (bblas_int first = 0; first < group_size; first += lanes) {
+		bblas_int count = imin(lanes, group_size-first);
+
+		core_zgather_lanes(count, n-1, 1, (bblas_complex64_t const *const *)dl+first,
+		                   1, n, Wdl);
+		core_zgather_lanes(count, n,   1, (bblas_complex64_t const *const *)d+first,
+		                   1, n, Wd);
+		core_zgather_lanes(count, n-1, 1, (bblas_complex64_t const *const *)du+first,
+		                   1, n, Wdu);
+		core_zgather_lanes(count, n, nrhs, (bblas_complex64_t const *const *)B+first,
+		                   incb, ldx, WB);
+
+		core_zgtsv_lanes(count, n, nrhs, Wdl, Wd, Wdu, count,
+		                 WB, count, count*n, info_lanes);
+
+		core_zscatter_lanes(count, n-1, 1, Wdl, dl+first, 1, n);
+		core_zscatter_lanes(count, n,   1, Wd,  d+first,  1, n);
+		core_zscatter_lanes(count, n-1, 1, Wdu, du+first, 1, n);
+		core_zscatter_lanes(count, n, nrhs, WB, B+first, incb, ldx);
+
+		for (bblas_int l = 0; l < count; l++) {
+			bblas_int code = (info_lanes[l] > 0) ? BblasErrorSingular : BblasSuccess;
+			if (info_option == BblasErrorsReportAll)
+				info[first+l] = code;
+			else if (error == 0)
+				error = code;
+		}
+	}
+	free(W);
+
+	// BblasSuccess, or the first error of the group
+	if (info_option != BblasErrorsReportAll)
+		info[0] = (info_option == BblasErrorsReportNone) ? 0 : error;
+}
@@ -79,7 +79,7 @@
  *          The leading dimension of the arrays C[i]. ldc >= max(1, n).
  *
  * @param[in,out] info
- * 		Array of int for error handling. On entry info[0] should have one of the 
+ * 		Array of bblas_int for error handling. On entry info[0] should have one of the 
  * 		following values
  *			- BblasErrorsReportAll    :  All errors will be specified on output.
  *						     Length of the array should be atleast
@@ -103,11 +103,11 @@
  *
  ******************************************************************************/
 
-void blas_zherk_batchf(int group_size, bblas_enum_t layout, bblas_enum_t uplo,
-                       bblas_enum_t trans, int n, int k,
-                       const double alpha, bblas_complex64_t const *const *A, int lda,
-                       const double beta, bblas_complex64_t             ** C, int ldc,
-                       int *info)
+void blas_zherk_batchf(bblas_int group_size, bblas_enum_t layout, bblas_enum_t uplo,
+                       bblas_enum_t trans, bblas_int n, bblas_int k,
+                       const double alpha, bblas_complex64_t const *const *A, bblas_int lda,
+                       const double beta, bblas_complex64_t             ** C, bblas_int ldc,
+                       bblas_int *info)
 {
 	// Check input arguments 
 	if ((layout != BblasRowMajor) &&
@@ -147,13 +147,15 @@ void blas_zherk_batchf(int group_size, bblas_enum_t layout, bblas_enum_t uplo,
 		}
 		return;
 	}
-    int am;
+    bblas_int am;
 	if (trans == BblasNoTrans) {
 		am = n;
 	} 
 	else {
 		am = k;
 	}
+	if (layout == BblasRowMajor)
+		am = (trans == BblasNoTrans) ? k : n;
 	if (lda < imax(1, am)) {
 		bblas_error("Illegal value of lda");
 		if (info[0] != BblasErrorsReportNone) {
@@ -168,7 +170,35 @@ void blas_zherk_batchf(int group_size, bblas_enum_t layout, bblas_enum_t uplo,
 		}
 		return;
 	}
-	for (int iter = 0; iter < group_size; iter++) {
+
+	// With alpha = 0 or k = 0, only C[i] := beta*C[i] is left to do.
+	if (alpha == 0.0 || k == 0) {
+		core_zscale_herm_batch(group_size, layout, uplo, n,
+		                       beta, C, ldc);
+		// BblasSuccess
+		if (info[0] == BblasErrorsReportAll) {
+			for (bblas_int iter = 0; iter < group_size; iter++)
+				info[iter] = 0;
+		}
+		else {
+			info[0] = 0;
+		}
+		return;
+	}
+
+	// Operands of the next matrices are prefetched while computing
+	// the current one.
+	int dist;
+	bblas_get(BblasTunePrefetch, &dist);
+	bblas_int ar = (trans == BblasNoTrans) ? n : k;
+	bblas_int ac = (trans == BblasNoTrans) ? k : n;
+	for (bblas_int iter = 0; iter < group_size; iter++) {
+		bblas_prefetch_next(iter, dist, group_size, layout, ar, ac,
+		                    (const void *const *)A, lda,
+		                    sizeof(bblas_complex64_t), false);
+		bblas_prefetch_next(iter, dist, group_size, layout, n, n,
+		                    (const void *const *)C, ldc,
+		                    sizeof(bblas_complex64_t), true);
 		cblas_zherk(layout, uplo, trans,
                     n, k,
                     alpha, A[iter], lda,
@@ -0,0 +1,179 @@
+/**
+ *
+ * @file
+ *
+ *  BBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+
+#include "bblas.h"
+
+#include <stdlib.h>
+
+/***************************************************************************//**
+ *
+ * @ingroup lange_batchf
+ *
+ *  Computes the norms
+ *
+ *    \f[ values[i] = \| A[i] \| \f]
+ *
+ *  of the m-by-n matrices A[i], as LAPACK zlange, in one sweep of the
+ *  batch by core_zlange, which reads each A[i] once, with unit stride.
+ *  A row major A[i] is the column major transpose, of which the one and
+ *  infinity norms are swapped.
+ *
+ *******************************************************************************
+ *
+ * @param[in] group_size
+ * 	    The number of matrices to operate on.
+ *
+ * @param[in] layout
+ * 	    Specifies if the matrices are stored in row major or column major
+ * 	    format:
+ * 	    - BblasRowMajor: Row major format
+ * 	    - BblasColMajor: Column major format
+ *
+ * @param[in] norm
+ *          - BblasMaxNorm:       max |A[i](k, l)|;
+ *          - BblasOneNorm:       the largest column sum of the |A[i](k, l)|;
+ *          - BblasInfNorm:       the largest row sum of the |A[i](k, l)|;
+ *          - BblasFrobeniusNorm: sqrt( sum |A[i](k, l)|^2 ).
+ *
+ * @param[in] m
+ *          The number of rows of the matrices A[i]. m >= 0.
+ *
+ * @param[in] n
+ *          The number of columns of the matrices A[i]. n >= 0.
+ *
+ * @param[in] A
+ * 	    A is an array of pointers to matrices A[0], A[1] .. A[group_size-1].
+ *
+ * @param[in] lda
+ *          The leading dimension of the arrays A[i]. lda >= max(1, m) in
+ *          column major and lda >= max(1, n) in row major.
+ *
+ * @param[out] values
+ *          An array of length group_size; values[i] is the norm of A[i],
+ *          0 if m or n is 0.
+ *
+ * @param[in,out] info
+ * 		Array of bblas_int for error handling. On entry info[0] should have one of the
+ * 		following values
+ *			- BblasErrorsReportAll    :  All errors will be specified on output.
+ *						     Length of the array should be atleast
+ *						     group_size.
+ *			- BblasErrorsReportGroup  :  Single error from each group will be
+ *						     reported. Length of the array should
+ *						     be atleast 1.
+ *			- BblasErrorsReportAny    :  Occurence of an error will be indicated
+ *						     by a single integer value, and length
+ *						     of the array should be atleast 1.
+ *			- BblasErrorsReportNone   :  No error will be reported on output, and
+ *						     length of the array should be atleast 1.
+ ******************************************************************************
+ *
+ * @retval BblasSuccess successful exit
+ *
+ *******************************************************************************
+ *
+ * @sa zlange_batchf
+ * @sa clange_batchf
+ * @sa dlange_batchf
+ * @sa slange_batchf
+ *
+ ******************************************************************************/
+void blas_zlange_batchf(bblas_int group_size, bblas_enum_t layout,
+                        bblas_enum_t norm, bblas_int m, bblas_int n,
+                        bblas_complex64_t const *const *A, bblas_int lda,
+                        double *values, bblas_int *info)
+{
+	// Check input arguments
+	if ((layout != BblasRowMajor) &&
+	    (layout != BblasColMajor)) {
+		bblas_error("Illegal value of layout");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 1);
+		}
+		return;
+	}
+	if ((norm != BblasMaxNorm) &&
+	    (norm != BblasOneNorm) &&
+	    (norm != BblasInfNorm) &&
+	    (norm != BblasFrobeniusNorm)) {
+		bblas_error("Illegal value of norm");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 2);
+		}
+		return;
+	}
+	if (m < 0) {
+		bblas_error("Illegal value of m");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 3);
+		}
+		return;
+	}
+	if (n < 0) {
+		bblas_error("Illegal value of n");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 4);
+		}
+		return;
+	}
+	if (lda < imax(1, (layout == BblasColMajor) ? m : n)) {
+		bblas_error("Illegal value of lda");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 5);
+		}
+		return;
+	}
+
+	// The column major matrices, and their norm.
+	bblas_int rows = (layout == BblasColMajor) ? m : n;
+	bblas_int cols = (layout == BblasColMajor) ? n : m;
+	bblas_enum_t cnorm = norm;
+	if (layout == BblasRowMajor && norm == BblasOneNorm)
+		cnorm = BblasInfNorm;
+	else if (layout == BblasRowMajor && norm == BblasInfNorm)
+		cnorm = BblasOneNorm;
+
+	// The row sums of the infinity norm.
+	double *work = NULL;
+	if (cnorm == BblasInfNorm && rows > 0) {
+		work = (double*)malloc((size_t)rows*sizeof(double));
+		if (work == NULL) {
+			bblas_error("malloc() failed");
+			if (info[0] != BblasErrorsReportNone) {
+				bblas_set_info(info[0], &info[0], group_size,
+				               BblasErrorOutOfMemory);
+			}
+			return;
+		}
+	}
+
+	// Operands of the next matrices are prefetched while computing the
+	// current one.
+	int dist;
+	bblas_get(BblasTunePrefetch, &dist);
+	for (bblas_int iter = 0; iter < group_size; iter++) {
+		bblas_prefetch_next(iter, dist, group_size, layout, m, n,
+		                    (const void *const *)A, lda,
+		                    sizeof(bblas_complex64_t), false);
+		values[iter] = core_zlange(cnorm, rows, cols, A[iter], lda, work);
+	}
+	free(work);
+
+	// BblasSuccess
+	if (info[0] == BblasErrorsReportAll) {
+		for (bblas_int iter = 0; iter < group_size; iter++)
+			info[iter] = 0;
+	}
+	else {
+		info[0] = 0;
+	}
+}
@@ -0,0 +1,174 @@
+/**
+ *
+ * @file
+ *
+ *  BBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+
+#include "bblas.h"
+
+#include <stdlib.h>
+
+/***************************************************************************//**
+ *
+ * @ingroup lansy_batchf
+ *
+ *  Computes the norms
+ *
+ *    \f[ values[i] = \| A[i] \| \f]
+ *
+ *  of the n-by-n symmetric matrices A[i], of which only the uplo
+ *  triangles are stored, as LAPACK zlansy, in one sweep of the batch by
+ *  core_zlansy. The one and infinity norms are equal. A row major A[i]
+ *  is the column major transpose, whose other triangle is stored.
+ *
+ *******************************************************************************
+ *
+ * @param[in] group_size
+ * 	    The number of matrices to operate on.
+ *
+ * @param[in] layout
+ * 	    Specifies if the matrices are stored in row major or column major
+ * 	    format:
+ * 	    - BblasRowMajor: Row major format
+ * 	    - BblasColMajor: Column major format
+ *
+ * @param[in] norm
+ *          BblasMaxNorm, BblasOneNorm, BblasInfNorm or BblasFrobeniusNorm,
+ *          as for blas_zlange_batchf.
+ *
+ * @param[in] uplo
+ *          - BblasUpper: the upper triangles of the A[i] are stored;
+ *          - BblasLower: the lower triangles of the A[i] are stored.
+ *
+ * @param[in] n
+ *          The order of the matrices A[i]. n >= 0.
+ *
+ * @param[in] A
+ * 	    A is an array of pointers to matrices A[0], A[1] .. A[group_size-1].
+ *
+ * @param[in] lda
+ *          The leading dimension of the arrays A[i]. lda >= max(1, n).
+ *
+ * @param[out] values
+ *          An array of length group_size; values[i] is the norm of A[i],
+ *          0 if n is 0.
+ *
+ * @param[in,out] info
+ * 		Array of bblas_int for error handling. On entry info[0] should have one of the
+ * 		following values
+ *			- BblasErrorsReportAll    :  All errors will be specified on output.
+ *						     Length of the array should be atleast
+ *						     group_size.
+ *			- BblasErrorsReportGroup  :  Single error from each group will be
+ *						     reported. Length of the array should
+ *						     be atleast 1.
+ *			- BblasErrorsReportAny    :  Occurence of an error will be indicated
+ *						     by a single integer value, and length
+ *						     of the array should be atleast 1.
+ *			- BblasErrorsReportNone   :  No error will be reported on output, and
+ *						     length of the array should be atleast 1.
+ ******************************************************************************
+ *
+ * @retval BblasSuccess successful exit
+ *
+ *******************************************************************************
+ *
+ * @sa zlansy_batchf
+ * @sa clansy_batchf
+ * @sa dlansy_batchf
+ * @sa slansy_batchf
+ *
+ ******************************************************************************/
+void blas_zlansy_batchf(bblas_int group_size, bblas_enum_t layout,
+                        bblas_enum_t norm, bblas_enum_t uplo, bblas_int n,
+                        bblas_complex64_t const *const *A, bblas_int lda,
+                        double *values, bblas_int *info)
+{
+	// Check input arguments
+	if ((layout != BblasRowMajor) &&
+	    (layout != BblasColMajor)) {
+		bblas_error("Illegal value of layout");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 1);
+		}
+		return;
+	}
+	if ((norm != BblasMaxNorm) &&
+	    (norm != BblasOneNorm) &&
+	    (norm != BblasInfNorm) &&
+	    (norm != BblasFrobeniusNorm)) {
+		bblas_error("Illegal value of norm");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 2);
+		}
+		return;
+	}
+	if ((uplo != BblasUpper) &&
+	    (uplo != BblasLower)) {
+		bblas_error("Illegal value of uplo");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 3);
+		}
+		return;
+	}
+	if (n < 0) {
+		bblas_error("Illegal value of n");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 4);
+		}
+		return;
+	}
+	if (lda < imax(1, n)) {
+		bblas_error("Illegal value of lda");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 5);
+		}
+		return;
+	}
+
+	// The uplo triangles of the column major matrices.
+	bblas_enum_t cuplo = uplo;
+	if (layout == BblasRowMajor)
+		cuplo = (uplo == BblasUpper) ? BblasLower : BblasUpper;
+
+	// The column sums of the one and infinity norms.
+	double *work = NULL;
+	if ((norm == BblasOneNorm || norm == BblasInfNorm) && n > 0) {
+		work = (double*)malloc((size_t)n*sizeof(double));
+		if (work == NULL) {
+			bblas_error("malloc() failed");
+			if (info[0] != BblasErrorsReportNone) {
+				bblas_set_info(info[0], &info[0], group_size,
+				               BblasErrorOutOfMemory);
+			}
+			return;
+		}
+	}
+
+	// Operands of the next matrices are prefetched while computing the
+	// current one.
+	int dist;
+	bblas_get(BblasTunePrefetch, &dist);
+	for (bblas_int iter = 0; iter < group_size; iter++) {
+		bblas_prefetch_next(iter, dist, group_size, layout, n, n,
+		                    (const void *const *)A, lda,
+		                    sizeof(bblas_complex64_t), false);
+		values[iter] = core_zlansy(norm, cuplo, n, A[iter], lda, work);
+	}
+	free(work);
+
+	// BblasSuccess
+	if (info[0] == BblasErrorsReportAll) {
+		for (bblas_int iter = 0; iter < group_size; iter++)
+			info[iter] = 0;
+	}
+	else {
+		info[0] = 0;
+	}
+}
@@ -0,0 +1,270 @@
+/**
+ *
+ * @file
+ *
+ *  BBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+
+#include "bblas.h"
+
+#include <stdlib.h>
+
+/***************************************************************************//**
+ *
+ * @ingroup larfb_batchf
+ *
+ *  Applies the block reflectors H[i] = I - V[i] T[i] V[i]^H, or their
+ *  conjugate transposes, to the m-by-n matrices C[i],
+ *
+ *    \f[ C[i] = op( H[i] ) \times C[i] \f] or
+ *    \f[ C[i] = C[i] \times op( H[i] ), \f]
+ *
+ *  as LAPACK zlarfb, with T[i] formed by blas_zlarft_batchf.
+ *
+ *  The reflectors of each V[i] are expanded into one workspace for the
+ *  group, by core_zlarf_expand, after which the update is two gemm and
+ *  a trmm, as in core_zlarfb.
+ *
+ *******************************************************************************
+ *
+ * @param[in] group_size
+ * 	    The number of matrices to operate on.
+ *
+ * @param[in] layout
+ * 	    Specifies if the matrices are stored in row major or column major
+ * 	    format:
+ * 	    - BblasRowMajor: Row major format
+ * 	    - BblasColMajor: Column major format
+ *
+ * @param[in] side
+ * 	    - BblasLeft:  C[i] = op( H[i] ) C[i]
+ * 	    - BblasRight: C[i] = C[i] op( H[i] )
+ *
+ * @param[in] trans
+ * 	    - BblasNoTrans:    op( H[i] ) = H[i]
+ * 	    - Bblas_ConjTrans: op( H[i] ) = H[i]^H
+ *
+ * @param[in] direct
+ * 	    The order in which the reflectors are multiplied, as in
+ * 	    blas_zlarft_batchf:
+ * 	    - BblasForward:  H[i] = H(0) H(1) .. H(k-1)
+ * 	    - BblasBackward: H[i] = H(k-1) .. H(1) H(0)
+ *
+ * @param[in] storev
+ * 	    How the vectors of the reflectors are stored in V[i]:
+ * 	    - BblasColumnwise: columnwise, V[i] is nv-by-k
+ * 	    - BblasRowwise:    rowwise, V[i] is k-by-nv
+ * 	    where nv = m if side = BblasLeft and nv = n otherwise.
+ *
+ * @param[in] m
+ *          The number of rows of the matrices C[i]. m >= 0.
+ *
+ * @param[in] n
+ *          The number of columns of the matrices C[i]. n >= 0.
+ *
+ * @param[in] k
+ *          The number of elementary reflectors, the order of the T[i].
+ *          0 <= k <= nv.
+ *
+ * @param[in] V
+ * 	    V is an array of pointers to matrices V[0], V[1] .. V[group_size-1]
+ * 	    holding the vectors of the reflectors, as in blas_zlarft_batchf.
+ *
+ * @param[in] ldv
+ *          The leading dimension of the arrays V[i]. ldv >= max(1, nv) if
+ *          storev = BblasColumnwise and ldv >= max(1, k) otherwise, in
+ *          column major, and the other way round in row major.
+ *
+ * @param[in] T
+ * 	    T is an array of pointers to the k-by-k triangular factors
+ * 	    T[0] .. T[group_size-1], upper triangular if direct = BblasForward
+ * 	    and lower triangular otherwise.
+ *
+ * @param[in] ldt
+ *          The leading dimension of the arrays T[i]. ldt >= max(1, k).
+ *
+ * @param[in,out] C
+ * 	    C is an array of pointers to matrices C[0], C[1] .. C[group_size-1].
+ * 	    On exit, op( H[i] ) C[i] or C[i] op( H[i] ).
+ *
+ * @param[in] ldc
+ *          The leading dimension of the arrays C[i]. ldc >= max(1, m) in
+ *          column major and ldc >= max(1, n) in row major.
+ *
+ * @param[in,out] info
+ * 		Array of bblas_int for error handling. On entry info[0] should have one of the
+ * 		following values
+ *			- BblasErrorsReportAll    :  All errors will be specified on output.
+ *						     Length of the array should be atleast
+ *						     group_size.
+ *			- BblasErrorsReportGroup  :  Single error from each group will be
+ *						     reported. Length of the array should
+ *						     be atleast 1.
+ *			- BblasErrorsReportAny    :  Occurence of an error will be indicated
+ *						     by a single integer value, and length
+ *						     of the array should be atleast 1.
+ *			- BblasErrorsReportNone   :  No error will be reported on output, and
+ *						     length of the array should be atleast 1.
+ ******************************************************************************
+ *
+ * @retval BblasSuccess successful exit
+ *
+ *******************************************************************************
+ *
+ * @sa zlarfb_batchf
+ * @sa clarfb_batchf
+ * @sa dlarfb_batchf
+ * @sa slarfb_batchf
+ *
+ ******************************************************************************/
+void blas_zlarfb_batchf(bblas_int group_size, bblas_enum_t layout,
+                        bblas_enum_t side, bblas_enum_t trans,
+                        bblas_enum_t direct, bblas_enum_t storev,
+                        bblas_int m, bblas_int n, bblas_int k,
+                        bblas_complex64_t const *const *V, bblas_int ldv,
+                        bblas_complex64_t const *const *T, bblas_int ldt,
+                        bblas_complex64_t **C, bblas_int ldc,
+                        bblas_int *info)
+{
+	// Check input arguments
+	if ((layout != BblasRowMajor) &&
+	    (layout != BblasColMajor)) {
+		bblas_error("Illegal value of layout");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 1);
+		}
+		return;
+	}
+	if ((side != BblasLeft) &&
+	    (side != BblasRight)) {
+		bblas_error("Illegal value of side");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 2);
+		}
+		return;
+	}
+	if ((trans != BblasNoTrans) &&
+	    (trans != Bblas_ConjTrans)) {
+		bblas_error("Illegal value of trans");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 3);
+		}
+		return;
+	}
+	if ((direct != BblasForward) &&
+	    (direct != BblasBackward)) {
+		bblas_error("Illegal value of direct");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 4);
+		}
+		return;
+	}
+	if ((storev != BblasColumnwise) &&
+	    (storev != BblasRowwise)) {
+		bblas_error("Illegal value of storev");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 5);
+		}
+		return;
+	}
+	if (m < 0) {
+		bblas_error("Illegal value of m");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 6);
+		}
+		return;
+	}
+	if (n < 0) {
+		bblas_error("Illegal value of n");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 7);
+		}
+		return;
+	}
+	// Order of the reflectors.
+	bblas_int nv = (side == BblasLeft) ? m : n;
+	if (k < 0 || k > nv) {
+		bblas_error("Illegal value of k");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 8);
+		}
+		return;
+	}
+	// Stored dimension of V[i].
+	bblas_int vm = ((storev == BblasColumnwise) == (layout == BblasColMajor)) ? nv : k;
+	if (ldv < imax(1, vm)) {
+		bblas_error("Illegal value of ldv");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 9);
+		}
+		return;
+	}
+	if (ldt < imax(1, k)) {
+		bblas_error("Illegal value of ldt");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 10);
+		}
+		return;
+	}
+	if (ldc < imax(1, (layout == BblasColMajor) ? m : n)) {
+		bblas_error("Illegal value of ldc");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 11);
+		}
+		return;
+	}
+
+	if (m > 0 && n > 0 && k > 0) {
+		// One workspace for the group, reused by every matrix: the
+		// expanded reflectors, nv-by-k, and the product of k columns
+		// of C with them.
+		size_t vsize = (size_t)nv*k;
+		size_t wsize = (size_t)k*((side == BblasLeft) ? n : m);
+		bblas_complex64_t *W =
+			(bblas_complex64_t*)malloc((vsize+wsize)*sizeof(bblas_complex64_t));
+		if (W == NULL) {
+			bblas_error("malloc() failed");
+			if (info[0] != BblasErrorsReportNone) {
+				bblas_set_info(info[0], &info[0], group_size,
+				               BblasErrorOutOfMemory);
+			}
+			return;
+		}
+		bblas_complex64_t *WV = W;
+		bblas_int ldwv = (layout == BblasColMajor) ? nv : k;
+
+		// Operands of the next matrices are prefetched while computing
+		// the current one.
+		int dist;
+		bblas_get(BblasTunePrefetch, &dist);
+		for (bblas_int iter = 0; iter < group_size; iter++) {
+			bblas_prefetch_next(iter, dist, group_size, layout,
+			                    (storev == BblasColumnwise) ? nv : k,
+			                    (storev == BblasColumnwise) ? k : nv,
+			                    (const void *const *)V, ldv,
+			                    sizeof(bblas_complex64_t), false);
+			bblas_prefetch_next(iter, dist, group_size, layout, m, n,
+			                    (const void *const *)C, ldc,
+			                    sizeof(bblas_complex64_t), true);
+			core_zlarf_expand(layout, direct, storev, nv, k,
+			                  V[iter], ldv, WV, ldwv);
+			core_zlarfb(layout, side, trans, direct, m, n, k,
+			            WV, ldwv, T[iter], ldt, C[iter], ldc, W+vsize);
+		}
+		free(W);
+	}
+
+	// BblasSuccess
+	if (info[0] == BblasErrorsReportAll) {
+		for (bblas_int iter = 0; iter < group_size; iter++)
+			info[iter] = 0;
+	}
+	else {
+		info[0] = 0;
+	}
+}
@@ -0,0 +1,218 @@
+/**
+ *
+ * @file
+ *
+ *  BBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+
+#include "bblas.h"
+
+#include <stdlib.h>
+
+/***************************************************************************//**
+ *
+ * @ingroup larft_batchf
+ *
+ *  Forms the triangular factors T[i] of the block reflectors
+ *
+ *    \f[ H[i] = I - V[i] \times T[i] \times V[i]^H \f]
+ *
+ *  of k elementary reflectors of order n each, as LAPACK zlarft:
+ *  H[i] = H(0) H(1) .. H(k-1) and T[i] is upper triangular if
+ *  direct = BblasForward, H[i] = H(k-1) .. H(1) H(0) and T[i] is lower
+ *  triangular if direct = BblasBackward.
+ *
+ *  The reflectors of each V[i] are expanded into one workspace for the
+ *  group, by core_zlarf_expand, after which T[i] is formed by BLAS 2
+ *  products on the explicit vectors.
+ *
+ *******************************************************************************
+ *
+ * @param[in] group_size
+ * 	    The number of matrices to operate on.
+ *
+ * @param[in] layout
+ * 	    Specifies if the matrices are stored in row major or column major
+ * 	    format:
+ * 	    - BblasRowMajor: Row major format
+ * 	    - BblasColMajor: Column major format
+ *
+ * @param[in] direct
+ * 	    The order in which the reflectors are multiplied:
+ * 	    - BblasForward:  H[i] = H(0) H(1) .. H(k-1)
+ * 	    - BblasBackward: H[i] = H(k-1) .. H(1) H(0)
+ *
+ * @param[in] storev
+ * 	    How the vectors of the reflectors are stored in V[i]:
+ * 	    - BblasColumnwise: columnwise, V[i] is n-by-k
+ * 	    - BblasRowwise:    rowwise, V[i] is k-by-n
+ *
+ * @param[in] n
+ *          The order of the block reflectors. n >= 0.
+ *
+ * @param[in] k
+ *          The number of elementary reflectors, the order of the T[i].
+ *          0 <= k <= n.
+ *
+ * @param[in] V
+ * 	    V is an array of pointers to matrices V[0], V[1] .. V[group_size-1]
+ * 	    holding the vectors of the reflectors as by LAPACK zgeqrf,
+ * 	    zgelqf, zgeqlf or zgerqf. With direct = BblasForward, vector j
+ * 	    has a unit element j and zeros before it, with
+ * 	    direct = BblasBackward, a unit element n-k+j and zeros after it;
+ * 	    neither is read.
+ *
+ * @param[in] ldv
+ *          The leading dimension of the arrays V[i]. ldv >= max(1, n) if
+ *          storev = BblasColumnwise and ldv >= max(1, k) otherwise, in
+ *          column major, and the other way round in row major.
+ *
+ * @param[in] tau
+ * 	    tau is an array of pointers to vectors tau[0] .. tau[group_size-1]
+ * 	    of the k scalar factors of the reflectors.
+ *
+ * @param[out] T
+ * 	    T is an array of pointers to k-by-k matrices T[0] .. T[group_size-1].
+ * 	    On exit, the triangular factors; the other triangle is not
+ * 	    referenced.
+ *
+ * @param[in] ldt
+ *          The leading dimension of the arrays T[i]. ldt >= max(1, k).
+ *
+ * @param[in,out] info
+ * 		Array of bblas_int for error handling. On entry info[0] should have one of the
+ * 		following values
+ *			- BblasErrorsReportAll    :  All errors will be specified on output.
+ *						     Length of the array should be atleast
+ *						     group_size.
+ *			- BblasErrorsReportGroup  :  Single error from each group will be
+ *						     reported. Length of the array should
+ *						     be atleast 1.
+ *			- BblasErrorsReportAny    :  Occurence of an error will be indicated
+ *						     by a single integer value, and length
+ *						     of the array should be atleast 1.
+ *			- BblasErrorsReportNone   :  No error will be reported on output, and
+ *						     length of the array should be atleast 1.
+ ******************************************************************************
+ *
+ * @retval BblasSuccess successful exit
+ *
+ *******************************************************************************
+ *
+ * @sa zlarft_batchf
+ * @sa clarft_batchf
+ * @sa dlarft_batchf
+ * @sa slarft_batchf
+ *
+ ******************************************************************************/
+void blas_zlarft_batchf(bblas_int group_size, bblas_enum_t layout,
+                        bblas_enum_t direct, bblas_enum_t storev,
+                        bblas_int n, bblas_int k,
+                        bblas_complex64_t const *const *V, bblas_int ldv,
+                        bblas_complex64_t const *const *tau,
+                        bblas_complex64_t **T, bblas_int ldt,
+                        bblas_int *info)
+{
+	// Check input arguments
+	if ((layout != BblasRowMajor) &&
+	    (layout != BblasColMajor)) {
+		bblas_error("Illegal value of layout");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 1);
+		}
+		return;
+	}
+	if ((direct != BblasForward) &&
+	    (direct != BblasBackward)) {
+		bblas_error("Illegal value of direct");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 2);
+		}
+		return;
+	}
+	if ((storev != BblasColumnwise) &&
+	    (storev != BblasRowwise)) {
+		bblas_error("Illegal value of storev");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 3);
+		}
+		return;
+	}
+	if (n < 0) {
+		bblas_error("Illegal value of n");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 4);
+		}
+		return;
+	}
+	if (k < 0 || k > n) {
+		bblas_error("Illegal value of k");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 5);
+		}
+		return;
+	}
+	// Stored dimension of V[i].
+	bblas_int vm = ((storev == BblasColumnwise) == (layout == BblasColMajor)) ? n : k;
+	if (ldv < imax(1, vm)) {
+		bblas_error("Illegal value of ldv");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 6);
+		}
+		return;
+	}
+	if (ldt < imax(1, k)) {
+		bblas_error("Illegal value of ldt");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 7);
+		}
+		return;
+	}
+
+	if (k > 0) {
+		// One workspace for the group, reused by every matrix, so that
+		// the expanded reflectors stay in cache.
+		bblas_complex64_t *W =
+			(bblas_complex64_t*)malloc((size_t)n*k*sizeof(bblas_complex64_t));
+		if (W == NULL) {
+			bblas_error("malloc() failed");
+			if (info[0] != BblasErrorsReportNone) {
+				bblas_set_info(info[0], &info[0], group_size,
+				               BblasErrorOutOfMemory);
+			}
+			return;
+		}
+		bblas_int ldw = (layout == BblasColMajor) ? n : k;
+
+		// Operands of the next matrices are prefetched while computing
+		// the current one.
+		int dist;
+		bblas_get(BblasTunePrefetch, &dist);
+		for (bblas_int iter = 0; iter < group_size; iter++) {
+			bblas_prefetch_next(iter, dist, group_size, layout,
+			                    (storev == BblasColumnwise) ? n : k,
+			                    (storev == BblasColumnwise) ? k : n,
+			                    (const void *const *)V, ldv,
+			                    sizeof(bblas_complex64_t), false);
+			core_zlarf_expand(layout, direct, storev, n, k,
+			                  V[iter], ldv, W, ldw);
+			core_zlarft(layout, direct, n, k, W, ldw,
+			            tau[iter], T[iter], ldt);
+		}
+		free(W);
+	}
+
+	// BblasSuccess
+	if (info[0] == BblasErrorsReportAll) {
+		for (bblas_int iter = 0; iter < group_size; iter++)
+			info[iter] = 0;
+	}
+	else {
+		info[0] = 0;
+	}
+}
@@ -0,0 +1,208 @@
+/**
+ *
+ * @file
+ *
+ *  BBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+
+#include "bblas.h"
+
+#include <stdlib.h>
+
+/******************************************************************************/
+// The real diagonals d[l], l = 0 .. lanes-1, of length n, to and from the
+// interleaved workspace W, as by core_zgather_lanes and core_zscatter_lanes.
+static void gather_diag(bblas_int lanes, bblas_int n, double **d, double *W)
+{
+	for (bblas_int l = 0; l < lanes; l++)
+		for (bblas_int k = 0; k < n; k++)
+			W[(size_t)k*lanes + l] = d[l][k];
+}
+
+static void scatter_diag(bblas_int lanes, bblas_int n, const double *W, double **d)
+{
+	for (bblas_int l = 0; l < lanes; l++)
+		for (bblas_int k = 0; k < n; k++)
+			d[l][k] = W[(size_t)k*lanes + l];
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup ptsv_batchf
+ *
+ *  Solves the batch of tridiagonal linear systems
+ *
+ *    \f[ A[i] \times X[i] = B[i], \f]
+ *
+ *  where A[i] is an n-by-n Hermitian positive definite tridiagonal matrix
+ *  and X[i] and B[i] are n-by-nrhs matrices, by the factorization
+ *  A[i] = L[i] D[i] L[i]^H, as LAPACK zptsv.
+ *
+ *  The systems are solved BBLAS_TRIDIAG_LANES at a time by
+ *  core_zptsv_lanes, which vectorizes across them, on operands
+ *  interleaved into a workspace; see blas_zgtsv_batchf.
+ *
+ *******************************************************************************
+ *
+ * @param[in] group_size
+ * 	    The number of matrices to operate on.
+ *
+ * @param[in] layout
+ * 	    Specifies if the matrices B[i] are stored in row major or column
+ * 	    major format:
+ * 	    - BblasRowMajor: Row major format
+ * 	    - BblasColMajor: Column major format
+ *
+ * @param[in] n
+ *          The order of the matrices A[i]. n >= 0.
+ *
+ * @param[in] nrhs
+ *          The number of columns of the matrices B[i]. nrhs >= 0.
+ *
+ * @param[in,out] d
+ * 	    d is an array of pointers to the real vectors d[0] .. d[group_size-1].
+ * 	    On entry, the n diagonal elements of the A[i].
+ * 	    On exit, the diagonals of the D[i].
+ *
+ * @param[in,out] e
+ * 	    e is an array of pointers to the vectors e[0] .. e[group_size-1].
+ * 	    On entry, the n-1 sub-diagonal elements of the A[i].
+ * 	    On exit, the sub-diagonals of the unit bidiagonal factors L[i].
+ *
+ * @param[in,out] B
+ * 	    B is an array of pointers to matrices B[0], B[1] .. B[group_size-1].
+ * 	    On entry, each B[i] is an n-by-nrhs right hand side matrix.
+ * 	    On exit, the solution X[i], unless A[i] is not positive definite.
+ *
+ * @param[in] ldb
+ *          The leading dimension of the arrays B[i]. ldb >= max(1, n) in
+ *          column major and ldb >= max(1, nrhs) in row major.
+ *
+ * @param[in,out] info
+ * 		Array of bblas_int for error handling. On entry info[0] should have one of the
+ * 		following values
+ *			- BblasErrorsReportAll    :  All errors will be specified on output.
+ *						     Length of the array should be atleast
+ *						     group_size.
+ *			- BblasErrorsReportGroup  :  Single error from each group will be
+ *						     reported. Length of the array should
+ *						     be atleast 1.
+ *			- BblasErrorsReportAny    :  Occurence of an error will be indicated
+ *						     by a single integer value, and length
+ *						     of the array should be atleast 1.
+ *			- BblasErrorsReportNone   :  No error will be reported on output, and
+ *						     length of the array should be atleast 1.
+ *		A matrix A[i] that is not positive definite is reported as
+ *		BblasErrorNotPositiveDefinite.
+ ******************************************************************************
+ *
+ * @retval BblasSuccess successful exit
+ *
+ *******************************************************************************
+ *
+ * @sa zptsv_batchf
+ * @sa cptsv_batchf
+ * @sa dptsv_batchf
+ * @sa sptsv_batchf
+ *
+ ******************************************************************************/
+void blas_zptsv_batchf(bblas_int group_size, bblas_enum_t layout,
+                       bblas_int n, bblas_int nrhs,
+                       double **d, bblas_complex64_t **e,
+                       bblas_complex64_t **B, bblas_int ldb,
+                       bblas_int *info)
+{
+	// Check input arguments
+	if ((layout != BblasRowMajor) &&
+	    (layout != BblasColMajor)) {
+		bblas_error("Illegal value of layout");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 1);
+		}
+		return;
+	}
+	if (n < 0) {
+		bblas_error("Illegal value of n");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 2);
+		}
+		return;
+	}
+	if (nrhs < 0) {
+		bblas_error("Illegal value of nrhs");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 3);
+		}
+		return;
+	}
+	if (ldb < imax(1, (layout == BblasColMajor) ? n : nrhs)) {
+		bblas_error("Illegal value of ldb");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 4);
+		}
+		return;
+	}
+
+	// Workspace of BBLAS_TRIDIAG_LANES interleaved systems.
+	const bblas_int lanes = BBLAS_TRIDIAG_LANES;
+	size_t len = (size_t)lanes*imax(1, n);
+	bblas_complex64_t *W = (bblas_complex64_t*)malloc(
+		(1+(size_t)nrhs)*len*sizeof(bblas_complex64_t));
+	double *Wd = (double*)malloc(len*sizeof(double));
+	if (W == NULL || Wd == NULL) {
+		bblas_error("malloc() failed");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, BblasErrorOutOfMemory);
+		}
+		free(W);
+		free(Wd);
+		return;
+	}
+	bblas_complex64_t *We = W;
+	bblas_complex64_t *WB = W + len;
+
+	// Distances between the rows and columns of the B[i].
+	bblas_int incb = (layout == BblasColMajor) ? 1 : ldb;
+	bblas_int ldx  = (layout == BblasColMajor) ? ldb : 1;
+
+	// info[0] is also the error of A[0] if all errors are reported.
+	bblas_int info_option = info[0];
+	bblas_int error = 0;
+	bblas_int info_lanes[BBLAS_TRIDIAG_LANES];
+	for (bblas_int first = 0; first < group_size; first += lanes) {
+		bblas_int count = imin(lanes, group_size-first);
+
+		gather_diag(count, n, d+first, Wd);
+		core_zgather_lanes(count, n-1, 1, (bblas_complex64_t const *const *)e+first,
+		                   1, n, We);
+		core_zgather_lanes(count, n, nrhs, (bblas_complex64_t const *const *)B+first,
+		                   incb, ldx, WB);
+
+		core_zptsv_lanes(count, n, nrhs, Wd, We, count,
+		                 WB, count, count*n, info_lanes);
+
+		scatter_diag(count, n, Wd, d+first);
+		core_zscatter_lanes(count, n-1, 1, We, e+first, 1, n);
+		core_zscatter_lanes(count, n, nrhs, WB, B+first, incb, ldx);
+
+		for (bblas_int l = 0; l < count; l++) {
+			bblas_int code = (info_lanes[l] > 0) ?
+				BblasErrorNotPositiveDefinite : BblasSuccess;
+			if (info_option == BblasErrorsReportAll)
+				info[first+l] = code;
+			else if (error == 0)
+				error = code;
+		}
+	}
+	free(W);
+	free(Wd);
+
+	// BblasSuccess, or the first error of the group
+	if (info_option != BblasErrorsReportAll)
+		info[0] = (info_option == BblasErrorsReportNone) ? 0 : error;
+}
@@ -95,7 +95,7 @@
  *          The leading dimension of the arrays C[i]. ldc >= max(1, n).
  *
  * @param[in,out] info
- * 		Array of int for error handling. On entry info[0] should have one of the 
+ * 		Array of bblas_int for error handling. On entry info[0] should have one of the 
  * 		following values
  *			- BblasErrorsReportAll    :  All errors will be specified on output.
  *						     Length of the array should be atleast
@@ -120,12 +120,12 @@
  * @sa ssyr2k_batchf
  *
  ******************************************************************************/
-void blas_zsyr2k_batchf(int group_size, bblas_enum_t layout, bblas_enum_t uplo,
-                        bblas_enum_t trans, int n, int k, 
-                        bblas_complex64_t alpha, bblas_complex64_t const *const *A, int lda,
-                                                 bblas_complex64_t const* const *B, int ldb,
-                        bblas_complex64_t  beta, bblas_complex64_t            ** C, int ldc,
-                        int *info)
+void blas_zsyr2k_batchf(bblas_int group_size, bblas_enum_t layout, bblas_enum_t uplo,
+                        bblas_enum_t trans, bblas_int n, bblas_int k, 
+                        bblas_complex64_t alpha, bblas_complex64_t const *const *A, bblas_int lda,
+                                                 bblas_complex64_t const* const *B, bblas_int ldb,
+                        bblas_complex64_t  beta, bblas_complex64_t            ** C, bblas_int ldc,
+                        bblas_int *info)
 {
 	// Check input arguments 
 	if ((layout != BblasRowMajor) &&
@@ -165,7 +165,7 @@ void blas_zsyr2k_batchf(int group_size, bblas_enum_t layout, bblas_enum_t uplo,
 		}
 		return;
 	}
-    int am, bm;
+    bblas_int am, bm;
     if (trans == BblasNoTrans) {
         am = n;
         bm = n;
@@ -174,6 +174,10 @@ void blas_zsyr2k_batchf(int group_size, bblas_enum_t layout, bblas_enum_t uplo,
         am = k;
         bm = k;
     }
+    if (layout == BblasRowMajor) {
+        am = (trans == BblasNoTrans) ? k : n;
+        bm = am;
+    }
     if (lda < imax(1, am)) {
 		bblas_error("Illegal value of lda");
 		if (info[0] != BblasErrorsReportNone) {
@@ -195,7 +199,38 @@ void blas_zsyr2k_batchf(int group_size, bblas_enum_t layout, bblas_enum_t uplo,
 		}
 		return;
 	}
-	for (int iter = 0; iter < group_size; iter++) {
+
+	// With alpha = 0 or k = 0, only C[i] := beta*C[i] is left to do.
+	if (alpha == (bblas_complex64_t)0.0 || k == 0) {
+		core_zscale_batch(group_size, layout, uplo, n, n,
+		                  beta, C, ldc);
+		// BblasSuccess
+		if (info[0] == BblasErrorsReportAll) {
+			for (bblas_int iter = 0; iter < group_size; iter++)
+				info[iter] = 0;
+		}
+		else {
+			info[0] = 0;
+		}
+		return;
+	}
+
+	// Operands of the next matrices are prefetched while computing
+	// the current one.
+	int dist;
+	bblas_get(BblasTunePrefetch, &dist);
+	bblas_int ar = (trans == BblasNoTrans) ? n : k;
+	bblas_int ac = (trans == BblasNoTrans) ? k : n;
+	for (bblas_int iter = 0; iter < group_size; iter++) {
+		bblas_prefetch_next(iter, dist, group_size, layout, ar, ac,
+		                    (const void *const *)A, lda,
+		                    sizeof(bblas_complex64_t), false);
+		bblas_prefetch_next(iter, dist, group_size, layout, ar, ac,
+		                    (const void *const *)B, ldb,
+		                    sizeof(bblas_complex64_t), false);
+		bblas_prefetch_next(iter, dist, group_size, layout, n, n,
+		                    (const void *const *)C, ldc,
+		                    sizeof(bblas_complex64_t), true);
 		cblas_zsyr2k(layout, uplo, trans,
 				n, k,
 				CBLAS_SADDR(alpha), A[iter], lda,
@@ -0,0 +1,358 @@
+/**
+ *
+ * @file
+ *
+ *  BBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+
+#include "bblas.h"
+
+#include <string.h>
+
+/******************************************************************************/
+// Copies the m-by-n matrix B into C.
+static void copy_b_to_c(bblas_enum_t layout, bblas_int m, bblas_int n,
+                        const bblas_complex64_t *B, bblas_int ldb,
+                              bblas_complex64_t *C, bblas_int ldc)
+{
+	if (layout == BblasRowMajor) {
+		bblas_int tmp = m;
+		m = n;
+		n = tmp;
+	}
+	for (bblas_int j = 0; j < n; j++)
+		memcpy(&C[(size_t)ldc*j], &B[(size_t)ldb*j],
+		       (size_t)m*sizeof(bblas_complex64_t));
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup trmm_oop_batchf
+ *
+ *  Performs an out-of-place triangular batch matrix-matrix multiply of the form
+ *
+ *          \f[C[i] = \alpha [op( A[i] ) \times B[i]] \f], if side = BblasLeft  or
+ *          \f[C[i] = \alpha [B[i] \times op( A[i]) ] \f], if side = BblasRight
+ *
+ *  where op( X ) is one of:
+ *
+ *          - op(A[i]) = A[i]   or
+ *          - op(A[i]) = A[i]^T or
+ *          - op(A[i]) = A[i]^H
+ *
+ *  alpha is a scalar, B[i]-s and C[i]-s are m-by-n matrices and A[i]-s are a unit or
+ *  non-unit, upper or lower triangular matrix. Unlike trmm_batchf, B[i]-s are
+ *  not modified, so callers that still need B[i] do not have to copy it first.
+ *
+ *******************************************************************************
+ * @param[in] group_size
+ * 	    The number of matrices to operate on
+ *
+ * @param[in] layout
+ * 	    Specifies if the matrix is stored in row major or column major
+ * 	    format:
+ * 	    - BblasRowMajor: Row major format
+ * 	    - BblasColMajor: Column major format
+ *
+ * @param[in] side
+ *          Specifies whether op( A[i] ) appears on the left or on the right of B[i]:
+ *          - BblasLeft:  alpha*op( A[i] )*B[i]
+ *          - BblasRight: alpha*B[i]*op( A[i] )
+ *
+ * @param[in] uplo
+ *          Specifies whether the matrices A[i]-s are upper triangular or lower
+ *          triangular:
+ *          - BblasUpper: Upper triangle of A[i] is stored;
+ *          - BblasLower: Lower triangle of A[i] is stored.
+ *
+ * @param[in] transa
+ *          Specifies whether the matrices A[i] are transposed, not transposed or
+ *          conjugate transposed:
+ *          - BblasNoTrans:   A[i]-s are transposed;
+ *          - BblasTrans:     A[i]-s are not transposed;
+ *          - BblasConjTrans: A[i]-s are conjugate transposed.
+ *
+ * @param[in] diag
+ *          Specifies whether or not A[i]-s are unit triangular:
+ *          - BblasNonUnit: A[i]-s are non-unit triangular;
+ *          - BblasUnit:    A[i]-s are unit triangular.
+ *
+ * @param[in] m
+ *          The number of rows of matrices B[i].
+ *          m >= 0.
+ *
+ * @param[in] n
+ *          The number of columns of matrices B[i].
+ *          n >= 0.
+ *
+ * @param[in] alpha
+ *          The scalar alpha.
+ *
+ * @param[in] A
+ * 		A is an array of pointers to matrices A[0], A[1] .. A[group_size-1], 
+ * 		where each element A[i] is a pointer to a triangular matrix 
+ *          	of dimension lda-by-k, where k is m when
+ *          	side='L' or 'l' and k is n when when side='R' or 'r'. If uplo =
+ *          	BblasUpper, the leading k-by-k upper triangular part of the array
+ *          	A[i] contains the upper triangular matrix, and the strictly lower
+ *          	triangular part of A[i] is not referenced. If uplo = BblasLower, the
+ *          	leading k-by-k lower triangular part of the array A[i] contains the
+ *          	lower triangular matrix, and the strictly upper triangular part of
+ *          	A[i] is not referenced. If diag = BblasUnit, the diagonal elements of
+ *          	A[i] are also not referenced and are assumed to be 1.
+ *
+ * @param[in] lda
+ *          The leading dimension of the arrays A[i]. When side='L' or 'l',
+ *          lda >= max(1,m), when side='R' or 'r' then lda >= max(1,n).
+ *
+ * @param[in] B
+ * 		B is an array of pointers to matrices B[0], B[1],..,B[group_size-1],
+ * 		where each element B[i] is a pointer to a matrix of dimension
+ * 		ldb-by-n.
+ *
+ * @param[in] ldb
+ *          The leading dimension of the arrays B[i]. ldb >= max(1,m).
+ *
+ * @param[out] C
+ * 		C is an array of pointers to matrices C[0], C[1],..,C[group_size-1],
+ * 		where each element C[i] is a pointer to a matrix of dimension
+ * 		ldc-by-n. On exit, the result of a triangular matrix-matrix multiply
+ *          	( alpha*op(A[i])*B[i] ) or ( alpha*B[i]*op(A[i]) ).
+ *
+ * @param[in] ldc
+ *          The leading dimension of the arrays C[i]. ldc >= max(1,m).
+ *
+ * @param[in,out] info
+ * 		Array of bblas_int for error handling. On entry info[0] should have one of the 
+ * 		following values
+ *			- BblasErrorsReportAll    :  All errors will be specified on output.
+ *						     Length of the array should be atleast
+ *						     \sum_{i=0}^{group_count-1}group_sizes[i]+1.
+ *			- BblasErrorsReportGroup  :  Single error from each group will be 
+ *						     reported. Length of the array should 
+ *						     be atleast group_count+1.
+ *			- BblasErrorsReportAny    :  Occurence of an error will be indicated
+ *						     by a single integer value, and length 
+ *						     of the array should be atleast 1.
+ *			- BblasErrorsReportNone   :  No error will be reported on output, and
+ *						     length of the array should be atleast 1.
+ ******************************************************************************
+ *
+ * @retval BblasSuccess successful exit
+ *
+ *******************************************************************************
+ *
+ * @sa ztrmm_oop_batchf
+ * @sa ctrmm_oop_batchf
+ * @sa dtrmm_oop_batchf
+ * @sa strmm_oop_batchf
+ *
+ ******************************************************************************/
+void blas_ztrmm_oop_batchf(bblas_int group_size, bblas_enum_t layout, bblas_enum_t side,
+                           bblas_enum_t uplo, bblas_enum_t transa, bblas_enum_t diag,
+                           bblas_int m, bblas_int n,
+                           bblas_complex64_t alpha, bblas_complex64_t const *const *A, bblas_int lda,
+                                                    bblas_complex64_t const *const *B, bblas_int ldb,
+                                                    bblas_complex64_t             **C, bblas_int ldc,
+                           bblas_int *info)
+{
+
+	// Check input arguments 
+	if ((layout != BblasRowMajor) &&
+			(layout != BblasColMajor)) {
+		bblas_error("Illegal value of layout");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 1);
+		}
+		return;
+	}
+	if ((side != BblasLeft) && (side != BblasRight)) {
+		bblas_error("Illegal value of side");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 2);
+		}
+		return;
+	}
+	if ((uplo != BblasUpper) && (uplo != BblasLower)) {
+		bblas_error("Illegal value of uplo");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 3);
+		}
+		return;
+	}
+	if ((transa != BblasNoTrans) &&
+			(transa != BblasTrans) &&
+			(transa != BblasConjTrans)) {
+		bblas_error("Illegal value of transa");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 4);
+		}
+		return;
+	}
+	if ((diag != BblasNonUnit) && (diag != BblasUnit)) {
+		bblas_error("Illegal value of diag");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 5);
+		}
+		return;
+	}
+	if (m < 0) {
+		bblas_error("Illegal value of m");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 6);
+		}
+		return;
+	}
+	if (n < 0) {
+		bblas_error("Illegal value of n");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 7);
+		}
+		return;
+	}
+	bblas_int an; 
+	if (side == BblasLeft) {
+		an = m;
+	} 
+	else {
+		an = n;
+	}
+	if (lda < imax(1, an)) {
+		bblas_error("Illegal value of lda");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 8);
+		}
+		return;
+	}
+	// B[i] and C[i] are m-by-n, stored transposed in row major.
+	bblas_int bm = (layout == BblasRowMajor) ? n : m;
+	if (ldb < imax(1, bm)) {
+		bblas_error("Illegal value of ldb");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 9);
+		}
+		return;
+	}
+	if (ldc < imax(1, bm)) {
+		bblas_error("Illegal value of ldc");
+		if (info[0] != BblasErrorsReportNone) {
+			bblas_set_info(info[0], &info[0], group_size, 10);
+		}
+		return;
+	}
+
+	// With alpha = 0, C[i] := 0.
+	if (alpha == (bblas_complex64_t)0.0) {
+		core_zscale_batch(group_size, layout, BblasGeneral, m, n,
+		                  0.0, C, ldc);
+		// BblasSuccess
+		if (info[0] == BblasErrorsReportAll) {
+			for (bblas_int iter = 0; iter < group_size; iter++)
+				info[iter] = 0;
+		}
+		else {
+			info[0] = 0;
+		}
+		return;
+	}
+
+	// With a shared A, the B[i] and C[i] stored as consecutive blocks of
+	// two matrices (side by side if side = BblasLeft, on top of each other
+	// otherwise) make the group a single trmm.
+	if (group_size > 1 &&
+	    bblas_is_shared((const void *const *)A, group_size) &&
+	    bblas_is_coalesced(layout, side == BblasLeft, m, n,
+	                       (const void *const *)B, ldb,
+	                       sizeof(bblas_complex64_t), group_size) &&
+	    bblas_is_coalesced(layout, side == BblasLeft, m, n,
+	                       (const void *const *)C, ldc,
+	                       sizeof(bblas_complex64_t), group_size)) {
+		bblas_int mm = (side == BblasLeft) ? m : m*group_size;
+		bblas_int nn = (side == BblasLeft) ? n*group_size : n;
+		copy_b_to_c(layout, mm, nn, B[0], ldb, C[0], ldc);
+		cblas_ztrmm(layout, side, uplo,
+		            transa, diag,
+		            mm, nn,
+		            CBLAS_SADDR(alpha), A[0], lda,
+		                                C[0], ldc);
+		// BblasSuccess
+		if (info[0] == BblasErrorsReportAll) {
+			for (bblas_int iter = 0; iter < group_size; iter++)
+				info[iter] = 0;
+		}
+		else {
+			info[0] = 0;
+		}
+		return;
+	}
+
+	// Small matrices go through the native kernel, which reads B[i] and
+	// writes C[i] directly. Larger ones copy B[i] into C[i] while it is
+	// still in cache and let CBLAS work in place on C[i].
+	bblas_int small = (imax(m, n) <= BBLAS_SMALL_TRMM);
+
+	// Aligned groups, checked once here, use the aligned variant of the
+	// kernel: whole vector columns of B and C (and of A on the left in
+	// column major).
+	bblas_int rows = (layout == BblasColMajor) ? m : n;
+	bool left = ((side == BblasLeft) == (layout == BblasColMajor));
+	bool aligned = small &&
+	    rows % (BBLAS_SIMD_ALIGN/sizeof(bblas_complex64_t)) == 0 &&
+	    bblas_is_aligned((const void *const *)B, group_size, ldb,
+	                     sizeof(bblas_complex64_t)) &&
+	    bblas_is_aligned((const void *const *)C, group_size, ldc,
+	                     sizeof(bblas_complex64_t)) &&
+	    (!left || bblas_is_aligned((const void *const *)A, group_size, lda,
+	                               sizeof(bblas_complex64_t)));
+
+	// Operands of the next matrices are prefetched while computing
+	// the current one.
+	int dist;
+	bblas_get(BblasTunePrefetch, &dist);
+	for (bblas_int iter = 0; iter < group_size; iter++) {
+		bblas_prefetch_next(iter, dist, group_size, layout, an, an,
+		                    (const void *const *)A, lda,
+		                    sizeof(bblas_complex64_t), false);
+		bblas_prefetch_next(iter, dist, group_size, layout, m, n,
+		                    (const void *const *)B, ldb,
+		                    sizeof(bblas_complex64_t), false);
+		bblas_prefetch_next(iter, dist, group_size, layout, m, n,
+		                    (const void *const *)C, ldc,
+		                    sizeof(bblas_complex64_t), true);
+		if (aligned) {
+			core_ztrmm_aligned(layout, side, uplo,
+			                   transa, diag,
+			                   m, n,
+			                   alpha, A[iter], lda,
+			                          B[iter], ldb,
+			                          C[iter], ldc);
+		}
+		else if (small) {
+			core_ztrmm(layout, side, uplo,
+				   transa, diag,
+				   m, n,
+				   alpha, A[iter], lda,
+				   	  B[iter], ldb,
+				   	  C[iter], ldc);
+		}
+		else {
+			copy_b_to_c(layout, m, n, B[iter], ldb, C[iter], ldc);
+			cblas_ztrmm(layout, side, uplo,
+				    transa, diag,
+				    m, n,
+				    CBLAS_SADDR(alpha), A[iter], lda,
+				    			C[iter], ldc);
+		}
+		// BblasSuccess
+		if (info[0] == BblasErrorsReportAll)
+			info[iter] = 0;
+	}
+	// BblasSuccess
+	if (info[0] != BblasErrorsReportAll)
+		info[0] = 0;
+}
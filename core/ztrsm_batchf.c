@@ -103,7 +103,7 @@
  *          The leading dimension of the array B. ldb >= max(1,m).
  *
  * @param[in,out] info
- * 		Array of int for error handling. On entry info[0] should have one of the 
+ * 		Array of bblas_int for error handling. On entry info[0] should have one of the 
  * 		following values
  *			- BblasErrorsReportAll    :  All errors will be specified on output.
  *						     Length of the array should be atleast
@@ -128,12 +128,12 @@
  * @sa strsm_batchf
  *
  ******************************************************************************/
-void blas_ztrsm_batchf(int group_size, bblas_enum_t layout, bblas_enum_t side,
+void blas_ztrsm_batchf(bblas_int group_size, bblas_enum_t layout, bblas_enum_t side,
                        bblas_enum_t uplo, bblas_enum_t transa, bblas_enum_t diag,
-                       int m, int n, 
-                       bblas_complex64_t alpha, bblas_complex64_t const *const *A, int lda,
-                                                bblas_complex64_t             **B, int ldb,
-                       int *info)
+                       bblas_int m, bblas_int n, 
+                       bblas_complex64_t alpha, bblas_complex64_t const *const *A, bblas_int lda,
+                                                bblas_complex64_t             **B, bblas_int ldb,
+                       bblas_int *info)
 {
 	// Check input arguments 
 	if ((layout != BblasRowMajor) &&
@@ -188,7 +188,7 @@ void blas_ztrsm_batchf(int group_size, bblas_enum_t layout, bblas_enum_t side,
 		}
 		return;
 	}
-    int an;
+    bblas_int an;
 	if (side == BblasLeft) {
 		an = m;
 	} 
@@ -202,14 +202,68 @@ void blas_ztrsm_batchf(int group_size, bblas_enum_t layout, bblas_enum_t side,
         }
         return;
     }
-    if (ldb < imax(1, m)) {
+    // B[i] is m-by-n, stored transposed in row major.
+    bblas_int bm = (layout == BblasRowMajor) ? n : m;
+    if (ldb < imax(1, bm)) {
         bblas_error("Illegal value of ldb");
         if (info[0] != BblasErrorsReportNone) {
             bblas_set_info(info[0], &info[0], group_size, 9);
         }
         return;
     }
-    for (int iter = 0; iter < group_size; iter++) {
+
+	// With alpha = 0, B[i] := 0.
+	if (alpha == (bblas_complex64_t)0.0) {
+		core_zscale_batch(group_size, layout, BblasGeneral, m, n,
+		                  0.0, B, ldb);
+		// BblasSuccess
+		if (info[0] == BblasErrorsReportAll) {
+			for (bblas_int iter = 0; iter < group_size; iter++)
+				info[iter] = 0;
+		}
+		else {
+			info[0] = 0;
+		}
+		return;
+	}
+
+	// With a shared A, the B[i] stored as consecutive blocks of one matrix
+	// (side by side if side = BblasLeft, on top of each other otherwise)
+	// make the group a single trsm.
+	if (group_size > 1 &&
+	    bblas_is_shared((const void *const *)A, group_size) &&
+	    bblas_is_coalesced(layout, side == BblasLeft, m, n,
+	                       (const void *const *)B, ldb,
+	                       sizeof(bblas_complex64_t), group_size)) {
+		bblas_int mm = (side == BblasLeft) ? m : m*group_size;
+		bblas_int nn = (side == BblasLeft) ? n*group_size : n;
+		cblas_ztrsm(layout, side, uplo,
+		            transa, diag,
+		            mm, nn,
+		            CBLAS_SADDR(alpha), A[0], lda,
+		                                B[0], ldb);
+		// BblasSuccess
+		if (info[0] == BblasErrorsReportAll) {
+			for (bblas_int iter = 0; iter < group_size; iter++)
+				info[iter] = 0;
+		}
+		else {
+			info[0] = 0;
+		}
+		return;
+	}
+
+	// Operands of the next matrices are prefetched while computing
+	// the current one.
+	int dist;
+	bblas_get(BblasTunePrefetch, &dist);
+    for (bblas_int iter = 0; iter < group_size; iter++) {
+		bblas_prefetch_next(iter, dist, group_size, layout, an, an,
+		                    (const void *const *)A, lda,
+		                    sizeof(bblas_complex64_t), false);
+		bblas_prefetch_next(iter, dist, group_size, layout, m, n,
+		                    (const void *const *)B, ldb,
+		                    sizeof(bblas_complex64_t), true);
 	    cblas_ztrsm(layout, side, uplo,
 			transa, diag,
 			m, n,
@@ -16,5 +16,11 @@
 #include "bblas_s.h"
 #include "bblas_d.h"
 #include "bblas_c.h"
+#include "bblas_ds.h"
+#include "bblas_zc.h"
+#include "bblas_sh.h"
+#include "bblas_sb.h"
+#include "bblas_sc.h"
+#include "bblas_dz.h"
 #include "bblas_error.h"
 #endif        // BBLAS_H
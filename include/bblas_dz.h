@@ -0,0 +1,33 @@
+/**
+ *
+ * @file
+ *
+ *  BBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions realcomplex dz -> sc
+ **/
+
+#ifndef BBLAS_DZ_H
+#define BBLAS_DZ_H
+
+#include "core_dz.h"
+
+void blas_dzgemm_batch(bblas_int group_count, const bblas_int *group_sizes,
+                       bblas_enum_t layout, const bblas_enum_t *transa, const bblas_enum_t *transb,
+                       const bblas_int *m, const bblas_int *n, const bblas_int *k,
+                       const bblas_complex64_t *alpha, double            const *const *A, const bblas_int *lda,
+                                                       bblas_complex64_t const *const *B, const bblas_int *ldb,
+                       const bblas_complex64_t *beta,  bblas_complex64_t             **C, const bblas_int *ldc,
+                       bblas_int *info);
+
+void blas_zdgemm_batch(bblas_int group_count, const bblas_int *group_sizes,
+                       bblas_enum_t layout, const bblas_enum_t *transa, const bblas_enum_t *transb,
+                       const bblas_int *m, const bblas_int *n, const bblas_int *k,
+                       const bblas_complex64_t *alpha, bblas_complex64_t const *const *A, const bblas_int *lda,
+                                                       double            const *const *B, const bblas_int *ldb,
+                       const bblas_complex64_t *beta,  bblas_complex64_t             **C, const bblas_int *ldc,
+                       bblas_int *info);
+
+#endif // BBLAS_DZ_H
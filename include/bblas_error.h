@@ -69,11 +69,11 @@ static inline void bblas_fatal_error_func_line_file(
     exit(EXIT_FAILURE);
 }
 
-static inline void bblas_set_info(int error_flag, int *info,
-                                  int batch_count, int code) {
+static inline void bblas_set_info(bblas_int error_flag, bblas_int *info,
+                                  bblas_int batch_count, bblas_int code) {
     switch (error_flag) {
     case BblasErrorsReportAll :
-        for( int i=0; i < batch_count; i++) {
+        for( bblas_int i=0; i < batch_count; i++) {
             info[i] = code;
         }
         break;
@@ -89,11 +89,11 @@ static inline void bblas_set_info(int error_flag, int *info,
     }
 }
 
-static inline void bblas_success(int error_flag, int *info,
-                                  int batch_count) {
+static inline void bblas_success(bblas_int error_flag, bblas_int *info,
+                                  bblas_int batch_count) {
     switch (error_flag) {
     case BblasErrorsReportAll :
-        for( int i=0; i < batch_count; i++) {
+        for( bblas_int i=0; i < batch_count; i++) {
             info[i] = 0;
         }
         break;
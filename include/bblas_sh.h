@@ -0,0 +1,25 @@
+/**
+ *
+ * @file
+ *
+ *  BBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions half sh -> sb
+ **/
+
+#ifndef BBLAS_SH_H
+#define BBLAS_SH_H
+
+#include "core_sh.h"
+
+void blas_shgemm_batch(bblas_int group_count, const bblas_int *group_sizes,
+                       bblas_enum_t layout, const bblas_enum_t *transa, const bblas_enum_t *transb,
+                       const bblas_int *m, const bblas_int *n, const bblas_int *k,
+                       const float *alpha, bblas_half_t const *const *A, const bblas_int *lda,
+                                           bblas_half_t const *const *B, const bblas_int *ldb,
+                       const float *beta,  float                   **C, const bblas_int *ldc,
+                       bblas_int *info);
+
+#endif // BBLAS_SH_H
@@ -12,6 +12,9 @@
 #define BBLAS_TYPES_H
 
 #include <complex.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -52,6 +55,7 @@ enum {
     BblasTrans         = 112,
     BblasConjTrans     = 113,
     Bblas_ConjTrans    = BblasConjTrans,
+    BblasConjNoTrans   = 114,
 
     BblasUpper         = 121,
     BblasLower         = 122,
@@ -80,12 +84,19 @@ enum {
     BblasRowwise       = 402,
 
     BblasW             = 501,
-    BblasA2            = 502
+    BblasA2            = 502,
+
+    BblasTuneGemm3M    = 601,
+    BblasTunePrefetch  = 602,
+    BblasTuneStream    = 603
 };
 
 enum {
     BblasSuccess = 0,
-    BblasFail
+    BblasFail,
+    BblasErrorOutOfMemory = -101,
+    BblasErrorSingular = -102,
+    BblasErrorNotPositiveDefinite = -103
 };
 
 enum {
@@ -96,11 +107,25 @@ enum {
 };
 
 /******************************************************************************/
+// The integer type of the interface: dimensions, group sizes, offsets and
+// info. With -DBBLAS_ILP64 it has 64 bits, for batches of more than 2^31
+// matrices or elements, and BBLAS is to be linked with an ILP64 BLAS.
+#if defined(BBLAS_ILP64)
+typedef int64_t bblas_int;
+#else
+typedef int bblas_int;
+#endif
+
 typedef int bblas_enum_t;
 
 typedef float  _Complex bblas_complex32_t;
 typedef double _Complex bblas_complex64_t;
 
+// 16-bit floating point numbers are stored as their bit patterns
+// and converted in software.
+typedef uint16_t bblas_half_t;      ///< IEEE 754 binary16 (fp16)
+typedef uint16_t bblas_bfloat16_t;  ///< bfloat16 (bf16)
+
 /******************************************************************************/
 bblas_enum_t bblas_diag_const(char lapack_char);
 bblas_enum_t bblas_direct_const(char lapack_char);
@@ -112,7 +137,29 @@ bblas_enum_t bblas_uplo_const(char lapack_char);
 bblas_enum_t bblas_info_const(char lapack_char);
 
 /******************************************************************************/
-static inline int imin(int a, int b)
+int bblas_set(bblas_enum_t param, int value);
+int bblas_get(bblas_enum_t param, int *value);
+
+/******************************************************************************/
+// Handle to a batch of operands packed by a *_pack_batch routine.
+typedef struct bblas_packed_s *bblas_packed_t;
+
+void bblas_packed_free(bblas_packed_t packed);
+
+/******************************************************************************/
+// Handle to the arena of a batch allocated by bblas_batch_alloc.
+typedef struct bblas_arena_s *bblas_arena_t;
+
+bblas_arena_t bblas_batch_alloc(bblas_int group_count, const bblas_int *group_sizes,
+                                bblas_int count, const bblas_int *const *ld,
+                                const bblas_int *const *cols, const size_t *size,
+                                void **const *X);
+void bblas_batch_free(bblas_arena_t arena);
+void bblas_advise_ld(bblas_int group_count, const bblas_int *cols, size_t size,
+                     bblas_int *ld);
+
+/******************************************************************************/
+static inline bblas_int imin(bblas_int a, bblas_int b)
 {
     if (a < b)
         return a;
@@ -121,7 +168,7 @@ static inline int imin(int a, int b)
 }
 
 /******************************************************************************/
-static inline int imax(int a, int b)
+static inline bblas_int imax(bblas_int a, bblas_int b)
 {
     if (a > b)
         return a;
@@ -129,6 +176,80 @@ static inline int imax(int a, int b)
         return b;
 }
 
+/***************************************************************************//**
+ *  Converts an fp16 number to float. The conversion is exact.
+ **/
+static inline float bblas_h2s(bblas_half_t h)
+{
+    union { uint32_t u; float f; } v;
+    uint32_t sign = (uint32_t)(h & 0x8000) << 16;
+    uint32_t expo = (h >> 10) & 0x1f;
+    uint32_t mant = h & 0x3ff;
+    if (expo == 0x1f) {
+        // inf or nan
+        v.u = sign | 0x7f800000 | (mant << 13);
+    }
+    else if (expo != 0) {
+        // normal: rebias the exponent from 15 to 127
+        v.u = sign | ((expo + 112) << 23) | (mant << 13);
+    }
+    else {
+        // zero or subnormal: mant * 2^-24
+        v.f = (float)mant * 5.9604644775390625e-8f;
+        v.u |= sign;
+    }
+    return v.f;
+}
+
+/***************************************************************************//**
+ *  Converts a float to fp16, rounding to nearest even.
+ **/
+static inline bblas_half_t bblas_s2h(float s)
+{
+    union { float f; uint32_t u; } v = { s };
+    uint32_t sign = (v.u >> 16) & 0x8000;
+    uint32_t absu = v.u & 0x7fffffff;
+    if (absu >= 0x7f800000) {
+        // inf or nan; keep nan quiet
+        return (bblas_half_t)(sign | 0x7c00 | (absu > 0x7f800000 ? 0x200 : 0));
+    }
+    if (absu >= 0x477ff000) {
+        // |s| >= 65520 rounds to inf
+        return (bblas_half_t)(sign | 0x7c00);
+    }
+    if (absu < 0x38800000) {
+        // |s| < 2^-14: subnormal in fp16, in units of 2^-24
+        v.u = absu;
+        return (bblas_half_t)(sign | (uint32_t)nearbyintf(v.f*16777216.0f));
+    }
+    absu += 0xfff + ((absu >> 13) & 1);
+    return (bblas_half_t)(sign | ((absu - 0x38000000) >> 13));
+}
+
+/***************************************************************************//**
+ *  Converts a bf16 number to float. The conversion is exact.
+ **/
+static inline float bblas_b2s(bblas_bfloat16_t b)
+{
+    union { uint32_t u; float f; } v;
+    v.u = (uint32_t)b << 16;
+    return v.f;
+}
+
+/***************************************************************************//**
+ *  Converts a float to bf16, rounding to nearest even.
+ **/
+static inline bblas_bfloat16_t bblas_s2b(float s)
+{
+    union { float f; uint32_t u; } v = { s };
+    if ((v.u & 0x7fffffff) > 0x7f800000) {
+        // nan; keep it quiet
+        return (bblas_bfloat16_t)((v.u >> 16) | 0x40);
+    }
+    v.u += 0x7fff + ((v.u >> 16) & 1);
+    return (bblas_bfloat16_t)(v.u >> 16);
+}
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
@@ -14,73 +14,427 @@
 
 #include "core_z.h"
 
-void blas_zgemm_batch(int group_count, const int *group_sizes,
+void blas_zgemm_batch(bblas_int group_count, const bblas_int *group_sizes,
                       bblas_enum_t layout, const bblas_enum_t *transa, const bblas_enum_t *transb,
-                      const int *m, const int *n, const int *k,
-                      const bblas_complex64_t *alpha, bblas_complex64_t const *const *A, const int *lda,
-                                                      bblas_complex64_t const* const *B, const int *ldb,
-                      const bblas_complex64_t *beta,  bblas_complex64_t            ** C, const int *ldc,
-                      int *info);
+                      const bblas_int *m, const bblas_int *n, const bblas_int *k,
+                      const bblas_complex64_t *alpha, bblas_complex64_t const *const *A, const bblas_int *lda,
+                                                      bblas_complex64_t const* const *B, const bblas_int *ldb,
+                      const bblas_complex64_t *beta,  bblas_complex64_t            ** C, const bblas_int *ldc,
+                      bblas_int *info);
 
-void blas_zhemm_batch( int group_count, const int *group_sizes,
+void blas_zgemm_vscal_batch(bblas_int group_count, const bblas_int *group_sizes,
+                            bblas_enum_t layout, const bblas_enum_t *transa, const bblas_enum_t *transb,
+                            const bblas_int *m, const bblas_int *n, const bblas_int *k,
+                            const bblas_complex64_t *alpha, bblas_complex64_t const *const *A, const bblas_int *lda,
+                                                            bblas_complex64_t const* const *B, const bblas_int *ldb,
+                            const bblas_complex64_t *beta,  bblas_complex64_t            ** C, const bblas_int *ldc,
+                            bblas_int *info);
+
+void blas_zhemm_batch( bblas_int group_count, const bblas_int *group_sizes,
                        bblas_enum_t layout, const bblas_enum_t *side, const bblas_enum_t *uplo,
-                       const int *m, const int *n, 
-                       const bblas_complex64_t *alpha, bblas_complex64_t const *const *A, const int *lda,
-                                                       bblas_complex64_t const* const *B, const int *ldb,
-                       const bblas_complex64_t *beta,  bblas_complex64_t            ** C, const int *ldc,
-                       int *info);
+                       const bblas_int *m, const bblas_int *n, 
+                       const bblas_complex64_t *alpha, bblas_complex64_t const *const *A, const bblas_int *lda,
+                                                       bblas_complex64_t const* const *B, const bblas_int *ldb,
+                       const bblas_complex64_t *beta,  bblas_complex64_t            ** C, const bblas_int *ldc,
+                       bblas_int *info);
 
-void blas_zher2k_batch( int group_count, const int *group_sizes,
+void blas_zher2k_batch( bblas_int group_count, const bblas_int *group_sizes,
                         bblas_enum_t layout, const bblas_enum_t *uplo, const bblas_enum_t *trans,
-                        const int *n, const int *k, 
-                        const bblas_complex64_t *alpha, bblas_complex64_t const *const *A, const int *lda,
-                                                        bblas_complex64_t const* const *B, const int *ldb,
-                        const double  *beta,            bblas_complex64_t            ** C, const int *ldc,
-                        int *info);
+                        const bblas_int *n, const bblas_int *k, 
+                        const bblas_complex64_t *alpha, bblas_complex64_t const *const *A, const bblas_int *lda,
+                                                        bblas_complex64_t const* const *B, const bblas_int *ldb,
+                        const double  *beta,            bblas_complex64_t            ** C, const bblas_int *ldc,
+                        bblas_int *info);
 
-void blas_zherk_batch( int group_count, const int *group_sizes,
+void blas_zherk_batch( bblas_int group_count, const bblas_int *group_sizes,
                        bblas_enum_t layout, const bblas_enum_t *uplo, const bblas_enum_t *trans,
-                       const int *n, const int *k, 
-                       const double *alpha, bblas_complex64_t const *const *A, const int *lda,
-                       const double  *beta, bblas_complex64_t            ** C, const int *ldc,
-                       int *info);
+                       const bblas_int *n, const bblas_int *k, 
+                       const double *alpha, bblas_complex64_t const *const *A, const bblas_int *lda,
+                       const double  *beta, bblas_complex64_t            ** C, const bblas_int *ldc,
+                       bblas_int *info);
 
-void blas_zsymm_batch( int group_count, const int *group_sizes,
+void blas_zsymm_batch( bblas_int group_count, const bblas_int *group_sizes,
                        bblas_enum_t layout, const bblas_enum_t *side, const bblas_enum_t *uplo,
-                       const int *m, const int *n, 
-                       const bblas_complex64_t *alpha, bblas_complex64_t const *const *A, const int *lda,
-                                                       bblas_complex64_t const* const *B, const int *ldb,
-                       const bblas_complex64_t *beta,  bblas_complex64_t            ** C, const int *ldc,
-                       int *info);
+                       const bblas_int *m, const bblas_int *n, 
+                       const bblas_complex64_t *alpha, bblas_complex64_t const *const *A, const bblas_int *lda,
+                                                       bblas_complex64_t const* const *B, const bblas_int *ldb,
+                       const bblas_complex64_t *beta,  bblas_complex64_t            ** C, const bblas_int *ldc,
+                       bblas_int *info);
 
-void blas_zsyr2k_batch( int group_count, const int *group_sizes,
+void blas_zsyr2k_batch( bblas_int group_count, const bblas_int *group_sizes,
                         bblas_enum_t layout, const bblas_enum_t *uplo, const bblas_enum_t *trans,
-                        const int *n, const int *k,
-                        const bblas_complex64_t *alpha, bblas_complex64_t const *const *A, const int *lda,
-                                                        bblas_complex64_t const* const *B, const int *ldb,
-                        const bblas_complex64_t  *beta, bblas_complex64_t            ** C, const int *ldc,
-                        int *info);
+                        const bblas_int *n, const bblas_int *k,
+                        const bblas_complex64_t *alpha, bblas_complex64_t const *const *A, const bblas_int *lda,
+                                                        bblas_complex64_t const* const *B, const bblas_int *ldb,
+                        const bblas_complex64_t  *beta, bblas_complex64_t            ** C, const bblas_int *ldc,
+                        bblas_int *info);
 
-void blas_zsyrk_batch( int group_count, const int *group_sizes,
+void blas_zsyrk_batch( bblas_int group_count, const bblas_int *group_sizes,
                        bblas_enum_t layout, const bblas_enum_t *uplo, const bblas_enum_t *trans,
-                       const int *n, const int *k,
-		      const bblas_complex64_t *alpha, bblas_complex64_t const *const *A, const int *lda, 
-		      const bblas_complex64_t  *beta, bblas_complex64_t		   ** C, const int *ldc, 
-                       int *info);
+                       const bblas_int *n, const bblas_int *k,
+		      const bblas_complex64_t *alpha, bblas_complex64_t const *const *A, const bblas_int *lda, 
+		      const bblas_complex64_t  *beta, bblas_complex64_t		   ** C, const bblas_int *ldc, 
+                       bblas_int *info);
 
-void blas_ztrmm_batch( int group_count, const int *group_sizes,
+void blas_ztrmm_batch( bblas_int group_count, const bblas_int *group_sizes,
                        bblas_enum_t layout, const bblas_enum_t *side, const bblas_enum_t *uplo,
                        const bblas_enum_t *transa, const bblas_enum_t *diag,
-                       const int *m, const int *n,
-                       const bblas_complex64_t *alpha, bblas_complex64_t const *const *A, const int *lda,
-                                                                   bblas_complex64_t **B, int const *ldb,
-                       int *info);
+                       const bblas_int *m, const bblas_int *n,
+                       const bblas_complex64_t *alpha, bblas_complex64_t const *const *A, const bblas_int *lda,
+                                                                   bblas_complex64_t **B, bblas_int const *ldb,
+                       bblas_int *info);
+
+void blas_ztrmm_oop_batch( bblas_int group_count, const bblas_int *group_sizes,
+                           bblas_enum_t layout, const bblas_enum_t *side, const bblas_enum_t *uplo,
+                           const bblas_enum_t *transa, const bblas_enum_t *diag,
+                           const bblas_int *m, const bblas_int *n,
+                           const bblas_complex64_t *alpha, bblas_complex64_t const *const *A, const bblas_int *lda,
+                                                           bblas_complex64_t const *const *B, const bblas_int *ldb,
+                                                           bblas_complex64_t            **C, const bblas_int *ldc,
+                           bblas_int *info);
 
-void blas_ztrsm_batch(int group_count, const int *group_sizes,
+void blas_ztrsm_batch(bblas_int group_count, const bblas_int *group_sizes,
                       bblas_enum_t layout, const bblas_enum_t *side, const bblas_enum_t *uplo,
                       const bblas_enum_t *transa, const bblas_enum_t *diag,
-                      const int *m, const int *n,
-                      const bblas_complex64_t *alpha, bblas_complex64_t const *const *A, const int *lda,
-                                                      bblas_complex64_t             **B, const int *ldb,
-                      int *info);
+                      const bblas_int *m, const bblas_int *n,
+                      const bblas_complex64_t *alpha, bblas_complex64_t const *const *A, const bblas_int *lda,
+                                                      bblas_complex64_t             **B, const bblas_int *ldb,
+                      bblas_int *info);
+
+/******************************************************************************/
+void blas_zgbmv_batch(bblas_int group_count, const bblas_int *group_sizes,
+                      bblas_enum_t layout, const bblas_enum_t *trans,
+                      const bblas_int *m, const bblas_int *n,
+                      const bblas_int *kl, const bblas_int *ku,
+                      const bblas_complex64_t *alpha, bblas_complex64_t const *const *A, const bblas_int *lda,
+                                                      bblas_complex64_t const *const *x, const bblas_int *incx,
+                      const bblas_complex64_t *beta,  bblas_complex64_t            **y, const bblas_int *incy,
+                      bblas_int *info);
+
+void blas_zgbmm_batch(bblas_int group_count, const bblas_int *group_sizes,
+                      bblas_enum_t layout, const bblas_enum_t *transa,
+                      const bblas_int *m, const bblas_int *n, const bblas_int *k,
+                      const bblas_int *kl, const bblas_int *ku,
+                      const bblas_complex64_t *alpha, bblas_complex64_t const *const *A, const bblas_int *lda,
+                                                      bblas_complex64_t const* const *B, const bblas_int *ldb,
+                      const bblas_complex64_t *beta,  bblas_complex64_t            ** C, const bblas_int *ldc,
+                      bblas_int *info);
+
+void blas_zgbsv_batch(bblas_int group_count, const bblas_int *group_sizes,
+                      bblas_enum_t layout, const bblas_int *n,
+                      const bblas_int *kl, const bblas_int *ku, const bblas_int *nrhs,
+                      bblas_complex64_t **A, const bblas_int *lda, bblas_int **ipiv,
+                      bblas_complex64_t **B, const bblas_int *ldb,
+                      bblas_int *info);
+
+void blas_zgtsv_batch(bblas_int group_count, const bblas_int *group_sizes,
+                      bblas_enum_t layout, const bblas_int *n, const bblas_int *nrhs,
+                      bblas_complex64_t **dl, bblas_complex64_t **d, bblas_complex64_t **du,
+                      bblas_complex64_t **B, const bblas_int *ldb,
+                      bblas_int *info);
+
+void blas_zptsv_batch(bblas_int group_count, const bblas_int *group_sizes,
+                      bblas_enum_t layout, const bblas_int *n, const bblas_int *nrhs,
+                      double **d, bblas_complex64_t **e,
+                      bblas_complex64_t **B, const bblas_int *ldb,
+                      bblas_int *info);
+
+void blas_zlarft_batch(bblas_int group_count, const bblas_int *group_sizes,
+                       bblas_enum_t layout,
+                       const bblas_enum_t *direct, const bblas_enum_t *storev,
+                       const bblas_int *n, const bblas_int *k,
+                       bblas_complex64_t const *const *V, const bblas_int *ldv,
+                       bblas_complex64_t const *const *tau,
+                       bblas_complex64_t **T, const bblas_int *ldt,
+                       bblas_int *info);
+
+void blas_zlarfb_batch(bblas_int group_count, const bblas_int *group_sizes,
+                       bblas_enum_t layout,
+                       const bblas_enum_t *side, const bblas_enum_t *trans,
+                       const bblas_enum_t *direct, const bblas_enum_t *storev,
+                       const bblas_int *m, const bblas_int *n, const bblas_int *k,
+                       bblas_complex64_t const *const *V, const bblas_int *ldv,
+                       bblas_complex64_t const *const *T, const bblas_int *ldt,
+                       bblas_complex64_t **C, const bblas_int *ldc,
+                       bblas_int *info);
+
+void blas_zgeqrf_batch(bblas_int group_count, const bblas_int *group_sizes,
+                       bblas_enum_t layout, const bblas_int *m, const bblas_int *n,
+                       bblas_complex64_t **A, const bblas_int *lda,
+                       bblas_complex64_t **tau,
+                       bblas_int *info);
+
+void blas_zlange_batch(bblas_int group_count, const bblas_int *group_sizes,
+                       bblas_enum_t layout, const bblas_enum_t *norm,
+                       const bblas_int *m, const bblas_int *n,
+                       bblas_complex64_t const *const *A, const bblas_int *lda,
+                       double *values, bblas_int *info);
+
+void blas_zlanhe_batch(bblas_int group_count, const bblas_int *group_sizes,
+                       bblas_enum_t layout, const bblas_enum_t *norm,
+                       const bblas_enum_t *uplo, const bblas_int *n,
+                       bblas_complex64_t const *const *A, const bblas_int *lda,
+                       double *values, bblas_int *info);
+
+void blas_zlansy_batch(bblas_int group_count, const bblas_int *group_sizes,
+                       bblas_enum_t layout, const bblas_enum_t *norm,
+                       const bblas_enum_t *uplo, const bblas_int *n,
+                       bblas_complex64_t const *const *A, const bblas_int *lda,
+                       double *values, bblas_int *info);
+
+void blas_zlantr_batch(bblas_int group_count, const bblas_int *group_sizes,
+                       bblas_enum_t layout, const bblas_enum_t *norm,
+                       const bblas_enum_t *uplo, const bblas_enum_t *diag,
+                       const bblas_int *m, const bblas_int *n,
+                       bblas_complex64_t const *const *A, const bblas_int *lda,
+                       double *values, bblas_int *info);
+
+/******************************************************************************/
+bblas_int blas_zgemm_pack_batch(bblas_int group_count, const bblas_int *group_sizes,
+                                bblas_enum_t layout, const bblas_enum_t *transa,
+                                const bblas_int *m, const bblas_int *n, const bblas_int *k,
+                                const bblas_complex64_t *alpha, bblas_complex64_t const *const *A, const bblas_int *lda,
+                                bblas_packed_t *packed);
+
+void blas_zgemm_batch_packed(bblas_packed_t packed, const bblas_enum_t *transb,
+                             bblas_complex64_t const* const *B, const bblas_int *ldb,
+                             const bblas_complex64_t *beta, bblas_complex64_t **C, const bblas_int *ldc,
+                             bblas_int *info);
+
+/******************************************************************************/
+void blas_zgemm_vbatch(bblas_int batch_count,
+                       bblas_enum_t layout, bblas_enum_t transa, bblas_enum_t transb,
+                       const bblas_int *m, const bblas_int *n, const bblas_int *k,
+                       bblas_complex64_t alpha, bblas_complex64_t const *const *A, const bblas_int *lda,
+                                                bblas_complex64_t const *const *B, const bblas_int *ldb,
+                       bblas_complex64_t beta,  bblas_complex64_t             **C, const bblas_int *ldc,
+                       bblas_int *info);
+
+void blas_zhemm_vbatch(bblas_int batch_count,
+                       bblas_enum_t layout, bblas_enum_t side, bblas_enum_t uplo,
+                       const bblas_int *m, const bblas_int *n,
+                       bblas_complex64_t alpha, bblas_complex64_t const *const *A, const bblas_int *lda,
+                                                bblas_complex64_t const *const *B, const bblas_int *ldb,
+                       bblas_complex64_t beta,  bblas_complex64_t             **C, const bblas_int *ldc,
+                       bblas_int *info);
+
+void blas_zher2k_vbatch(bblas_int batch_count,
+                        bblas_enum_t layout, bblas_enum_t uplo, bblas_enum_t trans,
+                        const bblas_int *n, const bblas_int *k,
+                        bblas_complex64_t alpha, bblas_complex64_t const *const *A, const bblas_int *lda,
+                                                 bblas_complex64_t const *const *B, const bblas_int *ldb,
+                        double beta,             bblas_complex64_t             **C, const bblas_int *ldc,
+                        bblas_int *info);
+
+void blas_zherk_vbatch(bblas_int batch_count,
+                       bblas_enum_t layout, bblas_enum_t uplo, bblas_enum_t trans,
+                       const bblas_int *n, const bblas_int *k,
+                       double alpha, bblas_complex64_t const *const *A, const bblas_int *lda,
+                       double beta,  bblas_complex64_t             **C, const bblas_int *ldc,
+                       bblas_int *info);
+
+void blas_zsymm_vbatch(bblas_int batch_count,
+                       bblas_enum_t layout, bblas_enum_t side, bblas_enum_t uplo,
+                       const bblas_int *m, const bblas_int *n,
+                       bblas_complex64_t alpha, bblas_complex64_t const *const *A, const bblas_int *lda,
+                                                bblas_complex64_t const *const *B, const bblas_int *ldb,
+                       bblas_complex64_t beta,  bblas_complex64_t             **C, const bblas_int *ldc,
+                       bblas_int *info);
+
+void blas_zsyr2k_vbatch(bblas_int batch_count,
+                        bblas_enum_t layout, bblas_enum_t uplo, bblas_enum_t trans,
+                        const bblas_int *n, const bblas_int *k,
+                        bblas_complex64_t alpha, bblas_complex64_t const *const *A, const bblas_int *lda,
+                                                 bblas_complex64_t const *const *B, const bblas_int *ldb,
+                        bblas_complex64_t beta,  bblas_complex64_t             **C, const bblas_int *ldc,
+                        bblas_int *info);
+
+void blas_zsyrk_vbatch(bblas_int batch_count,
+                       bblas_enum_t layout, bblas_enum_t uplo, bblas_enum_t trans,
+                       const bblas_int *n, const bblas_int *k,
+                       bblas_complex64_t alpha, bblas_complex64_t const *const *A, const bblas_int *lda,
+                       bblas_complex64_t beta,  bblas_complex64_t             **C, const bblas_int *ldc,
+                       bblas_int *info);
+
+void blas_ztrmm_vbatch(bblas_int batch_count,
+                       bblas_enum_t layout, bblas_enum_t side, bblas_enum_t uplo,
+                       bblas_enum_t transa, bblas_enum_t diag,
+                       const bblas_int *m, const bblas_int *n,
+                       bblas_complex64_t alpha, bblas_complex64_t const *const *A, const bblas_int *lda,
+                                                bblas_complex64_t             **B, const bblas_int *ldb,
+                       bblas_int *info);
+
+void blas_ztrsm_vbatch(bblas_int batch_count,
+                       bblas_enum_t layout, bblas_enum_t side, bblas_enum_t uplo,
+                       bblas_enum_t transa, bblas_enum_t diag,
+                       const bblas_int *m, const bblas_int *n,
+                       bblas_complex64_t alpha, bblas_complex64_t const *const *A, const bblas_int *lda,
+                                                bblas_complex64_t             **B, const bblas_int *ldb,
+                       bblas_int *info);
+
+/******************************************************************************/
+void blas_zgemm_batch_offset(bblas_int group_count, const bblas_int *group_sizes,
+                             bblas_enum_t layout, const bblas_enum_t *transa, const bblas_enum_t *transb,
+                             const bblas_int *m, const bblas_int *n, const bblas_int *k,
+                             const bblas_complex64_t *alpha, const bblas_complex64_t *A, const bblas_int *offa, const bblas_int *lda,
+                                                             const bblas_complex64_t *B, const bblas_int *offb, const bblas_int *ldb,
+                             const bblas_complex64_t *beta,        bblas_complex64_t *C, const bblas_int *offc, const bblas_int *ldc,
+                             bblas_int *info);
+
+void blas_zhemm_batch_offset(bblas_int group_count, const bblas_int *group_sizes,
+                             bblas_enum_t layout, const bblas_enum_t *side, const bblas_enum_t *uplo,
+                             const bblas_int *m, const bblas_int *n,
+                             const bblas_complex64_t *alpha, const bblas_complex64_t *A, const bblas_int *offa, const bblas_int *lda,
+                                                             const bblas_complex64_t *B, const bblas_int *offb, const bblas_int *ldb,
+                             const bblas_complex64_t *beta,        bblas_complex64_t *C, const bblas_int *offc, const bblas_int *ldc,
+                             bblas_int *info);
+
+void blas_zher2k_batch_offset(bblas_int group_count, const bblas_int *group_sizes,
+                              bblas_enum_t layout, const bblas_enum_t *uplo, const bblas_enum_t *trans,
+                              const bblas_int *n, const bblas_int *k,
+                              const bblas_complex64_t *alpha, const bblas_complex64_t *A, const bblas_int *offa, const bblas_int *lda,
+                                                              const bblas_complex64_t *B, const bblas_int *offb, const bblas_int *ldb,
+                              const double *beta,                   bblas_complex64_t *C, const bblas_int *offc, const bblas_int *ldc,
+                              bblas_int *info);
+
+void blas_zherk_batch_offset(bblas_int group_count, const bblas_int *group_sizes,
+                             bblas_enum_t layout, const bblas_enum_t *uplo, const bblas_enum_t *trans,
+                             const bblas_int *n, const bblas_int *k,
+                             const double *alpha, const bblas_complex64_t *A, const bblas_int *offa, const bblas_int *lda,
+                             const double *beta,        bblas_complex64_t *C, const bblas_int *offc, const bblas_int *ldc,
+                             bblas_int *info);
+
+void blas_zsymm_batch_offset(bblas_int group_count, const bblas_int *group_sizes,
+                             bblas_enum_t layout, const bblas_enum_t *side, const bblas_enum_t *uplo,
+                             const bblas_int *m, const bblas_int *n,
+                             const bblas_complex64_t *alpha, const bblas_complex64_t *A, const bblas_int *offa, const bblas_int *lda,
+                                                             const bblas_complex64_t *B, const bblas_int *offb, const bblas_int *ldb,
+                             const bblas_complex64_t *beta,        bblas_complex64_t *C, const bblas_int *offc, const bblas_int *ldc,
+                             bblas_int *info);
+
+void blas_zsyr2k_batch_offset(bblas_int group_count, const bblas_int *group_sizes,
+                              bblas_enum_t layout, const bblas_enum_t *uplo, const bblas_enum_t *trans,
+                              const bblas_int *n, const bblas_int *k,
+                              const bblas_complex64_t *alpha, const bblas_complex64_t *A, const bblas_int *offa, const bblas_int *lda,
+                                                              const bblas_complex64_t *B, const bblas_int *offb, const bblas_int *ldb,
+                              const bblas_complex64_t *beta,        bblas_complex64_t *C, const bblas_int *offc, const bblas_int *ldc,
+                              bblas_int *info);
+
+void blas_zsyrk_batch_offset(bblas_int group_count, const bblas_int *group_sizes,
+                             bblas_enum_t layout, const bblas_enum_t *uplo, const bblas_enum_t *trans,
+                             const bblas_int *n, const bblas_int *k,
+                             const bblas_complex64_t *alpha, const bblas_complex64_t *A, const bblas_int *offa, const bblas_int *lda,
+                             const bblas_complex64_t *beta,        bblas_complex64_t *C, const bblas_int *offc, const bblas_int *ldc,
+                             bblas_int *info);
+
+void blas_ztrmm_batch_offset(bblas_int group_count, const bblas_int *group_sizes,
+                             bblas_enum_t layout, const bblas_enum_t *side, const bblas_enum_t *uplo,
+                             const bblas_enum_t *transa, const bblas_enum_t *diag,
+                             const bblas_int *m, const bblas_int *n,
+                             const bblas_complex64_t *alpha, const bblas_complex64_t *A, const bblas_int *offa, const bblas_int *lda,
+                                                                   bblas_complex64_t *B, const bblas_int *offb, const bblas_int *ldb,
+                             bblas_int *info);
+
+void blas_ztrsm_batch_offset(bblas_int group_count, const bblas_int *group_sizes,
+                             bblas_enum_t layout, const bblas_enum_t *side, const bblas_enum_t *uplo,
+                             const bblas_enum_t *transa, const bblas_enum_t *diag,
+                             const bblas_int *m, const bblas_int *n,
+                             const bblas_complex64_t *alpha, const bblas_complex64_t *A, const bblas_int *offa, const bblas_int *lda,
+                                                                   bblas_complex64_t *B, const bblas_int *offb, const bblas_int *ldb,
+                             bblas_int *info);
+
+/******************************************************************************/
+void blas_zgtsv_batch_strided(bblas_int n, bblas_int nrhs,
+                              bblas_complex64_t *dl, bblas_complex64_t *d, bblas_complex64_t *du,
+                              bblas_int inct, bblas_int stridet,
+                              bblas_complex64_t *B, bblas_int incb, bblas_int ldb,
+                              bblas_int strideb,
+                              bblas_int batch_count, bblas_int *info);
+
+void blas_zptsv_batch_strided(bblas_int n, bblas_int nrhs,
+                              double *d, bblas_complex64_t *e,
+                              bblas_int inct, bblas_int stridet,
+                              bblas_complex64_t *B, bblas_int incb, bblas_int ldb,
+                              bblas_int strideb,
+                              bblas_int batch_count, bblas_int *info);
+
+/******************************************************************************/
+void blas_zgemm_batch_layouts(bblas_int group_count, const bblas_int *group_sizes,
+                              const bblas_enum_t *layout, const bblas_enum_t *transa, const bblas_enum_t *transb,
+                              const bblas_int *m, const bblas_int *n, const bblas_int *k,
+                              const bblas_complex64_t *alpha, bblas_complex64_t const *const *A, const bblas_int *lda,
+                                                              bblas_complex64_t const* const *B, const bblas_int *ldb,
+                              const bblas_complex64_t *beta,  bblas_complex64_t            ** C, const bblas_int *ldc,
+                              bblas_int *info);
+
+void blas_zhemm_batch_layouts(bblas_int group_count, const bblas_int *group_sizes,
+                              const bblas_enum_t *layout, const bblas_enum_t *side, const bblas_enum_t *uplo,
+                              const bblas_int *m, const bblas_int *n,
+                              const bblas_complex64_t *alpha, bblas_complex64_t const *const *A, const bblas_int *lda,
+                                                              bblas_complex64_t const* const *B, const bblas_int *ldb,
+                              const bblas_complex64_t *beta,  bblas_complex64_t            ** C, const bblas_int *ldc,
+                              bblas_int *info);
+
+void blas_zher2k_batch_layouts(bblas_int group_count, const bblas_int *group_sizes,
+                               const bblas_enum_t *layout, const bblas_enum_t *uplo, const bblas_enum_t *trans,
+                               const bblas_int *n, const bblas_int *k,
+                               const bblas_complex64_t *alpha, bblas_complex64_t const *const *A, const bblas_int *lda,
+                                                               bblas_complex64_t const* const *B, const bblas_int *ldb,
+                               const double             *beta, bblas_complex64_t            ** C, const bblas_int *ldc,
+                               bblas_int *info);
+
+void blas_zherk_batch_layouts(bblas_int group_count, const bblas_int *group_sizes,
+                              const bblas_enum_t *layout, const bblas_enum_t *uplo, const bblas_enum_t *trans,
+                              const bblas_int *n, const bblas_int *k,
+                              const double *alpha, bblas_complex64_t const *const *A, const bblas_int *lda,
+                              const double  *beta, bblas_complex64_t            ** C, const bblas_int *ldc,
+                              bblas_int *info);
+
+void blas_zsymm_batch_layouts(bblas_int group_count, const bblas_int *group_sizes,
+                              const bblas_enum_t *layout, const bblas_enum_t *side, const bblas_enum_t *uplo,
+                              const bblas_int *m, const bblas_int *n,
+                              const bblas_complex64_t *alpha, bblas_complex64_t const *const *A, const bblas_int *lda,
+                                                              bblas_complex64_t const* const *B, const bblas_int *ldb,
+                              const bblas_complex64_t *beta,  bblas_complex64_t            ** C, const bblas_int *ldc,
+                              bblas_int *info);
+
+void blas_zsyr2k_batch_layouts(bblas_int group_count, const bblas_int *group_sizes,
+                               const bblas_enum_t *layout, const bblas_enum_t *uplo, const bblas_enum_t *trans,
+                               const bblas_int *n, const bblas_int *k,
+                               const bblas_complex64_t *alpha, bblas_complex64_t const *const *A, const bblas_int *lda,
+                                                               bblas_complex64_t const* const *B, const bblas_int *ldb,
+                               const bblas_complex64_t  *beta, bblas_complex64_t            ** C, const bblas_int *ldc,
+                               bblas_int *info);
+
+void blas_zsyrk_batch_layouts(bblas_int group_count, const bblas_int *group_sizes,
+                              const bblas_enum_t *layout, const bblas_enum_t *uplo, const bblas_enum_t *trans,
+                              const bblas_int *n, const bblas_int *k,
+                              const bblas_complex64_t *alpha, bblas_complex64_t const *const *A, const bblas_int *lda,
+                              const bblas_complex64_t  *beta, bblas_complex64_t            ** C, const bblas_int *ldc,
+                              bblas_int *info);
+
+void blas_ztrmm_batch_layouts(bblas_int group_count, const bblas_int *group_sizes,
+                              const bblas_enum_t *layout, const bblas_enum_t *side, const bblas_enum_t *uplo,
+                              const bblas_enum_t *transa, const bblas_enum_t *diag,
+                              const bblas_int *m, const bblas_int *n,
+                              const bblas_complex64_t *alpha, bblas_complex64_t const *const *A, const bblas_int *lda,
+                                                              bblas_complex64_t             **B, bblas_int const *ldb,
+                              bblas_int *info);
+
+void blas_ztrmm_oop_batch_layouts(bblas_int group_count, const bblas_int *group_sizes,
+                                  const bblas_enum_t *layout, const bblas_enum_t *side, const bblas_enum_t *uplo,
+                                  const bblas_enum_t *transa, const bblas_enum_t *diag,
+                                  const bblas_int *m, const bblas_int *n,
+                                  const bblas_complex64_t *alpha, bblas_complex64_t const *const *A, const bblas_int *lda,
+                                                                  bblas_complex64_t const *const *B, const bblas_int *ldb,
+                                                                  bblas_complex64_t            **C, const bblas_int *ldc,
+                                  bblas_int *info);
+
+void blas_ztrsm_batch_layouts(bblas_int group_count, const bblas_int *group_sizes,
+                              const bblas_enum_t *layout, const bblas_enum_t *side, const bblas_enum_t *uplo,
+                              const bblas_enum_t *transa, const bblas_enum_t *diag,
+                              const bblas_int *m, const bblas_int *n,
+                              const bblas_complex64_t *alpha, bblas_complex64_t const *const *A, const bblas_int *lda,
+                                                              bblas_complex64_t             **B, const bblas_int *ldb,
+                              bblas_int *info);
 #endif /* BBLAS_Z_H */
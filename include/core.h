@@ -10,6 +10,10 @@
 #ifndef CORE_BBLAS_H
 #define CORE_BBLAS_H
 
+#include <limits.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
 #include <stdio.h>
 
 #include "bblas_error.h"
@@ -35,8 +39,9 @@ static const char *lapack_constants[] = {
     "NoTrans",                              ///< 111: BblasNoTrans
     "Trans",                                ///< 112: BblasTrans
     "ConjTrans",                            ///< 113: BblasConjTrans
+    "R",                                    ///< 114: BblasConjNoTrans
 
-    "", "", "", "", "", "", "",
+    "", "", "", "", "", "",
     "Upper",                                ///< 121: BblasUpper
     "Lower",                                ///< 122: BblasLower
     "General",                              ///< 123: BblasGeneral
@@ -140,6 +145,257 @@ static inline char lapack_const(int bblas_const) {
 #define lapack_int int
 #endif
 
+// Pivots are passed to LAPACKE as they are, so bblas_int must be
+// lapack_int: an ILP64 build needs an ILP64 LAPACKE, -DLAPACK_ILP64.
+typedef char bblas_int_is_lapack_int[
+    (sizeof(bblas_int) == sizeof(lapack_int)) ? 1 : -1];
+
+/***************************************************************************//**
+ *  Tuning constants. They can be overridden at compile time,
+ *  e.g., -DBBLAS_SMALL_TRMM=32.
+ **/
+
+// Largest m and n for which the native trmm kernel is used instead of CBLAS.
+#ifndef BBLAS_SMALL_TRMM
+#define BBLAS_SMALL_TRMM 16
+#endif
+
+// Smallest m, n and k for which complex gemm uses the 3M algorithm,
+// when enabled with bblas_set(BblasTuneGemm3M, 1).
+#ifndef BBLAS_GEMM_3M_MIN
+#define BBLAS_GEMM_3M_MIN 32
+#endif
+
+// Largest number of columns (or rows) of the wide gemm into which a group
+// with a shared operand is gathered; operands at least this wide are
+// multiplied one by one.
+#ifndef BBLAS_SHARED_COLS
+#define BBLAS_SHARED_COLS 256
+#endif
+
+// Number of matrices whose pointers the *_batch_offset routines resolve
+// at a time, into arrays on the stack.
+#ifndef BBLAS_OFFSET_CHUNK
+#define BBLAS_OFFSET_CHUNK 64
+#endif
+
+// Number of tridiagonal systems solved together by the interleaved
+// gtsv and ptsv kernels, one per vector lane.
+#ifndef BBLAS_TRIDIAG_LANES
+#define BBLAS_TRIDIAG_LANES 16
+#endif
+
+// Largest number of elements of a matrix that geqrf factors unblocked, in
+// a contiguous copy that stays in L1; larger matrices are factored by
+// panels of BBLAS_GEQRF_NB columns and block reflector updates.
+#ifndef BBLAS_GEQRF_SMALL
+#define BBLAS_GEQRF_SMALL 2048
+#endif
+#ifndef BBLAS_GEQRF_NB
+#define BBLAS_GEQRF_NB 32
+#endif
+
+// Size in bytes of a cache line, to which packed operands are aligned.
+#ifndef BBLAS_CACHE_LINE
+#define BBLAS_CACHE_LINE 64
+#endif
+
+// Alignment in bytes of the widest vector loads, which the aligned
+// kernels assume of their operands.
+#ifndef BBLAS_SIMD_ALIGN
+#define BBLAS_SIMD_ALIGN 64
+#endif
+
+// Size in bytes and associativity of the L1 data cache, for the leading
+// dimensions advised by bblas_advise_ld.
+#ifndef BBLAS_L1_SIZE
+#define BBLAS_L1_SIZE (32*1024)
+#endif
+#ifndef BBLAS_L1_WAYS
+#define BBLAS_L1_WAYS 8
+#endif
+
+// Size in bytes of a huge page; bblas_batch_alloc maps arenas at least
+// this large directly, backed by huge pages.
+#ifndef BBLAS_HUGE_PAGE
+#define BBLAS_HUGE_PAGE (2*1024*1024)
+#endif
+
+/***************************************************************************//**
+ *  Whether op( X ) transposes X, i.e., for BblasTrans and BblasConjTrans,
+ *  but not for BblasNoTrans and BblasConjNoTrans.
+ **/
+static inline bool bblas_transposed(bblas_enum_t trans)
+{
+    return trans == BblasTrans || trans == BblasConjTrans;
+}
+
+/***************************************************************************//**
+ *  Pointer patterns of a group.
+ **/
+
+// Whether all the group_size pointers in X are the same.
+static inline bool bblas_is_shared(const void *const *X, bblas_int group_size)
+{
+    for (bblas_int i = 1; i < group_size; i++)
+        if (X[i] != X[0])
+            return false;
+    return true;
+}
+
+// Whether X[i] = X[0] + i*stride bytes for all i.
+static inline bool bblas_is_strided(const void *const *X, bblas_int group_size,
+                                    size_t stride)
+{
+    const char *x0 = (const char*)X[0];
+    for (bblas_int i = 1; i < group_size; i++)
+        if ((const char*)X[i] != x0 + i*stride)
+            return false;
+    return true;
+}
+
+// Whether the rows-by-cols matrices X[i], stored in the given layout with
+// leading dimension ldx and elements of the given size, are consecutive
+// blocks of one matrix: the rows-by-(cols*group_size) matrix
+// [X[0] X[1] ...] if side_by_side, the (rows*group_size)-by-cols matrix
+// [X[0]; X[1]; ...] otherwise. That matrix then has leading dimension ldx.
+static inline bool bblas_is_coalesced(bblas_enum_t layout, bool side_by_side,
+                                      bblas_int rows, bblas_int cols,
+                                      const void *const *X, bblas_int ldx,
+                                      size_t size, bblas_int group_size)
+{
+    // The dimension along which the blocks follow each other.
+    bblas_int dim = side_by_side ? cols : rows;
+    if ((size_t)dim*group_size > INT_MAX)
+        return false;
+
+    // Along the leading dimension, the blocks are ldx*dim elements apart;
+    // across it, dim elements apart, within ldx.
+    if (side_by_side == (layout == BblasColMajor))
+        return bblas_is_strided(X, group_size, (size_t)ldx*dim*size);
+    else
+        return (size_t)dim*group_size <= (size_t)ldx &&
+               bblas_is_strided(X, group_size, (size_t)dim*size);
+}
+
+// Whether the group_size matrices X[i], with leading dimension ldx and
+// elements of the given size, all start on a BBLAS_SIMD_ALIGN boundary
+// and ldx keeps every column (or row) on one.
+static inline bool bblas_is_aligned(const void *const *X, bblas_int group_size,
+                                    bblas_int ldx, size_t size)
+{
+    if ((size_t)ldx*size % BBLAS_SIMD_ALIGN != 0)
+        return false;
+    for (bblas_int i = 0; i < group_size; i++)
+        if ((uintptr_t)X[i] % BBLAS_SIMD_ALIGN != 0)
+            return false;
+    return true;
+}
+
+// Pointer p, which the compiler may assume aligned to BBLAS_SIMD_ALIGN.
+#if defined(__GNUC__)
+#define BBLAS_ASSUME_ALIGNED(p) __builtin_assume_aligned((p), BBLAS_SIMD_ALIGN)
+#else
+#define BBLAS_ASSUME_ALIGNED(p) (p)
+#endif
+
+/***************************************************************************//**
+ *  Prefetching of the operands of the next matrices of a group.
+ **/
+
+// Most bytes of each operand of a matrix prefetched ahead of its turn.
+#ifndef BBLAS_PREFETCH_BYTES
+#define BBLAS_PREFETCH_BYTES 4096
+#endif
+
+// Prefetches the leading BBLAS_PREFETCH_BYTES of the rows-by-cols matrix
+// X, stored in the given layout with leading dimension ldx and elements of
+// the given size, to be read, or written if write.
+static inline void bblas_prefetch(bblas_enum_t layout, bblas_int rows, bblas_int cols,
+                                  const void *X, bblas_int ldx, size_t size,
+                                  bool write)
+{
+#if defined(__GNUC__)
+    bblas_int lead  = (layout == BblasColMajor) ? rows : cols;
+    bblas_int other = (layout == BblasColMajor) ? cols : rows;
+    size_t left = BBLAS_PREFETCH_BYTES;
+    for (bblas_int j = 0; j < other && left > 0 && lead > 0; j++) {
+        const char *x = (const char*)X + (size_t)ldx*j*size;
+        size_t bytes = (size_t)lead*size;
+        if (bytes > left)
+            bytes = left;
+        left -= bytes;
+        for (size_t b = 0; b < bytes; b += BBLAS_CACHE_LINE) {
+            if (write)
+                __builtin_prefetch(x+b, 1, 3);
+            else
+                __builtin_prefetch(x+b, 0, 3);
+        }
+        // The last line, if x is not aligned.
+        if (write)
+            __builtin_prefetch(x+bytes-1, 1, 3);
+        else
+            __builtin_prefetch(x+bytes-1, 0, 3);
+    }
+#endif
+}
+
+// At iteration iter of a batchf loop, prefetches the matrix X[iter+dist]
+// and the pointer X[iter+2*dist], so that a later iteration finds them in
+// cache; the first iteration also prefetches X[1], ..., X[dist-1].
+// dist comes from bblas_get(BblasTunePrefetch); 0 disables prefetching.
+static inline void bblas_prefetch_next(bblas_int iter, bblas_int dist, bblas_int group_size,
+                                       bblas_enum_t layout, bblas_int rows, bblas_int cols,
+                                       const void *const *X, bblas_int ldx,
+                                       size_t size, bool write)
+{
+#if defined(__GNUC__)
+    if (dist <= 0)
+        return;
+    if (iter+2*dist < group_size)
+        __builtin_prefetch(&X[iter+2*dist], 0, 3);
+    bblas_int first = (iter == 0) ? 1 : iter+dist;
+    bblas_int last = imin(iter+dist, group_size-1);
+    for (bblas_int i = first; i <= last; i++)
+        bblas_prefetch(layout, rows, cols, X[i], ldx, size, write);
+#endif
+}
+
+/******************************************************************************/
+void bblas_stream(bblas_int rows, bblas_int cols, const void *W, bblas_int ldw,
+                  void *X, bblas_int ldx, size_t size);
+void bblas_stream_fence(void);
+
+/******************************************************************************/
+bblas_int bblas_bucket(bblas_int batch_count, bblas_int nkeys,
+                       const bblas_int *const *keys,
+                       bblas_int *perm, bblas_int *start);
+
+/***************************************************************************//**
+ *  Packed batch of gemm operands, behind the opaque bblas_packed_t.
+ **/
+struct bblas_packed_s {
+    const char *routine;    ///< "sgemm", "dgemm", "cgemm" or "zgemm"
+    bblas_enum_t layout;    ///< layout of the packed matrices
+    bool vendor;            ///< whether A holds the BLAS's own packed format
+    bblas_int group_count;
+    bblas_int batch_count;
+    bblas_int *group_sizes;       ///< group_count sizes
+    bblas_int *m;                 ///< group_count row counts of op( A[i] )
+    bblas_int *n;                 ///< group_count column counts of C[i]
+    bblas_int *k;                 ///< group_count column counts of op( A[i] )
+    bblas_int *ld;                ///< group_count leading dimensions of the copies
+    bool *zero;                   ///< group_count flags: alpha = 0, A not packed
+    void **A;               ///< batch_count packed matrices, in the pool
+    void *pool;             ///< cache line aligned storage of A
+};
+
+bblas_packed_t bblas_packed_create(const char *routine, bblas_enum_t layout,
+                                   bblas_int group_count, const bblas_int *group_sizes,
+                                   const bblas_int *m, const bblas_int *n,
+                                   const bblas_int *k, size_t size,
+                                   const size_t *bytes);
+
     
 #ifdef __cplusplus
 }  // extern "C"
@@ -149,6 +405,12 @@ static inline char lapack_const(int bblas_const) {
 #include "core_d.h"
 #include "core_c.h"
 #include "core_z.h"
+#include "core_ds.h"
+#include "core_zc.h"
+#include "core_sh.h"
+#include "core_sb.h"
+#include "core_sc.h"
+#include "core_dz.h"
 
 
 #endif // ICL_CORE_BLAS_H
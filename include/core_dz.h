@@ -0,0 +1,57 @@
+/**
+ *
+ * @file
+ *
+ *  BBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions realcomplex dz -> sc
+ *
+ **/
+#ifndef ICL_CORE_DZ_H
+#define ICL_CORE_DZ_H
+
+#include "bblas_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************/
+void blas_dzgemm_batchf(bblas_int group_size,
+                        bblas_enum_t layout, bblas_enum_t transa, bblas_enum_t transb,
+                        bblas_int m, bblas_int n, bblas_int k,
+                        bblas_complex64_t alpha, double            const *const *A, bblas_int lda,
+                                                 bblas_complex64_t const *const *B, bblas_int ldb,
+                        bblas_complex64_t beta,  bblas_complex64_t             **C, bblas_int ldc,
+                        bblas_int *info);
+
+void blas_zdgemm_batchf(bblas_int group_size,
+                        bblas_enum_t layout, bblas_enum_t transa, bblas_enum_t transb,
+                        bblas_int m, bblas_int n, bblas_int k,
+                        bblas_complex64_t alpha, bblas_complex64_t const *const *A, bblas_int lda,
+                                                 double            const *const *B, bblas_int ldb,
+                        bblas_complex64_t beta,  bblas_complex64_t             **C, bblas_int ldc,
+                        bblas_int *info);
+
+/******************************************************************************/
+void core_dzgemm(bblas_enum_t transa, bblas_enum_t transb,
+                 bblas_int m, bblas_int n, bblas_int k,
+                 bblas_complex64_t alpha, const double *A, bblas_int lda,
+                                          const bblas_complex64_t *B, bblas_int ldb,
+                 bblas_complex64_t beta,        bblas_complex64_t *C, bblas_int ldc,
+                 double *work);
+
+void core_zdgemm(bblas_enum_t transa, bblas_enum_t transb,
+                 bblas_int m, bblas_int n, bblas_int k,
+                 bblas_complex64_t alpha, const bblas_complex64_t *A, bblas_int lda,
+                                          const double *B, bblas_int ldb,
+                 bblas_complex64_t beta,        bblas_complex64_t *C, bblas_int ldc,
+                 double *work);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif // ICL_CORE_DZ_H
@@ -0,0 +1,34 @@
+/**
+ *
+ * @file
+ *
+ *  BBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions half sh -> sb
+ *
+ **/
+#ifndef ICL_CORE_SH_H
+#define ICL_CORE_SH_H
+
+#include "bblas_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************/
+void blas_shgemm_batchf(bblas_int group_size,
+                        bblas_enum_t layout, bblas_enum_t transa, bblas_enum_t transb,
+                        bblas_int m, bblas_int n, bblas_int k,
+                        float alpha, bblas_half_t const *const *A, bblas_int lda,
+                                     bblas_half_t const *const *B, bblas_int ldb,
+                        float beta,  float                   **C, bblas_int ldc,
+                        bblas_int *info);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif // ICL_CORE_SH_H
@@ -20,75 +20,293 @@ extern "C" {
 
 #define COMPLEX
 /******************************************************************************/
-void blas_zgemm_batchf (int group_size, 
+void blas_zgemm_batchf (bblas_int group_size, 
                         bblas_enum_t layout, bblas_enum_t transa, bblas_enum_t transb,
-                        int m,  int n, int k,
-                        bblas_complex64_t alpha, bblas_complex64_t const *const *A, int lda,
-                                                 bblas_complex64_t const* const *B, int ldb,
-                        bblas_complex64_t beta,  bblas_complex64_t            ** C, int ldc,
-                        int *info);
+                        bblas_int m,  bblas_int n, bblas_int k,
+                        bblas_complex64_t alpha, bblas_complex64_t const *const *A, bblas_int lda,
+                                                 bblas_complex64_t const* const *B, bblas_int ldb,
+                        bblas_complex64_t beta,  bblas_complex64_t            ** C, bblas_int ldc,
+                        bblas_int *info);
 
-void blas_zhemm_batchf(int group_size,
+void blas_zgemm_vscal_batchf(bblas_int group_size,
+                             bblas_enum_t layout, bblas_enum_t transa, bblas_enum_t transb,
+                             bblas_int m, bblas_int n, bblas_int k,
+                             const bblas_complex64_t *alpha, bblas_complex64_t const *const *A, bblas_int lda,
+                                                             bblas_complex64_t const* const *B, bblas_int ldb,
+                             const bblas_complex64_t *beta,  bblas_complex64_t            ** C, bblas_int ldc,
+                             bblas_int *info);
+
+void blas_zhemm_batchf(bblas_int group_size,
                        bblas_enum_t layout, bblas_enum_t side, bblas_enum_t uplo,
-                       int m, int n,
-                       bblas_complex64_t alpha, bblas_complex64_t const *const *A, int lda,
-                                                bblas_complex64_t const* const *B, int ldb,
-                       bblas_complex64_t beta,  bblas_complex64_t            ** C, int ldc,
-                       int *info);
+                       bblas_int m, bblas_int n,
+                       bblas_complex64_t alpha, bblas_complex64_t const *const *A, bblas_int lda,
+                                                bblas_complex64_t const* const *B, bblas_int ldb,
+                       bblas_complex64_t beta,  bblas_complex64_t            ** C, bblas_int ldc,
+                       bblas_int *info);
 
-void blas_zsymm_batchf( int group_size,
+void blas_zsymm_batchf( bblas_int group_size,
                         bblas_enum_t layout, bblas_enum_t side, bblas_enum_t uplo,
-                        int m,  int n,
-                        bblas_complex64_t alpha, bblas_complex64_t const *const *A, int lda,
-                                                 bblas_complex64_t const* const *B, int ldb,
-                        bblas_complex64_t beta,  bblas_complex64_t            ** C, int ldc,
-                        int *info);
+                        bblas_int m,  bblas_int n,
+                        bblas_complex64_t alpha, bblas_complex64_t const *const *A, bblas_int lda,
+                                                 bblas_complex64_t const* const *B, bblas_int ldb,
+                        bblas_complex64_t beta,  bblas_complex64_t            ** C, bblas_int ldc,
+                        bblas_int *info);
 
-void blas_zsyr2k_batchf( int group_size,
+void blas_zsyr2k_batchf( bblas_int group_size,
                          bblas_enum_t layout, bblas_enum_t uplo, bblas_enum_t trans,
-                         int n, int k, 
-                         bblas_complex64_t alpha, bblas_complex64_t const *const *A, int lda,
-                                                  bblas_complex64_t const* const *B, int ldb,
-                         bblas_complex64_t  beta, bblas_complex64_t            ** C, int ldc,
-                         int *info);
+                         bblas_int n, bblas_int k, 
+                         bblas_complex64_t alpha, bblas_complex64_t const *const *A, bblas_int lda,
+                                                  bblas_complex64_t const* const *B, bblas_int ldb,
+                         bblas_complex64_t  beta, bblas_complex64_t            ** C, bblas_int ldc,
+                         bblas_int *info);
 
-void blas_zsyrk_batchf( int group_size,
+void blas_zsyrk_batchf( bblas_int group_size,
                         bblas_enum_t layout, bblas_enum_t uplo, bblas_enum_t trans,
-			int n, int k,
-			const bblas_complex64_t alpha, bblas_complex64_t const *const *A, int lda,
-			const bblas_complex64_t beta,  bblas_complex64_t            ** C, int ldc,
-			int *info);
+			bblas_int n, bblas_int k,
+			const bblas_complex64_t alpha, bblas_complex64_t const *const *A, bblas_int lda,
+			const bblas_complex64_t beta,  bblas_complex64_t            ** C, bblas_int ldc,
+			bblas_int *info);
 
-void blas_zher2k_batchf(int group_size,
+void blas_zher2k_batchf(bblas_int group_size,
                         bblas_enum_t layout, bblas_enum_t uplo, bblas_enum_t trans,
-                        int n, int k, 
-                        bblas_complex64_t alpha, bblas_complex64_t const *const *A, int lda,
-                                                 bblas_complex64_t const* const *B, int ldb,
-                        const double  beta,      bblas_complex64_t            ** C, int ldc,
-                        int *info);
+                        bblas_int n, bblas_int k, 
+                        bblas_complex64_t alpha, bblas_complex64_t const *const *A, bblas_int lda,
+                                                 bblas_complex64_t const* const *B, bblas_int ldb,
+                        const double  beta,      bblas_complex64_t            ** C, bblas_int ldc,
+                        bblas_int *info);
 
-void blas_zherk_batchf( int group_size,
+void blas_zherk_batchf( bblas_int group_size,
                         bblas_enum_t layout, bblas_enum_t uplo, bblas_enum_t trans,
-                        int n, int k,
-                        const double alpha, bblas_complex64_t const *const *A, int lda,
-                        const double  beta, bblas_complex64_t            ** C, int ldc,
-                        int *info);
+                        bblas_int n, bblas_int k,
+                        const double alpha, bblas_complex64_t const *const *A, bblas_int lda,
+                        const double  beta, bblas_complex64_t            ** C, bblas_int ldc,
+                        bblas_int *info);
 
-void blas_ztrmm_batchf( int group_size,
+void blas_ztrmm_batchf( bblas_int group_size,
                         bblas_enum_t layout, bblas_enum_t side, bblas_enum_t uplo,
                         bblas_enum_t transa, bblas_enum_t diag,
-                        int m, int n,
-                        bblas_complex64_t alpha, bblas_complex64_t const *const *A, int lda,
-                                                             bblas_complex64_t **B, int ldb,
-                        int *info);
+                        bblas_int m, bblas_int n,
+                        bblas_complex64_t alpha, bblas_complex64_t const *const *A, bblas_int lda,
+                                                             bblas_complex64_t **B, bblas_int ldb,
+                        bblas_int *info);
     
-void blas_ztrsm_batchf( int group_size,
+void blas_ztrmm_oop_batchf( bblas_int group_size,
+                            bblas_enum_t layout, bblas_enum_t side, bblas_enum_t uplo,
+                            bblas_enum_t transa, bblas_enum_t diag,
+                            bblas_int m, bblas_int n,
+                            bblas_complex64_t alpha, bblas_complex64_t const *const *A, bblas_int lda,
+                                                     bblas_complex64_t const *const *B, bblas_int ldb,
+                                                                 bblas_complex64_t **C, bblas_int ldc,
+                            bblas_int *info);
+
+void blas_ztrsm_batchf( bblas_int group_size,
                         bblas_enum_t layout, bblas_enum_t side, bblas_enum_t uplo,
                         bblas_enum_t transa, bblas_enum_t diag,
-                        int m, int n,
-                        bblas_complex64_t alpha, bblas_complex64_t const *const *A, int lda,
-                                                             bblas_complex64_t **B, int ldb,
-                        int *info);
+                        bblas_int m, bblas_int n,
+                        bblas_complex64_t alpha, bblas_complex64_t const *const *A, bblas_int lda,
+                                                             bblas_complex64_t **B, bblas_int ldb,
+                        bblas_int *info);
+
+void blas_zgbmv_batchf(bblas_int group_size, bblas_enum_t layout, bblas_enum_t trans,
+                       bblas_int m, bblas_int n, bblas_int kl, bblas_int ku,
+                       bblas_complex64_t alpha, bblas_complex64_t const *const *A, bblas_int lda,
+                                                bblas_complex64_t const *const *x, bblas_int incx,
+                       bblas_complex64_t beta,  bblas_complex64_t            **y, bblas_int incy,
+                       bblas_int *info);
+
+void blas_zgbmm_batchf(bblas_int group_size, bblas_enum_t layout, bblas_enum_t transa,
+                       bblas_int m, bblas_int n, bblas_int k,
+                       bblas_int kl, bblas_int ku,
+                       bblas_complex64_t alpha, bblas_complex64_t const *const *A, bblas_int lda,
+                                                bblas_complex64_t const* const *B, bblas_int ldb,
+                       bblas_complex64_t beta,  bblas_complex64_t            ** C, bblas_int ldc,
+                       bblas_int *info);
+
+void blas_zgbsv_batchf(bblas_int group_size, bblas_enum_t layout,
+                       bblas_int n, bblas_int kl, bblas_int ku, bblas_int nrhs,
+                       bblas_complex64_t **A, bblas_int lda, bblas_int **ipiv,
+                       bblas_complex64_t **B, bblas_int ldb,
+                       bblas_int *info);
+
+void blas_zgtsv_batchf(bblas_int group_size, bblas_enum_t layout,
+                       bblas_int n, bblas_int nrhs,
+                       bblas_complex64_t **dl, bblas_complex64_t **d, bblas_complex64_t **du,
+                       bblas_complex64_t **B, bblas_int ldb,
+                       bblas_int *info);
+
+void blas_zptsv_batchf(bblas_int group_size, bblas_enum_t layout,
+                       bblas_int n, bblas_int nrhs,
+                       double **d, bblas_complex64_t **e,
+                       bblas_complex64_t **B, bblas_int ldb,
+                       bblas_int *info);
+
+void blas_zlarft_batchf(bblas_int group_size, bblas_enum_t layout,
+                        bblas_enum_t direct, bblas_enum_t storev,
+                        bblas_int n, bblas_int k,
+                        bblas_complex64_t const *const *V, bblas_int ldv,
+                        bblas_complex64_t const *const *tau,
+                        bblas_complex64_t **T, bblas_int ldt,
+                        bblas_int *info);
+
+void blas_zlarfb_batchf(bblas_int group_size, bblas_enum_t layout,
+                        bblas_enum_t side, bblas_enum_t trans,
+                        bblas_enum_t direct, bblas_enum_t storev,
+                        bblas_int m, bblas_int n, bblas_int k,
+                        bblas_complex64_t const *const *V, bblas_int ldv,
+                        bblas_complex64_t const *const *T, bblas_int ldt,
+                        bblas_complex64_t **C, bblas_int ldc,
+                        bblas_int *info);
+
+void blas_zgeqrf_batchf(bblas_int group_size, bblas_enum_t layout,
+                        bblas_int m, bblas_int n,
+                        bblas_complex64_t **A, bblas_int lda,
+                        bblas_complex64_t **tau,
+                        bblas_int *info);
+
+void blas_zlange_batchf(bblas_int group_size, bblas_enum_t layout,
+                        bblas_enum_t norm, bblas_int m, bblas_int n,
+                        bblas_complex64_t const *const *A, bblas_int lda,
+                        double *values, bblas_int *info);
+
+void blas_zlanhe_batchf(bblas_int group_size, bblas_enum_t layout,
+                        bblas_enum_t norm, bblas_enum_t uplo, bblas_int n,
+                        bblas_complex64_t const *const *A, bblas_int lda,
+                        double *values, bblas_int *info);
+
+void blas_zlansy_batchf(bblas_int group_size, bblas_enum_t layout,
+                        bblas_enum_t norm, bblas_enum_t uplo, bblas_int n,
+                        bblas_complex64_t const *const *A, bblas_int lda,
+                        double *values, bblas_int *info);
+
+void blas_zlantr_batchf(bblas_int group_size, bblas_enum_t layout,
+                        bblas_enum_t norm, bblas_enum_t uplo, bblas_enum_t diag,
+                        bblas_int m, bblas_int n,
+                        bblas_complex64_t const *const *A, bblas_int lda,
+                        double *values, bblas_int *info);
+
+/******************************************************************************/
+bool core_zgemm_workspace(bblas_enum_t transa, bblas_enum_t transb,
+                          bblas_int m, bblas_int n, bblas_int k,
+                          double **work);
+
+void core_zgemm(bblas_enum_t layout, bblas_enum_t transa, bblas_enum_t transb,
+                bblas_int m, bblas_int n, bblas_int k,
+                bblas_complex64_t alpha, const bblas_complex64_t *A, bblas_int lda,
+                                         const bblas_complex64_t *B, bblas_int ldb,
+                bblas_complex64_t beta,        bblas_complex64_t *C, bblas_int ldc,
+                double *work);
+
+bool core_zgemm_shared(bblas_int group_size, bblas_enum_t layout,
+                       bblas_enum_t transa, bblas_enum_t transb,
+                       bblas_int m, bblas_int n, bblas_int k,
+                       bblas_complex64_t alpha, bblas_complex64_t const *const *A, bblas_int lda,
+                                                bblas_complex64_t const *const *B, bblas_int ldb,
+                       bblas_complex64_t beta,  bblas_complex64_t             **C, bblas_int ldc);
+
+void core_ztrmm(bblas_enum_t layout, bblas_enum_t side, bblas_enum_t uplo,
+                bblas_enum_t transa, bblas_enum_t diag,
+                bblas_int m, bblas_int n,
+                bblas_complex64_t alpha, const bblas_complex64_t *A, bblas_int lda,
+                                         const bblas_complex64_t *B, bblas_int ldb,
+                                               bblas_complex64_t *C, bblas_int ldc);
+
+void core_ztrmm_aligned(bblas_enum_t layout, bblas_enum_t side, bblas_enum_t uplo,
+                        bblas_enum_t transa, bblas_enum_t diag,
+                        bblas_int m, bblas_int n,
+                        bblas_complex64_t alpha, const bblas_complex64_t *A, bblas_int lda,
+                                                 const bblas_complex64_t *B, bblas_int ldb,
+                                                       bblas_complex64_t *C, bblas_int ldc);
+
+void core_zgbmm(bblas_enum_t transa,
+                bblas_int m, bblas_int n, bblas_int k,
+                bblas_int kl, bblas_int ku,
+                bblas_complex64_t alpha, const bblas_complex64_t *A, bblas_int lda,
+                                         const bblas_complex64_t *B, bblas_int ldb,
+                bblas_complex64_t beta,        bblas_complex64_t *C, bblas_int ldc);
+
+void core_zgather_lanes(bblas_int lanes, bblas_int m, bblas_int n,
+                        bblas_complex64_t const *const *X, bblas_int incx, bblas_int ldx,
+                        bblas_complex64_t *W);
+
+void core_zscatter_lanes(bblas_int lanes, bblas_int m, bblas_int n,
+                         const bblas_complex64_t *W,
+                         bblas_complex64_t **X, bblas_int incx, bblas_int ldx);
+
+void core_zgtsv_lanes(bblas_int lanes, bblas_int n, bblas_int nrhs,
+                      bblas_complex64_t *dl, bblas_complex64_t *d, bblas_complex64_t *du,
+                      bblas_int inct,
+                      bblas_complex64_t *B, bblas_int incb, bblas_int ldb,
+                      bblas_int *info);
+
+void core_zptsv_lanes(bblas_int lanes, bblas_int n, bblas_int nrhs,
+                      double *d, bblas_complex64_t *e, bblas_int inct,
+                      bblas_complex64_t *B, bblas_int incb, bblas_int ldb,
+                      bblas_int *info);
+
+void core_zlarf_expand(bblas_enum_t layout, bblas_enum_t direct,
+                       bblas_enum_t storev, bblas_int nv, bblas_int k,
+                       const bblas_complex64_t *V, bblas_int ldv,
+                       bblas_complex64_t *W, bblas_int ldw);
+
+void core_zlarft(bblas_enum_t layout, bblas_enum_t direct,
+                 bblas_int nv, bblas_int k,
+                 const bblas_complex64_t *W, bblas_int ldw,
+                 const bblas_complex64_t *tau,
+                 bblas_complex64_t *T, bblas_int ldt);
+
+void core_zlarfb(bblas_enum_t layout, bblas_enum_t side, bblas_enum_t trans,
+                 bblas_enum_t direct,
+                 bblas_int m, bblas_int n, bblas_int k,
+                 const bblas_complex64_t *V, bblas_int ldv,
+                 const bblas_complex64_t *T, bblas_int ldt,
+                 bblas_complex64_t *C, bblas_int ldc,
+                 bblas_complex64_t *W);
+
+void core_zgeqr2(bblas_int m, bblas_int n,
+                 bblas_complex64_t *A, bblas_int lda,
+                 bblas_complex64_t *tau);
+
+void core_zlassq(bblas_int n, const bblas_complex64_t *x,
+                 double *scale, double *sumsq);
+
+double core_zlange(bblas_enum_t norm, bblas_int m, bblas_int n,
+                   const bblas_complex64_t *A, bblas_int lda,
+                   double *work);
+
+double core_zlanhe(bblas_enum_t norm, bblas_enum_t uplo, bblas_int n,
+                   const bblas_complex64_t *A, bblas_int lda,
+                   double *work);
+
+double core_zlansy(bblas_enum_t norm, bblas_enum_t uplo, bblas_int n,
+                   const bblas_complex64_t *A, bblas_int lda,
+                   double *work);
+
+double core_zlantr(bblas_enum_t norm, bblas_enum_t uplo, bblas_enum_t diag,
+                   bblas_int m, bblas_int n,
+                   const bblas_complex64_t *A, bblas_int lda,
+                   double *work);
+
+void core_zscale(bblas_enum_t layout, bblas_enum_t uplo,
+                 bblas_int m, bblas_int n,
+                 bblas_complex64_t beta, bblas_complex64_t *C, bblas_int ldc);
+
+void core_zscale_batch(bblas_int group_size, bblas_enum_t layout, bblas_enum_t uplo,
+                       bblas_int m, bblas_int n,
+                       bblas_complex64_t beta, bblas_complex64_t **C, bblas_int ldc);
+
+#ifdef COMPLEX
+void core_zscale_herm_batch(bblas_int group_size, bblas_enum_t layout, bblas_enum_t uplo,
+                            bblas_int n, double beta, bblas_complex64_t **C, bblas_int ldc);
+#endif
+
+#ifdef COMPLEX
+void core_zgemm3m(bblas_enum_t transa, bblas_enum_t transb,
+                  bblas_int m, bblas_int n, bblas_int k,
+                  bblas_complex64_t alpha, const bblas_complex64_t *A, bblas_int lda,
+                                           const bblas_complex64_t *B, bblas_int ldb,
+                  bblas_complex64_t beta,        bblas_complex64_t *C, bblas_int ldc,
+                  double *work);
+#endif
 
 #undef COMPLEX
 #ifdef __cplusplus
@@ -0,0 +1,34 @@
+/**
+ *
+ * @file
+ *
+ *  BBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions mixed zc -> ds
+ *
+ **/
+#ifndef ICL_CORE_ZC_H
+#define ICL_CORE_ZC_H
+
+#include "bblas_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************/
+void blas_zcgemm_batchf(bblas_int group_size,
+                        bblas_enum_t layout, bblas_enum_t transa, bblas_enum_t transb,
+                        bblas_int m, bblas_int n, bblas_int k,
+                        bblas_complex64_t alpha, bblas_complex32_t const *const *A, bblas_int lda,
+                                                 bblas_complex32_t const *const *B, bblas_int ldb,
+                        bblas_complex64_t beta,  bblas_complex64_t             **C, bblas_int ldc,
+                        bblas_int *info);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif // ICL_CORE_ZC_H
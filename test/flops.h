@@ -12,6 +12,8 @@
 
 #include "bblas_types.h"
 
+#include <math.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -79,6 +81,35 @@ static double  flops_dsymv(double n)
 static double  flops_ssymv(double n)
     { return    fmuls_symv(n) +    fadds_symv(n); }
 
+//------------------------------------------------------------ gbmv
+// The number of entries of the band of an m-by-n matrix with kl
+// sub-diagonals and ku super-diagonals.
+static double fmuls_gbmv(double m, double n, double kl, double ku)
+{
+    double nnz = 0.;
+    for (double j = 0.; j < n; j += 1.) {
+        double len = fmin(m, j+kl+1.) - fmax(0., j-ku);
+        if (len > 0.)
+            nnz += len;
+    }
+    return nnz;
+}
+
+static double fadds_gbmv(double m, double n, double kl, double ku)
+    { return fmuls_gbmv(m, n, kl, ku); }
+
+static double  flops_zgbmv(double m, double n, double kl, double ku)
+    { return 6.*fmuls_gbmv(m, n, kl, ku) + 2.*fadds_gbmv(m, n, kl, ku); }
+
+static double  flops_cgbmv(double m, double n, double kl, double ku)
+    { return 6.*fmuls_gbmv(m, n, kl, ku) + 2.*fadds_gbmv(m, n, kl, ku); }
+
+static double  flops_dgbmv(double m, double n, double kl, double ku)
+    { return    fmuls_gbmv(m, n, kl, ku) +    fadds_gbmv(m, n, kl, ku); }
+
+static double  flops_sgbmv(double m, double n, double kl, double ku)
+    { return    fmuls_gbmv(m, n, kl, ku) +    fadds_gbmv(m, n, kl, ku); }
+
 //==============================================================================
 // Level 3 BLAS
 //==============================================================================
@@ -255,6 +286,223 @@ static double  flops_dtrsm(bblas_enum_t side, double m, double n)
 static double  flops_strsm(bblas_enum_t side, double m, double n)
     { return    fmuls_trsm(side, m, n) +    fadds_trsm(side, m, n); }
 
+//------------------------------------------------------------ gbmm
+// op( A ) is m-by-k; A has kl sub-diagonals and ku super-diagonals.
+static double fmuls_gbmm(bblas_enum_t transa, double m, double n, double k,
+                         double kl, double ku)
+{
+    if (transa == BblasNoTrans)
+        return n*fmuls_gbmv(m, k, kl, ku);
+    else
+        return n*fmuls_gbmv(k, m, kl, ku);
+}
+
+static double fadds_gbmm(bblas_enum_t transa, double m, double n, double k,
+                         double kl, double ku)
+    { return fmuls_gbmm(transa, m, n, k, kl, ku); }
+
+static double  flops_zgbmm(bblas_enum_t transa, double m, double n, double k,
+                           double kl, double ku)
+    { return 6.*fmuls_gbmm(transa, m, n, k, kl, ku) + 2.*fadds_gbmm(transa, m, n, k, kl, ku); }
+
+static double  flops_cgbmm(bblas_enum_t transa, double m, double n, double k,
+                           double kl, double ku)
+    { return 6.*fmuls_gbmm(transa, m, n, k, kl, ku) + 2.*fadds_gbmm(transa, m, n, k, kl, ku); }
+
+static double  flops_dgbmm(bblas_enum_t transa, double m, double n, double k,
+                           double kl, double ku)
+    { return    fmuls_gbmm(transa, m, n, k, kl, ku) +    fadds_gbmm(transa, m, n, k, kl, ku); }
+
+static double  flops_sgbmm(bblas_enum_t transa, double m, double n, double k,
+                           double kl, double ku)
+    { return    fmuls_gbmm(transa, m, n, k, kl, ku) +    fadds_gbmm(transa, m, n, k, kl, ku); }
+
+//==============================================================================
+// LAPACK
+//==============================================================================
+
+//------------------------------------------------------------ gbsv
+// Upper bounds: the factorization updates kl rows of kl+ku columns per
+// column, and the solves run over the bands of L and of U with fill-in.
+static double fmuls_gbsv(double n, double kl, double ku, double nrhs)
+    { return n*kl*(kl+ku+1.) + n*nrhs*(2.*kl+ku+1.); }
+
+static double fadds_gbsv(double n, double kl, double ku, double nrhs)
+    { return n*kl*(kl+ku) + n*nrhs*(2.*kl+ku); }
+
+static double  flops_zgbsv(double n, double kl, double ku, double nrhs)
+    { return 6.*fmuls_gbsv(n, kl, ku, nrhs) + 2.*fadds_gbsv(n, kl, ku, nrhs); }
+
+static double  flops_cgbsv(double n, double kl, double ku, double nrhs)
+    { return 6.*fmuls_gbsv(n, kl, ku, nrhs) + 2.*fadds_gbsv(n, kl, ku, nrhs); }
+
+static double  flops_dgbsv(double n, double kl, double ku, double nrhs)
+    { return    fmuls_gbsv(n, kl, ku, nrhs) +    fadds_gbsv(n, kl, ku, nrhs); }
+
+static double  flops_sgbsv(double n, double kl, double ku, double nrhs)
+    { return    fmuls_gbsv(n, kl, ku, nrhs) +    fadds_gbsv(n, kl, ku, nrhs); }
+
+//------------------------------------------------------------ gtsv
+// Divisions are counted as multiplications.
+static double fmuls_gtsv(double n, double nrhs)
+    { return 2.*n + 4.*n*nrhs; }
+
+static double fadds_gtsv(double n, double nrhs)
+    { return n + 3.*n*nrhs; }
+
+static double  flops_zgtsv(double n, double nrhs)
+    { return 6.*fmuls_gtsv(n, nrhs) + 2.*fadds_gtsv(n, nrhs); }
+
+static double  flops_cgtsv(double n, double nrhs)
+    { return 6.*fmuls_gtsv(n, nrhs) + 2.*fadds_gtsv(n, nrhs); }
+
+static double  flops_dgtsv(double n, double nrhs)
+    { return    fmuls_gtsv(n, nrhs) +    fadds_gtsv(n, nrhs); }
+
+static double  flops_sgtsv(double n, double nrhs)
+    { return    fmuls_gtsv(n, nrhs) +    fadds_gtsv(n, nrhs); }
+
+//------------------------------------------------------------ ptsv
+static double fmuls_ptsv(double n, double nrhs)
+    { return 2.*n + 3.*n*nrhs; }
+
+static double fadds_ptsv(double n, double nrhs)
+    { return n + 2.*n*nrhs; }
+
+static double  flops_zptsv(double n, double nrhs)
+    { return 6.*fmuls_ptsv(n, nrhs) + 2.*fadds_ptsv(n, nrhs); }
+
+static double  flops_cptsv(double n, double nrhs)
+    { return 6.*fmuls_ptsv(n, nrhs) + 2.*fadds_ptsv(n, nrhs); }
+
+static double  flops_dptsv(double n, double nrhs)
+    { return    fmuls_ptsv(n, nrhs) +    fadds_ptsv(n, nrhs); }
+
+static double  flops_sptsv(double n, double nrhs)
+    { return    fmuls_ptsv(n, nrhs) +    fadds_ptsv(n, nrhs); }
+
+//------------------------------------------------------------ geqrf
+// As in LAWN 41.
+static double fmuls_geqrf(double m, double n)
+    { return (m > n) ? n*(n*( 0.5-(1./3.)*n+m)+   m+23./6.)
+                     : m*(m*(-0.5-(1./3.)*m+n)+2.*n+23./6.); }
+
+static double fadds_geqrf(double m, double n)
+    { return (m > n) ? n*(n*( 0.5-(1./3.)*n+m)+    5./6.)
+                     : m*(m*(-0.5-(1./3.)*m+n)+n+  5./6.); }
+
+static double  flops_zgeqrf(double m, double n)
+    { return 6.*fmuls_geqrf(m, n) + 2.*fadds_geqrf(m, n); }
+
+static double  flops_cgeqrf(double m, double n)
+    { return 6.*fmuls_geqrf(m, n) + 2.*fadds_geqrf(m, n); }
+
+static double  flops_dgeqrf(double m, double n)
+    { return    fmuls_geqrf(m, n) +    fadds_geqrf(m, n); }
+
+static double  flops_sgeqrf(double m, double n)
+    { return    fmuls_geqrf(m, n) +    fadds_geqrf(m, n); }
+
+//------------------------------------------------------------ larft
+// A gemv with the n-by-i reflectors and an i-by-i trmv per column i of T.
+static double fmuls_larft(double n, double k)
+    { return n*k*(k-1.)/2. + k*(k-1.)*(k+1.)/6.; }
+
+static double fadds_larft(double n, double k)
+    { return fmuls_larft(n, k); }
+
+static double  flops_zlarft(double n, double k)
+    { return 6.*fmuls_larft(n, k) + 2.*fadds_larft(n, k); }
+
+static double  flops_clarft(double n, double k)
+    { return 6.*fmuls_larft(n, k) + 2.*fadds_larft(n, k); }
+
+static double  flops_dlarft(double n, double k)
+    { return    fmuls_larft(n, k) +    fadds_larft(n, k); }
+
+static double  flops_slarft(double n, double k)
+    { return    fmuls_larft(n, k) +    fadds_larft(n, k); }
+
+//------------------------------------------------------------ larfb
+// Two gemm with the reflectors and a k-by-k trmm.
+static double fmuls_larfb(bblas_enum_t side, double m, double n, double k)
+    { return 2.*m*n*k + ((side == BblasLeft) ? n : m)*k*(k+1.)/2.; }
+
+static double fadds_larfb(bblas_enum_t side, double m, double n, double k)
+    { return 2.*m*n*k + ((side == BblasLeft) ? n : m)*k*(k-1.)/2.; }
+
+static double  flops_zlarfb(bblas_enum_t side, double m, double n, double k)
+    { return 6.*fmuls_larfb(side, m, n, k) + 2.*fadds_larfb(side, m, n, k); }
+
+static double  flops_clarfb(bblas_enum_t side, double m, double n, double k)
+    { return 6.*fmuls_larfb(side, m, n, k) + 2.*fadds_larfb(side, m, n, k); }
+
+static double  flops_dlarfb(bblas_enum_t side, double m, double n, double k)
+    { return    fmuls_larfb(side, m, n, k) +    fadds_larfb(side, m, n, k); }
+
+static double  flops_slarfb(bblas_enum_t side, double m, double n, double k)
+    { return    fmuls_larfb(side, m, n, k) +    fadds_larfb(side, m, n, k); }
+
+//------------------------------------------------------------ lange
+// One addition, or comparison, per element read.
+static double fadds_lange(double m, double n)
+    { return m*n; }
+
+static double  flops_zlange(double m, double n)
+    { return 2.*fadds_lange(m, n); }
+
+static double  flops_clange(double m, double n)
+    { return 2.*fadds_lange(m, n); }
+
+static double  flops_dlange(double m, double n)
+    { return    fadds_lange(m, n); }
+
+static double  flops_slange(double m, double n)
+    { return    fadds_lange(m, n); }
+
+//------------------------------------------------------------ lanhe/lansy
+static double fadds_lanhe(double n)
+    { return n*(n+1.)/2.; }
+
+static double fadds_lansy(double n)
+    { return fadds_lanhe(n); }
+
+static double  flops_zlanhe(double n)
+    { return 2.*fadds_lanhe(n); }
+
+static double  flops_clanhe(double n)
+    { return 2.*fadds_lanhe(n); }
+
+static double  flops_zlansy(double n)
+    { return 2.*fadds_lansy(n); }
+
+static double  flops_clansy(double n)
+    { return 2.*fadds_lansy(n); }
+
+static double  flops_dlansy(double n)
+    { return    fadds_lansy(n); }
+
+static double  flops_slansy(double n)
+    { return    fadds_lansy(n); }
+
+//------------------------------------------------------------ lantr
+// The k-by-k triangle, k = min(m, n), and the rectangle beside or below it.
+static double fadds_lantr(bblas_enum_t uplo, double m, double n)
+    { double k = (m < n) ? m : n;
+      return k*(k+1.)/2. + k*((uplo == BblasUpper) ? n-k : m-k); }
+
+static double  flops_zlantr(bblas_enum_t uplo, double m, double n)
+    { return 2.*fadds_lantr(uplo, m, n); }
+
+static double  flops_clantr(bblas_enum_t uplo, double m, double n)
+    { return 2.*fadds_lantr(uplo, m, n); }
+
+static double  flops_dlantr(bblas_enum_t uplo, double m, double n)
+    { return    fadds_lantr(uplo, m, n); }
+
+static double  flops_slantr(bblas_enum_t uplo, double m, double n)
+    { return    fadds_lantr(uplo, m, n); }
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
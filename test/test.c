@@ -35,6 +35,16 @@ struct routines_t routines[] =
     { "cgemm_batch", test_cgemm_batch },
     { "sgemm_batch", test_sgemm_batch },
 
+    { "zgemm_vscal_batch", test_zgemm_vscal_batch },
+    { "dgemm_vscal_batch", test_dgemm_vscal_batch },
+    { "cgemm_vscal_batch", test_cgemm_vscal_batch },
+    { "sgemm_vscal_batch", test_sgemm_vscal_batch },
+
+    { "zgemm_batch_packed", test_zgemm_batch_packed },
+    { "dgemm_batch_packed", test_dgemm_batch_packed },
+    { "cgemm_batch_packed", test_cgemm_batch_packed },
+    { "sgemm_batch_packed", test_sgemm_batch_packed },
+
     { "zhemm_batch", test_zhemm_batch }, 
     { "", NULL },
     { "chemm_batch", test_chemm_batch }, 
@@ -67,16 +77,141 @@ struct routines_t routines[] =
     { "ssyrk_batch", test_ssyrk_batch }, 
 
 
+    { "zcgemm_batch", test_zcgemm_batch },
+    { "dsgemm_batch", test_dsgemm_batch },
+    { "shgemm_batch", test_shgemm_batch },
+    { "sbgemm_batch", test_sbgemm_batch },
+
+    { "dzgemm_batch", test_dzgemm_batch },
+    { "", NULL },
+    { "scgemm_batch", test_scgemm_batch },
+    { "", NULL },
+
+    { "zdgemm_batch", test_zdgemm_batch },
+    { "", NULL },
+    { "csgemm_batch", test_csgemm_batch },
+    { "", NULL },
+
     { "ztrmm_batch", test_ztrmm_batch }, 
     { "dtrmm_batch", test_dtrmm_batch }, 
     { "ctrmm_batch", test_ctrmm_batch }, 
     { "strmm_batch", test_strmm_batch }, 
 
+    { "ztrmm_oop_batch", test_ztrmm_oop_batch }, 
+    { "dtrmm_oop_batch", test_dtrmm_oop_batch }, 
+    { "ctrmm_oop_batch", test_ctrmm_oop_batch }, 
+    { "strmm_oop_batch", test_strmm_oop_batch }, 
+
     { "ztrsm_batch", test_ztrsm_batch }, 
     { "dtrsm_batch", test_dtrsm_batch }, 
     { "ctrsm_batch", test_ctrsm_batch }, 
     { "strsm_batch", test_strsm_batch }, 
 
+    { "zgbmv_batch", test_zgbmv_batch },
+    { "dgbmv_batch", test_dgbmv_batch },
+    { "cgbmv_batch", test_cgbmv_batch },
+    { "sgbmv_batch", test_sgbmv_batch },
+
+    { "zgbmm_batch", test_zgbmm_batch },
+    { "dgbmm_batch", test_dgbmm_batch },
+    { "cgbmm_batch", test_cgbmm_batch },
+    { "sgbmm_batch", test_sgbmm_batch },
+
+    { "zgbsv_batch", test_zgbsv_batch },
+    { "dgbsv_batch", test_dgbsv_batch },
+    { "cgbsv_batch", test_cgbsv_batch },
+    { "sgbsv_batch", test_sgbsv_batch },
+
+    { "zgtsv_batch", test_zgtsv_batch },
+    { "dgtsv_batch", test_dgtsv_batch },
+    { "cgtsv_batch", test_cgtsv_batch },
+    { "sgtsv_batch", test_sgtsv_batch },
+
+    { "zptsv_batch", test_zptsv_batch },
+    { "dptsv_batch", test_dptsv_batch },
+    { "cptsv_batch", test_cptsv_batch },
+    { "sptsv_batch", test_sptsv_batch },
+
+    { "zlarft_batch", test_zlarft_batch },
+    { "dlarft_batch", test_dlarft_batch },
+    { "clarft_batch", test_clarft_batch },
+    { "slarft_batch", test_slarft_batch },
+
+    { "zlarfb_batch", test_zlarfb_batch },
+    { "dlarfb_batch", test_dlarfb_batch },
+    { "clarfb_batch", test_clarfb_batch },
+    { "slarfb_batch", test_slarfb_batch },
+
+    { "zgeqrf_batch", test_zgeqrf_batch },
+    { "dgeqrf_batch", test_dgeqrf_batch },
+    { "cgeqrf_batch", test_cgeqrf_batch },
+    { "sgeqrf_batch", test_sgeqrf_batch },
+
+    { "zlange_batch", test_zlange_batch },
+    { "dlange_batch", test_dlange_batch },
+    { "clange_batch", test_clange_batch },
+    { "slange_batch", test_slange_batch },
+
+    { "zlanhe_batch", test_zlanhe_batch },
+    { "", NULL },
+    { "clanhe_batch", test_clanhe_batch },
+    { "", NULL },
+
+    { "zlansy_batch", test_zlansy_batch },
+    { "dlansy_batch", test_dlansy_batch },
+    { "clansy_batch", test_clansy_batch },
+    { "slansy_batch", test_slansy_batch },
+
+    { "zlantr_batch", test_zlantr_batch },
+    { "dlantr_batch", test_dlantr_batch },
+    { "clantr_batch", test_clantr_batch },
+    { "slantr_batch", test_slantr_batch },
+
+    { "zgemm_vbatch", test_zgemm_vbatch },
+    { "dgemm_vbatch", test_dgemm_vbatch },
+    { "cgemm_vbatch", test_cgemm_vbatch },
+    { "sgemm_vbatch", test_sgemm_vbatch },
+
+    { "zhemm_vbatch", test_zhemm_vbatch },
+    { "", NULL },
+    { "chemm_vbatch", test_chemm_vbatch },
+    { "", NULL },
+
+    { "zher2k_vbatch", test_zher2k_vbatch },
+    { "", NULL },
+    { "cher2k_vbatch", test_cher2k_vbatch },
+    { "", NULL },
+
+    { "zherk_vbatch", test_zherk_vbatch },
+    { "", NULL },
+    { "cherk_vbatch", test_cherk_vbatch },
+    { "", NULL },
+
+    { "zsymm_vbatch", test_zsymm_vbatch },
+    { "dsymm_vbatch", test_dsymm_vbatch },
+    { "csymm_vbatch", test_csymm_vbatch },
+    { "ssymm_vbatch", test_ssymm_vbatch },
+
+    { "zsyr2k_vbatch", test_zsyr2k_vbatch },
+    { "dsyr2k_vbatch", test_dsyr2k_vbatch },
+    { "csyr2k_vbatch", test_csyr2k_vbatch },
+    { "ssyr2k_vbatch", test_ssyr2k_vbatch },
+
+    { "zsyrk_vbatch", test_zsyrk_vbatch },
+    { "dsyrk_vbatch", test_dsyrk_vbatch },
+    { "csyrk_vbatch", test_csyrk_vbatch },
+    { "ssyrk_vbatch", test_ssyrk_vbatch },
+
+    { "ztrmm_vbatch", test_ztrmm_vbatch },
+    { "dtrmm_vbatch", test_dtrmm_vbatch },
+    { "ctrmm_vbatch", test_ctrmm_vbatch },
+    { "strmm_vbatch", test_strmm_vbatch },
+
+    { "ztrsm_vbatch", test_ztrsm_vbatch },
+    { "dtrsm_vbatch", test_dtrsm_vbatch },
+    { "ctrsm_vbatch", test_ctrsm_vbatch },
+    { "strsm_vbatch", test_strsm_vbatch },
+
 
     { NULL, NULL }  // last entry
 };
@@ -139,6 +274,12 @@ static param_desc_t ParamDesc[] = {
     {"--colrow=[c|r]",     "colrow",       5,     true,
      "columnwise or rowwise [default: c]"},
 
+    {"--direct=[f|b]",     "direct",       6,     true,
+     "forward or backward product of reflectors [default: f]"},
+
+    {"--norm=[o|i|f|m]",   "norm",         5,     true,
+     "one, infinity, Frobenius or max norm [default: o]"},
+
     {"--trans=[n|t|c]",    "trans",        5,     true,
      "transposition [default: n]"},
 
@@ -160,6 +301,27 @@ static param_desc_t ParamDesc[] = {
     {"--info=[a|g|n|o]",       "info",         5,     true,
      "all or group or none or one(any) [default: g]"},
 
+    {"--3m=[n|y]",         "3m",           5,     true,
+     "3M algorithm for complex gemm [default: n]"},
+
+    {"--alloc=[n|y]",      "alloc",        5,     true,
+     "allocate the matrices with bblas_batch_alloc [default: n]"},
+
+    {"--pad=[n|y]",        "pad",          5,     true,
+     "pad leading dimensions with bblas_advise_ld [default: n]"},
+    {"--stream=[n|y]",     "stream",       6,     true,
+     "streaming stores for gemm with beta = 0 [default: n]"},
+    {"--offset=[n|y]",     "offset",       6,     true,
+     "address the matrices by offsets into the arena of --alloc=y [default: n]"},
+    {"--layouts=[n|y]",    "layouts",      7,     true,
+     "compute every other group in row major, in one call [default: n]"},
+    {"--strided=[n|y]",    "strided",      7,     true,
+     "interleave the systems of each group for the strided routines [default: n]"},
+    {"--shared=[n|y]",     "shared",       6,     true,
+     "one A for all the matrices of each group [default: n]"},
+    {"--blocks=[n|y]",     "blocks",       6,     true,
+     "with --shared, the other operands as blocks of one matrix [default: n]"},
+
     {"--ng=",              "ng",           5,     true,
      "The number groups of matrices [default: 10]"},
     
@@ -180,6 +342,12 @@ static param_desc_t ParamDesc[] = {
 
     {"--nrhs=",            "nrhs",         5,     true,
      "NHRS dimension (number of columns) [default: 1000]"},
+
+    {"--kl=",              "kl",           4,     true,
+     "number of sub-diagonals of band matrices [default: 2]"},
+
+    {"--ku=",              "ku",           4,     true,
+     "number of super-diagonals of band matrices [default: 3]"},
     
     {"--alpha=",           "alpha",       14,    true,
      "scalar alpha"},
@@ -229,6 +397,30 @@ int main(int argc, char **argv)
     bool test  = param[PARAM_TEST].val[0].c == 'y';
     int err = 0;
 
+    // Only routines that take BblasConjNoTrans accept r.
+    param_snap(param, pval);
+    run_routine(routine, pval, false);
+    for (int i = PARAM_TRANSA; i <= PARAM_TRANSB; i++) {
+        for (int j = 0; j < param[i].num; j++) {
+            if (param[i].val[j].c == 'r' &&
+                !(pval[i].used & PARAM_USE_CONJ)) {
+                printf("%s does not take %s=r\n",
+                       routine, i == PARAM_TRANSA ? "--transa" : "--transb");
+                exit(EXIT_FAILURE);
+            }
+        }
+    }
+
+    // Only routines that can share either A or B accept a and b.
+    for (int j = 0; j < param[PARAM_SHARED].num; j++) {
+        char c = param[PARAM_SHARED].val[j].c;
+        if ((c == 'a' || c == 'b') &&
+            !(pval[PARAM_SHARED].used & PARAM_USE_SHARED_B)) {
+            printf("%s does not take --shared=%c\n", routine, c);
+            exit(EXIT_FAILURE);
+        }
+    }
+
     // Print labels.
     param_snap(param, pval);
     print_header(routine, pval);
@@ -309,6 +501,21 @@ void print_routine_usage(const char *name, param_value_t pval[])
             case PARAM_MFLOPS:
                 break;
 
+            case PARAM_TRANSA:
+            case PARAM_TRANSB:
+                print_usage(i);
+                if (pval[i].used & PARAM_USE_CONJ)
+                    printf("\t%*s%s\n", DescriptionIndent, "",
+                           "or r: conjugation only");
+                break;
+
+            case PARAM_SHARED:
+                print_usage(i);
+                if (pval[i].used & PARAM_USE_SHARED_B)
+                    printf("\t%*s%s\n", DescriptionIndent, "",
+                           "or a: one A, as y, or b: one B");
+                break;
+
             default:
                 print_usage(i);
                 break;
@@ -409,7 +616,18 @@ int test_routine(const char *name, param_value_t pval[], bool test)
             case PARAM_UPLO:
             case PARAM_DIAG:
             case PARAM_COLROW:
+            case PARAM_DIRECT:
+            case PARAM_NORM:
             case PARAM_INFO:
+            case PARAM_GEMM3M:
+            case PARAM_ALLOC:
+            case PARAM_PAD:
+            case PARAM_STREAM:
+            case PARAM_OFFSET:
+            case PARAM_LAYOUTS:
+            case PARAM_STRIDED:
+            case PARAM_SHARED:
+            case PARAM_BLOCKS:
                 printf("  %*c", ParamDesc[i].width, pval[i].c);
                 break;
 
@@ -427,6 +645,8 @@ int test_routine(const char *name, param_value_t pval[], bool test)
             case PARAM_GS:
             case PARAM_NG:
             case PARAM_NRHS:
+            case PARAM_KL:
+            case PARAM_KU:
             case PARAM_INCM:
             case PARAM_INCG:
                 printf("  %*d", ParamDesc[i].width, pval[i].i);
@@ -566,8 +786,33 @@ void param_read(int argc, char **argv, param_t param[])
         else if (param_starts_with(argv[i], "--info="))
             err = param_scan_char(strchr(argv[i], '=')+1, &param[PARAM_INFO]);
 
+        else if (param_starts_with(argv[i], "--3m="))
+            err = param_scan_char(strchr(argv[i], '=')+1, &param[PARAM_GEMM3M]);
+
+        else if (param_starts_with(argv[i], "--alloc="))
+            err = param_scan_char(strchr(argv[i], '=')+1, &param[PARAM_ALLOC]);
+
+        else if (param_starts_with(argv[i], "--pad="))
+            err = param_scan_char(strchr(argv[i], '=')+1, &param[PARAM_PAD]);
+        else if (param_starts_with(argv[i], "--stream="))
+            err = param_scan_char(strchr(argv[i], '=')+1, &param[PARAM_STREAM]);
+        else if (param_starts_with(argv[i], "--offset="))
+            err = param_scan_char(strchr(argv[i], '=')+1, &param[PARAM_OFFSET]);
+        else if (param_starts_with(argv[i], "--layouts="))
+            err = param_scan_char(strchr(argv[i], '=')+1, &param[PARAM_LAYOUTS]);
+        else if (param_starts_with(argv[i], "--strided="))
+            err = param_scan_char(strchr(argv[i], '=')+1, &param[PARAM_STRIDED]);
+        else if (param_starts_with(argv[i], "--shared="))
+            err = param_scan_char(strchr(argv[i], '=')+1, &param[PARAM_SHARED]);
+        else if (param_starts_with(argv[i], "--blocks="))
+            err = param_scan_char(strchr(argv[i], '=')+1, &param[PARAM_BLOCKS]);
+
         else if (param_starts_with(argv[i], "--colrow="))
             err = param_scan_char(strchr(argv[i], '=')+1, &param[PARAM_COLROW]);
+        else if (param_starts_with(argv[i], "--direct="))
+            err = param_scan_char(strchr(argv[i], '=')+1, &param[PARAM_DIRECT]);
+        else if (param_starts_with(argv[i], "--norm="))
+            err = param_scan_char(strchr(argv[i], '=')+1, &param[PARAM_NORM]);
 
         //--------------------------------------------------
         // Scan integer parameters.
@@ -583,6 +828,10 @@ void param_read(int argc, char **argv, param_t param[])
 
         else if (param_starts_with(argv[i], "--nrhs="))
             err = param_scan_int(strchr(argv[i], '=')+1, &param[PARAM_NRHS]);
+        else if (param_starts_with(argv[i], "--kl="))
+            err = param_scan_int(strchr(argv[i], '=')+1, &param[PARAM_KL]);
+        else if (param_starts_with(argv[i], "--ku="))
+            err = param_scan_int(strchr(argv[i], '=')+1, &param[PARAM_KU]);
 
         else if (param_starts_with(argv[i], "--ng="))
             err = param_scan_int(strchr(argv[i], '=')+1, &param[PARAM_NG]);
@@ -652,8 +901,30 @@ void param_read(int argc, char **argv, param_t param[])
         param_add_char('n', &param[PARAM_DIAG]);
     if (param[PARAM_COLROW].num == 0)
         param_add_char('c', &param[PARAM_COLROW]);
+    if (param[PARAM_DIRECT].num == 0)
+        param_add_char('f', &param[PARAM_DIRECT]);
+    if (param[PARAM_NORM].num == 0)
+        param_add_char('o', &param[PARAM_NORM]);
     if (param[PARAM_INFO].num == 0)
         param_add_char('a', &param[PARAM_INFO]);
+    if (param[PARAM_GEMM3M].num == 0)
+        param_add_char('n', &param[PARAM_GEMM3M]);
+    if (param[PARAM_ALLOC].num == 0)
+        param_add_char('n', &param[PARAM_ALLOC]);
+    if (param[PARAM_PAD].num == 0)
+        param_add_char('n', &param[PARAM_PAD]);
+    if (param[PARAM_STREAM].num == 0)
+        param_add_char('n', &param[PARAM_STREAM]);
+    if (param[PARAM_OFFSET].num == 0)
+        param_add_char('n', &param[PARAM_OFFSET]);
+    if (param[PARAM_LAYOUTS].num == 0)
+        param_add_char('n', &param[PARAM_LAYOUTS]);
+    if (param[PARAM_STRIDED].num == 0)
+        param_add_char('n', &param[PARAM_STRIDED]);
+    if (param[PARAM_SHARED].num == 0)
+        param_add_char('n', &param[PARAM_SHARED]);
+    if (param[PARAM_BLOCKS].num == 0)
+        param_add_char('n', &param[PARAM_BLOCKS]);
     //--------------------------------------------------
     // Set integer parameters.
     //--------------------------------------------------
@@ -664,6 +935,10 @@ void param_read(int argc, char **argv, param_t param[])
 
     if (param[PARAM_NRHS].num == 0)
         param_add_int(50, &param[PARAM_NRHS]);
+    if (param[PARAM_KL].num == 0)
+        param_add_int(2, &param[PARAM_KL]);
+    if (param[PARAM_KU].num == 0)
+        param_add_int(3, &param[PARAM_KU]);
 
     if (param[PARAM_NG].num == 0)
         param_add_int(10, &param[PARAM_NG]);
@@ -1211,3 +1486,73 @@ double gettime(){
     gettimeofday(&tv, NULL);
     return time = tv.tv_sec +tv.tv_usec/(1000000.0);
 }
+
+/***************************************************************************//**
+ * Returns the offsets, in elements of the given size, of X[0], ..., X[count-1]
+ * from X[0], for the *_batch_offset routines, which address the matrices of
+ * an arena from the first one. To be freed by the caller.
+ **/
+bblas_int *pool_offsets(bblas_int count, void *const *X, size_t size)
+{
+    bblas_int *off = (bblas_int*)malloc(((size_t)count+1)*sizeof(bblas_int));
+    assert(off != NULL);
+    for (bblas_int i = 0; i < count; i++)
+        off[i] = (bblas_int)(((const char*)X[i] - (const char*)X[0])
+                             /(ptrdiff_t)size);
+    return off;
+}
+
+/***************************************************************************//**
+ * Allocates the matrices of nops operands from one pool, for the testers of
+ * groups that share an operand. For each group, X_op[o][i] are all one
+ * ld_op[o]-by-cols_op[o] matrix if share_op[o] is 's'. Otherwise they are
+ * group_size matrices: side by side if 'h' and on top of each other if 'v',
+ * as consecutive blocks of one matrix, or apart if 'n', with a spare column
+ * in between. The blocks of 'v' are rows_op[o] rows apart, which ld_op[o]
+ * must fit group_size times. Returns the pool, to be freed by the caller,
+ * and its count of elements of the given size.
+ **/
+void *pool_shared(bblas_int group_count, const bblas_int *group_sizes,
+                  int nops, const char *share_op,
+                  const bblas_int *const *rows_op,
+                  const bblas_int *const *ld_op,
+                  const bblas_int *const *cols_op,
+                  size_t size, void **const *X_op, size_t *count)
+{
+    // Elements of the operands of each group, then the pool.
+    *count = 0;
+    for (int o = 0; o < nops; o++) {
+        for (bblas_int g = 0; g < group_count; g++) {
+            size_t matrix = (size_t)ld_op[o][g]*cols_op[o][g];
+            switch (share_op[o]) {
+                case 's':
+                case 'v': *count += matrix; break;
+                case 'h': *count += matrix*group_sizes[g]; break;
+                default:  *count += (matrix + ld_op[o][g])*group_sizes[g];
+            }
+        }
+    }
+    char *pool = (char*)malloc(imax((size_t)1, *count)*size);
+    assert(pool != NULL);
+
+    char *next = pool;
+    for (int o = 0; o < nops; o++) {
+        bblas_int first = 0;
+        for (bblas_int g = 0; g < group_count; g++) {
+            size_t matrix = (size_t)ld_op[o][g]*cols_op[o][g];
+            size_t stride;
+            switch (share_op[o]) {
+                case 's': stride = 0; break;
+                case 'v': stride = rows_op[o][g]; break;
+                case 'h': stride = matrix; break;
+                default:  stride = matrix + ld_op[o][g];
+            }
+            for (bblas_int i = 0; i < group_sizes[g]; i++)
+                X_op[o][first+i] = next + i*stride*size;
+            first += group_sizes[g];
+            next += (share_op[o] == 's' || share_op[o] == 'v' ?
+                     matrix : stride*group_sizes[g])*size;
+        }
+    }
+    return pool;
+}
@@ -41,6 +41,8 @@ typedef enum {
     //------------------------------------------------------
     // char params
     PARAM_COLROW,  // columnwise or rowwise operation
+    PARAM_DIRECT,  // forward or backward product of reflectors
+    PARAM_NORM,    // one, infinity, Frobenius or max norm
     PARAM_TRANS,   // transposition
     PARAM_TRANSA,  // transposition of A
     PARAM_TRANSB,  // transposition of B
@@ -48,6 +50,15 @@ typedef enum {
     PARAM_UPLO,    // general rectangular or upper or lower triangular
     PARAM_DIAG,    // non-unit or unit diagonal
     PARAM_INFO,  // transposition of B
+    PARAM_GEMM3M,  // 3M algorithm for complex gemm
+    PARAM_ALLOC,   // contiguous batch allocation
+    PARAM_PAD,     // padded leading dimensions
+    PARAM_STREAM,  // streaming stores for beta = 0
+    PARAM_OFFSET,  // matrices addressed by offsets into a pool
+    PARAM_LAYOUTS, // row major and column major groups in one call
+    PARAM_STRIDED, // interleaved systems by the strided routines
+    PARAM_SHARED,  // one matrix for an operand of each group
+    PARAM_BLOCKS,  // other operands as consecutive blocks of one matrix
     // numeric params
     PARAM_NG,      // number of group
     PARAM_GS,      // first group size    
@@ -55,6 +66,8 @@ typedef enum {
     PARAM_INCG,    // group size increment
     PARAM_DIM,     // M, N, K dimensions
     PARAM_NRHS,    // number of RHS
+    PARAM_KL,      // number of sub-diagonals of band matrices
+    PARAM_KU,      // number of super-diagonals of band matrices
     PARAM_ALPHA,   // scalar alpha
     PARAM_BETA,    // scalar beta
 
@@ -89,6 +102,20 @@ enum {
     PARAM_USE_K = 0x4,
 };
 
+// bit flags to differentiate use of PARAM_TRANSA and PARAM_TRANSB;
+// only routines that take BblasConjNoTrans accept r
+enum {
+    PARAM_USE_TRANS = 0x1,
+    PARAM_USE_CONJ  = 0x2,
+};
+
+// bit flags to differentiate use of PARAM_SHARED;
+// only routines that can share either A or B accept a and b
+enum {
+    PARAM_USE_SHARED_A = 0x1,
+    PARAM_USE_SHARED_B = 0x2,
+};
+
 // parameter type
 typedef struct {
     bool is_list;       // parameter is single value or list of values?
@@ -141,11 +168,24 @@ int  param_step_inner(param_t param[]);
 int  param_step_outer(param_t param[], int idx);
 int  param_snap(param_t param[], param_value_t value[]);
 double gettime();
+bblas_int *pool_offsets(bblas_int count, void *const *X, size_t size);
+void *pool_shared(bblas_int group_count, const bblas_int *group_sizes,
+                  int nops, const char *share_op,
+                  const bblas_int *const *rows_op,
+                  const bblas_int *const *ld_op,
+                  const bblas_int *const *cols_op,
+                  size_t size, void **const *X_op, size_t *count);
 //==============================================================================
 
 #include "test_s.h"
 #include "test_d.h"
 #include "test_c.h"
 #include "test_z.h"
+#include "test_ds.h"
+#include "test_zc.h"
+#include "test_sh.h"
+#include "test_sb.h"
+#include "test_sc.h"
+#include "test_dz.h"
 
 #endif // TEST_H
@@ -0,0 +1,25 @@
+/**
+ *
+ * @file
+ *
+ *  BBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions realcomplex dz -> sc
+ *
+ **/
+#ifndef TEST_DZ_H
+#define TEST_DZ_H
+
+#include "test.h"
+
+//==============================================================================
+// test routines
+//==============================================================================
+
+void test_dzgemm_batch(param_value_t param[], bool run);
+void test_zdgemm_batch(param_value_t param[], bool run);
+
+
+#endif // TEST_DZ_H
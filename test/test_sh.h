@@ -0,0 +1,24 @@
+/**
+ *
+ * @file
+ *
+ *  BBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions half sh -> sb
+ *
+ **/
+#ifndef TEST_SH_H
+#define TEST_SH_H
+
+#include "test.h"
+
+//==============================================================================
+// test routines
+//==============================================================================
+
+void test_shgemm_batch(param_value_t param[], bool run);
+
+
+#endif // TEST_SH_H
@@ -0,0 +1,374 @@
+/**
+ *
+ * @file
+ *
+ *  BBLAS is a software package provided by:
+ *  University of Manchester, UK,
+ *  University of Tennessee, US.
+ *
+ * @precisions half sh -> sb
+ *
+ **/
+#include "test.h"
+#include "flops.h"
+#include "bblas.h"
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+
+#define REAL
+
+/***************************************************************************//**
+ *
+ * @brief Tests BATCHED SHGEMM.
+ *
+ * @param[in,out] param - array of parameters
+ * @param[in]     run - whether to run test
+ *
+ * Sets used flags in param indicating parameters that are used.
+ * If run is true, also runs test and stores output parameters.
+ ******************************************************************************/
+void test_shgemm_batch(param_value_t param[], bool run)
+{
+	//================================================================
+	// Mark which parameters are used.
+	//================================================================
+	param[PARAM_NG     ].used = true;
+	param[PARAM_GS     ].used = true;
+	param[PARAM_INCM   ].used = true;
+	param[PARAM_INCG   ].used = true;
+	param[PARAM_TRANSA ].used = true;
+	param[PARAM_TRANSB ].used = true;
+	param[PARAM_INFO   ].used = true;
+	param[PARAM_ALLOC  ].used = true;
+	param[PARAM_PAD    ].used = true;
+	param[PARAM_DIM    ].used = PARAM_USE_M | PARAM_USE_N | PARAM_USE_K;
+	param[PARAM_ALPHA  ].used = true;
+	param[PARAM_BETA   ].used = true;
+	if (! run)
+		return;
+
+
+	//================================================================
+	// Set parameters.
+	//================================================================
+
+	bblas_int group_count       = param[PARAM_NG].i;
+	bblas_int inc_group         = param[PARAM_INCG].i;
+	bblas_int first_group_size  = param[PARAM_GS].i;
+	bblas_int group_sizes[group_count];
+	for (bblas_int i=0; i < group_count; i++) {
+		group_sizes[i] = first_group_size + i*inc_group;
+	}
+
+	bblas_enum_t transa[group_count];
+	bblas_enum_t transb[group_count];
+	for (bblas_int i=0; i < group_count; i++) { // Todo: assign different trans value
+		transa[i]  = bblas_trans_const(param[PARAM_TRANSA].c);
+		transb[i]  = bblas_trans_const(param[PARAM_TRANSB].c);
+	}
+
+	bblas_int inc_matrix_size = param[PARAM_INCM].i;
+	bblas_int *m = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
+	bblas_int *n = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
+	bblas_int *k = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
+
+	for (bblas_int i=0; i < group_count; i++) { // Todo: provide different inc par dimension
+		m[i] = param[PARAM_DIM].dim.m + i*inc_matrix_size;
+		n[i] = param[PARAM_DIM].dim.n + i*inc_matrix_size;
+		k[i] = param[PARAM_DIM].dim.k + i*inc_matrix_size;
+	}
+
+	bblas_int *lda = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
+	bblas_int *ldb = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
+	bblas_int *ldc = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
+
+	bblas_int *An = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
+	bblas_int *Bn = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
+	bblas_int *Cn = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
+
+	bblas_int *Am = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
+	bblas_int *Bm = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
+	bblas_int *Cm = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
+
+	for (bblas_int i= 0; i < group_count; i++) {
+
+		if (transa[i] == BblasNoTrans) {
+			Am[i] = m[i];
+			An[i] = k[i];
+		}
+		else {
+			Am[i] = k[i];
+			An[i] = m[i];
+		}
+		if (transb[i] == BblasNoTrans) {
+			Bm[i] = k[i];
+			Bn[i] = n[i];
+		}
+		else {
+			Bm[i] = n[i];
+			Bn[i] = k[i];
+		}
+		Cm[i] = m[i];
+		Cn[i] = n[i];
+
+		lda[i] = imax(1, Am[i]);
+		ldb[i] = imax(1, Bm[i]);
+		ldc[i] = imax(1, Cm[i]);
+	}
+	int test = param[PARAM_TEST].c == 'y';
+	double eps = LAPACKE_slamch('E');
+
+
+	float alpha[group_count];
+	float beta[group_count];
+	for (bblas_int i = 0; i < group_count; i++) {
+		alpha[i] = (float)creal(param[PARAM_ALPHA].z);
+		beta[i]  = (float)creal(param[PARAM_BETA].z);
+	}
+
+	//================================================================
+	// Allocate and initialize arrays.
+	//================================================================
+
+	bblas_int batch_count =0;
+	for (bblas_int i = 0; i < group_count; i++) {
+		batch_count += group_sizes[i];
+	}
+
+	bblas_half_t **A = (bblas_half_t**)malloc(
+			(size_t)batch_count*sizeof(bblas_half_t*));
+	assert(A != NULL);
+
+	bblas_half_t **B = (bblas_half_t**)malloc(
+			(size_t)batch_count*sizeof(bblas_half_t*));
+	assert(B != NULL);
+
+	float **C = (float**)malloc(
+			(size_t)batch_count*sizeof(float*));
+	assert(C != NULL);
+
+	float **Cref =NULL;
+	if (test) {
+		Cref = (float**)malloc(
+				(size_t)batch_count*sizeof(float*));
+		assert(Cref != NULL);
+	}
+
+	// With --pad=y, the leading dimensions are padded to avoid cache set
+	// aliasing.
+	if (param[PARAM_PAD].c == 'y') {
+		bblas_advise_ld(group_count, An, sizeof(bblas_half_t), lda);
+		bblas_advise_ld(group_count, Bn, sizeof(bblas_half_t), ldb);
+		bblas_advise_ld(group_count, Cn, sizeof(float), ldc);
+	}
+
+	// With --alloc=y, all the matrices come from one arena instead of
+	// one malloc each.
+	bool contiguous = param[PARAM_ALLOC].c == 'y';
+	bblas_arena_t arena = NULL;
+	if (contiguous) {
+		const bblas_int *ld_op[]   = { lda, ldb, ldc };
+		const bblas_int *cols_op[] = { An, Bn, Cn };
+		size_t size_op[]     = { sizeof(bblas_half_t), sizeof(bblas_half_t), sizeof(float) };
+		void **X_op[]        = { (void**)A, (void**)B, (void**)C };
+		arena = bblas_batch_alloc(group_count, group_sizes, 3,
+		                          ld_op, cols_op, size_op, X_op);
+		assert(arena != NULL);
+	}
+
+	lapack_int seed[] = {0, 0, 0, 1};
+	lapack_int retval;
+
+	bblas_int  group_start=0;
+	bblas_int  group_end =0;
+	for (bblas_int group_iter= 0; group_iter < group_count; group_iter++) {
+		group_start = group_end;
+		group_end += group_sizes[group_iter];
+		for (bblas_int matrix_iter= group_start; matrix_iter < group_end; matrix_iter++) {
+
+			if (! contiguous) {
+				A[matrix_iter] = (bblas_half_t*)malloc(
+						(size_t)lda[group_iter]*An[group_iter]*sizeof(bblas_half_t));
+				assert(A[matrix_iter] != NULL);
+				B[matrix_iter] = (bblas_half_t*)malloc(
+						(size_t)ldb[group_iter]*Bn[group_iter]*sizeof(bblas_half_t));
+				assert(B[matrix_iter] != NULL);
+				C[matrix_iter] = (float*)malloc(
+						(size_t)ldc[group_iter]*Cn[group_iter]*sizeof(float));
+				assert(C[matrix_iter] != NULL);
+			}
+
+			size_t asize = (size_t)lda[group_iter]*An[group_iter];
+			size_t bsize = (size_t)ldb[group_iter]*Bn[group_iter];
+			float *W = (float*)malloc((asize+bsize)*sizeof(float));
+			assert(W != NULL);
+
+			retval = LAPACKE_slarnv(1, seed, asize+bsize, W);
+			assert(retval == 0);
+			for (size_t i = 0; i < asize; i++)
+				A[matrix_iter][i] = bblas_s2h(W[i]);
+			for (size_t i = 0; i < bsize; i++)
+				B[matrix_iter][i] = bblas_s2h(W[asize+i]);
+			free(W);
+
+			retval = LAPACKE_slarnv(1, seed, (size_t)ldc[group_iter]*Cn[group_iter], C[matrix_iter]);
+			assert(retval == 0);
+
+			if (test) {
+				Cref[matrix_iter] = (float*)malloc(
+						(size_t)ldc[group_iter]*Cn[group_iter]*sizeof(float));
+				assert(Cref[matrix_iter] != NULL);
+
+				memcpy(Cref[matrix_iter], C[matrix_iter], (size_t)ldc[group_iter]*Cn[group_iter]*sizeof(float));
+			}
+		}
+	}
+
+	//Set info
+	bblas_int info_size;
+	switch (bblas_info_const(param[PARAM_INFO].c)) {
+		case BblasErrorsReportAll :
+			info_size = batch_count +1;
+			break;
+		case BblasErrorsReportGroup :
+			info_size = group_count +1;
+			break;
+		case BblasErrorsReportAny :
+		case BblasErrorsReportNone :
+			info_size = 1;
+			break;
+		default :
+			bblas_error ("illegal value of info");
+			return;
+	}
+
+	bblas_int *info = (bblas_int*) malloc((size_t)info_size*sizeof(bblas_int))  ;
+	info[0] = bblas_info_const(param[PARAM_INFO].c);
+	//================================================================
+	// Run and time BBLAS.
+	//================================================================
+	bblas_time_t start = gettime();
+
+	blas_shgemm_batch(group_count, (const bblas_int *)group_sizes,
+			BblasColMajor, (const bblas_enum_t *)transa, (const bblas_enum_t *)transb,
+			(const bblas_int *)m, (const bblas_int *)n, (const bblas_int *)k,
+			(const float *)alpha, (bblas_half_t const *const *)A, (const bblas_int *)lda,
+							  (bblas_half_t const *const *)B, (const bblas_int *)ldb,
+			(const float *)beta,                                    C, (const bblas_int *)ldc,
+			info);
+
+	bblas_time_t stop = gettime();
+	bblas_time_t time = stop-start;
+
+	param[PARAM_TIME].d = time;
+
+	double flops = 0;
+	for (bblas_int group_iter = 0; group_iter < group_count; group_iter++) {
+		flops += flops_sgemm(m[group_iter], n[group_iter],
+				k[group_iter])*group_sizes[group_iter];
+	}
+	param[PARAM_MFLOPS].d = flops / time / 1e6;
+
+
+	//=====================================================================
+	// Test Batched API results by comparing to regular mutiple blas calls .
+	//=====================================================================
+	if (test) {
+		float smone = -1.0;
+		double error = 0.0;
+		float work[1];
+		group_end = 0;
+		for (bblas_int group_iter= 0; group_iter < group_count; group_iter++) {
+			group_start = group_end;
+			group_end += group_sizes[group_iter];
+			size_t asize = (size_t)lda[group_iter]*An[group_iter];
+			size_t bsize = (size_t)ldb[group_iter]*Bn[group_iter];
+			float *Aref = (float*)malloc(
+					asize*sizeof(float));
+			float *Bref = (float*)malloc(
+					bsize*sizeof(float));
+			assert(Aref != NULL && Bref != NULL);
+			for (bblas_int matrix_iter= group_start; matrix_iter < group_end; matrix_iter++) {
+
+				// reference in single precision on the exact copies of A and B
+				for (size_t i = 0; i < asize; i++)
+					Aref[i] = bblas_h2s(A[matrix_iter][i]);
+				for (size_t i = 0; i < bsize; i++)
+					Bref[i] = bblas_h2s(B[matrix_iter][i]);
+
+				cblas_sgemm(
+						CblasColMajor,
+						(CBLAS_TRANSPOSE)transa[group_iter], (CBLAS_TRANSPOSE)transb[group_iter],
+						m[group_iter], n[group_iter], k[group_iter],
+						alpha[group_iter], Aref, lda[group_iter],
+								   Bref, ldb[group_iter],
+						beta[group_iter], Cref[matrix_iter], ldc[group_iter]);
+
+				double Cnorm = LAPACKE_slange_work(
+						LAPACK_COL_MAJOR, 'F', Cm[group_iter], Cn[group_iter],
+						Cref[matrix_iter], ldc[group_iter], work);
+
+				// compute difference C[matrix_iter] - Cref[matrix_iter]
+				cblas_saxpy((size_t)ldc[group_iter]*Cn[group_iter],
+						smone, Cref[matrix_iter], 1, C[matrix_iter], 1);
+
+				double diff = LAPACKE_slange_work(
+						LAPACK_COL_MAJOR, 'F', Cm[group_iter], Cn[group_iter],
+						C[matrix_iter],  ldc[group_iter], work);
+				if (Cnorm != 0.0)
+					diff /= Cnorm;
+				error += diff;
+			}
+			free(Aref);
+			free(Bref);
+		}
+		param[PARAM_ERROR].d = error;
+		param[PARAM_SUCCESS].i = error < param[PARAM_TOL].d*eps;
+	}
+	//================================================================
+	// Free arrays.
+	//================================================================
+
+	for (bblas_int matrix_iter = 0; matrix_iter < batch_count; matrix_iter++) {
+
+		if (! contiguous) {
+			free(A[matrix_iter]);
+			free(B[matrix_iter]);
+			free(C[matrix_iter]);
+		}
+
+		if (test)
+			free(Cref[matrix_iter]);
+	}
+	bblas_batch_free(arena);
+	free(A);
+	free(B);
+	free(C);
+
+	if (test)
+		free(Cref);
+
+	free(n);
+	free(m);
+	free(k);
+
+	free(lda);
+	free(ldb);
+	free(ldc);
+
+	free(An);
+	free(Bn);
+	free(Cn);
+
+	free(Am);
+	free(Bm);
+	free(Cm);
+
+	free(info);
+}
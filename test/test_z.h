@@ -19,6 +19,8 @@
 //==============================================================================
 
 void test_zgemm_batch(param_value_t param[], bool run);
+void test_zgemm_vscal_batch(param_value_t param[], bool run);
+void test_zgemm_batch_packed(param_value_t param[], bool run);
 void test_zhemm_batch(param_value_t param[], bool run);
 void test_zher2k_batch(param_value_t param[], bool run);
 void test_zherk_batch(param_value_t param[], bool run);
@@ -26,7 +28,30 @@ void test_zsymm_batch(param_value_t param[], bool run);
 void test_zsyr2k_batch(param_value_t param[], bool run);
 void test_zsyrk_batch(param_value_t param[], bool run);
 void test_ztrmm_batch(param_value_t param[], bool run);
+void test_ztrmm_oop_batch(param_value_t param[], bool run);
 void test_ztrsm_batch(param_value_t param[], bool run);
+void test_zgbmv_batch(param_value_t param[], bool run);
+void test_zgbmm_batch(param_value_t param[], bool run);
+void test_zgbsv_batch(param_value_t param[], bool run);
+void test_zgtsv_batch(param_value_t param[], bool run);
+void test_zptsv_batch(param_value_t param[], bool run);
+void test_zlarft_batch(param_value_t param[], bool run);
+void test_zlarfb_batch(param_value_t param[], bool run);
+void test_zgeqrf_batch(param_value_t param[], bool run);
+void test_zlange_batch(param_value_t param[], bool run);
+void test_zlanhe_batch(param_value_t param[], bool run);
+void test_zlansy_batch(param_value_t param[], bool run);
+void test_zlantr_batch(param_value_t param[], bool run);
+
+void test_zgemm_vbatch(param_value_t param[], bool run);
+void test_zhemm_vbatch(param_value_t param[], bool run);
+void test_zher2k_vbatch(param_value_t param[], bool run);
+void test_zherk_vbatch(param_value_t param[], bool run);
+void test_zsymm_vbatch(param_value_t param[], bool run);
+void test_zsyr2k_vbatch(param_value_t param[], bool run);
+void test_zsyrk_vbatch(param_value_t param[], bool run);
+void test_ztrmm_vbatch(param_value_t param[], bool run);
+void test_ztrsm_vbatch(param_value_t param[], bool run);
 
 
 #endif // TEST_Z_H
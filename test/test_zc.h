@@ -0,0 +1,24 @@
+/**
+ *
+ * @file
+ *
+ *  BBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions mixed zc -> ds
+ *
+ **/
+#ifndef TEST_ZC_H
+#define TEST_ZC_H
+
+#include "test.h"
+
+//==============================================================================
+// test routines
+//==============================================================================
+
+void test_zcgemm_batch(param_value_t param[], bool run);
+
+
+#endif // TEST_ZC_H
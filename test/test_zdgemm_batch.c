@@ -0,0 +1,370 @@
+/**
+ *
+ * @file
+ *
+ *  BBLAS is a software package provided by:
+ *  University of Manchester, UK,
+ *  University of Tennessee, US.
+ *
+ * @precisions realcomplex dz -> sc
+ *
+ **/
+#include "test.h"
+#include "flops.h"
+#include "bblas.h"
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+
+#define COMPLEX
+
+/***************************************************************************//**
+ *
+ * @brief Tests BATCHED ZDGEMM.
+ *
+ * @param[in,out] param - array of parameters
+ * @param[in]     run - whether to run test
+ *
+ * Sets used flags in param indicating parameters that are used.
+ * If run is true, also runs test and stores output parameters.
+ ******************************************************************************/
+void test_zdgemm_batch(param_value_t param[], bool run)
+{
+	//================================================================
+	// Mark which parameters are used.
+	//================================================================
+	param[PARAM_NG     ].used = true;
+	param[PARAM_GS     ].used = true;
+	param[PARAM_INCM   ].used = true;
+	param[PARAM_INCG   ].used = true;
+	param[PARAM_TRANSA ].used = true;
+	param[PARAM_TRANSB ].used = true;
+	param[PARAM_INFO   ].used = true;
+	param[PARAM_ALLOC  ].used = true;
+	param[PARAM_PAD    ].used = true;
+	param[PARAM_DIM    ].used = PARAM_USE_M | PARAM_USE_N | PARAM_USE_K;
+	param[PARAM_ALPHA  ].used = true;
+	param[PARAM_BETA   ].used = true;
+	if (! run)
+		return;
+
+
+	//================================================================
+	// Set parameters.
+	//================================================================
+
+	bblas_int group_count       = param[PARAM_NG].i;
+	bblas_int inc_group         = param[PARAM_INCG].i;
+	bblas_int first_group_size  = param[PARAM_GS].i;
+	bblas_int group_sizes[group_count];
+	for (bblas_int i=0; i < group_count; i++) {
+		group_sizes[i] = first_group_size + i*inc_group;
+	}
+
+	bblas_enum_t transa[group_count];
+	bblas_enum_t transb[group_count];
+	for (bblas_int i=0; i < group_count; i++) { // Todo: assign different trans value
+		transa[i]  = bblas_trans_const(param[PARAM_TRANSA].c);
+		transb[i]  = bblas_trans_const(param[PARAM_TRANSB].c);
+	}
+
+	bblas_int inc_matrix_size = param[PARAM_INCM].i;
+	bblas_int *m = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
+	bblas_int *n = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
+	bblas_int *k = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
+
+	for (bblas_int i=0; i < group_count; i++) { // Todo: provide different inc par dimension
+		m[i] = param[PARAM_DIM].dim.m + i*inc_matrix_size;
+		n[i] = param[PARAM_DIM].dim.n + i*inc_matrix_size;
+		k[i] = param[PARAM_DIM].dim.k + i*inc_matrix_size;
+	}
+
+	bblas_int *lda = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
+	bblas_int *ldb = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
+	bblas_int *ldc = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
+
+	bblas_int *An = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
+	bblas_int *Bn = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
+	bblas_int *Cn = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
+
+	bblas_int *Am = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
+	bblas_int *Bm = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
+	bblas_int *Cm = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
+
+	for (bblas_int i= 0; i < group_count; i++) {
+
+		if (transa[i] == BblasNoTrans) {
+			Am[i] = m[i];
+			An[i] = k[i];
+		}
+		else {
+			Am[i] = k[i];
+			An[i] = m[i];
+		}
+		if (transb[i] == BblasNoTrans) {
+			Bm[i] = k[i];
+			Bn[i] = n[i];
+		}
+		else {
+			Bm[i] = n[i];
+			Bn[i] = k[i];
+		}
+		Cm[i] = m[i];
+		Cn[i] = n[i];
+
+		lda[i] = imax(1, Am[i]);
+		ldb[i] = imax(1, Bm[i]);
+		ldc[i] = imax(1, Cm[i]);
+	}
+	int test = param[PARAM_TEST].c == 'y';
+	double eps = LAPACKE_dlamch('E');
+
+
+#ifdef COMPLEX
+	bblas_complex64_t alpha[group_count];
+	bblas_complex64_t beta[group_count];
+	for (bblas_int i = 0; i < group_count; i++) {
+		alpha[i] =  param[PARAM_ALPHA].z;
+		beta[i]  =  param[PARAM_BETA].z;
+	}
+#else
+	double alpha[group_count];
+	double beta[group_count];
+	for (bblas_int i = 0; i < group_count; i++) {
+		alpha[i] = creal(param[PARAM_ALPHA].z);
+		beta[i]  = creal(param[PARAM_BETA].z);
+	}
+#endif
+
+	//================================================================
+	// Allocate and initialize arrays.
+	//================================================================
+
+	bblas_int batch_count =0;
+	for (bblas_int i = 0; i < group_count; i++) {
+		batch_count += group_sizes[i];
+	}
+
+	bblas_complex64_t **A = (bblas_complex64_t**)malloc(
+			(size_t)batch_count*sizeof(bblas_complex64_t*));
+	assert(A != NULL);
+
+	double **B = (double**)malloc(
+			(size_t)batch_count*sizeof(double*));
+	assert(B != NULL);
+
+	bblas_complex64_t **C = (bblas_complex64_t**)malloc(
+			(size_t)batch_count*sizeof(bblas_complex64_t*));
+	assert(C != NULL);
+
+	bblas_complex64_t **Cref =NULL;
+	if (test) {
+		Cref = (bblas_complex64_t**)malloc(
+				(size_t)batch_count*sizeof(bblas_complex64_t*));
+		assert(Cref != NULL);
+	}
+
+	// With --pad=y, the leading dimensions are padded to avoid cache set
+	// aliasing.
+	if (param[PARAM_PAD].c == 'y') {
+		bblas_advise_ld(group_count, An, sizeof(bblas_complex64_t), lda);
+		bblas_advise_ld(group_count, Bn, sizeof(double), ldb);
+		bblas_advise_ld(group_count, Cn, sizeof(bblas_complex64_t), ldc);
+	}
+
+	// With --alloc=y, all the matrices come from one arena instead of
+	// one malloc each.
+	bool contiguous = param[PARAM_ALLOC].c == 'y';
+	bblas_arena_t arena = NULL;
+	if (contiguous) {
+		const bblas_int *ld_op[]   = { lda, ldb, ldc };
+		const bblas_int *cols_op[] = { An, Bn, Cn };
+		size_t size_op[]     = { sizeof(bblas_complex64_t), sizeof(double), sizeof(bblas_complex64_t) };
+		void **X_op[]        = { (void**)A, (void**)B, (void**)C };
+		arena = bblas_batch_alloc(group_count, group_sizes, 3,
+		                          ld_op, cols_op, size_op, X_op);
+		assert(arena != NULL);
+	}
+
+	lapack_int seed[] = {0, 0, 0, 1};
+	lapack_int retval;
+
+	bblas_int  group_start=0;
+	bblas_int  group_end =0;
+	for (bblas_int group_iter= 0; group_iter < group_count; group_iter++) {
+		group_start = group_end;
+		group_end += group_sizes[group_iter];
+		for (bblas_int matrix_iter= group_start; matrix_iter < group_end; matrix_iter++) {
+
+			if (! contiguous) {
+				A[matrix_iter] = (bblas_complex64_t*)malloc(
+						(size_t)lda[group_iter]*An[group_iter]*sizeof(bblas_complex64_t));
+				assert(A[matrix_iter] != NULL);
+				B[matrix_iter] = (double*)malloc(
+						(size_t)ldb[group_iter]*Bn[group_iter]*sizeof(double));
+				assert(B[matrix_iter] != NULL);
+				C[matrix_iter] = (bblas_complex64_t*)malloc(
+						(size_t)ldc[group_iter]*Cn[group_iter]*sizeof(bblas_complex64_t));
+				assert(C[matrix_iter] != NULL);
+			}
+
+			retval = LAPACKE_zlarnv(1, seed, (size_t)lda[group_iter]*An[group_iter], A[matrix_iter]);
+			assert(retval == 0);
+
+			retval = LAPACKE_dlarnv(1, seed, (size_t)ldb[group_iter]*Bn[group_iter], B[matrix_iter]);
+			assert(retval == 0);
+
+			retval = LAPACKE_zlarnv(1, seed, (size_t)ldc[group_iter]*Cn[group_iter], C[matrix_iter]);
+			assert(retval == 0);
+
+			if (test) {
+				Cref[matrix_iter] = (bblas_complex64_t*)malloc(
+						(size_t)ldc[group_iter]*Cn[group_iter]*sizeof(bblas_complex64_t));
+				assert(Cref[matrix_iter] != NULL);
+
+				memcpy(Cref[matrix_iter], C[matrix_iter], (size_t)ldc[group_iter]*Cn[group_iter]*sizeof(bblas_complex64_t));
+			}
+		}
+	}
+
+	//Set info
+	bblas_int info_size;
+	switch (bblas_info_const(param[PARAM_INFO].c)) {
+		case BblasErrorsReportAll :
+			info_size = batch_count +1;
+			break;
+		case BblasErrorsReportGroup :
+			info_size = group_count +1;
+			break;
+		case BblasErrorsReportAny :
+		case BblasErrorsReportNone :
+			info_size = 1;
+			break;
+		default :
+			bblas_error ("illegal value of info");
+			return;
+	}
+
+	bblas_int *info = (bblas_int*) malloc((size_t)info_size*sizeof(bblas_int))  ;
+	info[0] = bblas_info_const(param[PARAM_INFO].c);
+	//================================================================
+	// Run and time BBLAS.
+	//================================================================
+	bblas_time_t start = gettime();
+
+	blas_zdgemm_batch(group_count, (const bblas_int *)group_sizes,
+			BblasColMajor, (const bblas_enum_t *)transa, (const bblas_enum_t *)transb,
+			(const bblas_int *)m, (const bblas_int *)n, (const bblas_int *)k,
+			(const bblas_complex64_t *)alpha, (bblas_complex64_t const *const *)A, (const bblas_int *)lda,
+							  (double const *const *)B, (const bblas_int *)ldb,
+			(const bblas_complex64_t *)beta,                                    C, (const bblas_int *)ldc,
+			info);
+
+	bblas_time_t stop = gettime();
+	bblas_time_t time = stop-start;
+
+	param[PARAM_TIME].d = time;
+
+	double flops = 0;
+	for (bblas_int group_iter = 0; group_iter < group_count; group_iter++) {
+		flops += flops_zgemm(m[group_iter], n[group_iter],
+				k[group_iter])*group_sizes[group_iter];
+	}
+	param[PARAM_MFLOPS].d = flops / time / 1e6;
+
+
+	//=====================================================================
+	// Test Batched API results by comparing to regular mutiple blas calls .
+	//=====================================================================
+	if (test) {
+		bblas_complex64_t zmone = -1.0;
+		double error = 0.0;
+		double work[1];
+		group_end = 0;
+		for (bblas_int group_iter= 0; group_iter < group_count; group_iter++) {
+			group_start = group_end;
+			group_end += group_sizes[group_iter];
+			size_t size = (size_t)ldb[group_iter]*Bn[group_iter];
+			bblas_complex64_t *Bref = (bblas_complex64_t*)malloc(
+					size*sizeof(bblas_complex64_t));
+			assert(Bref != NULL);
+			for (bblas_int matrix_iter= group_start; matrix_iter < group_end; matrix_iter++) {
+
+				// reference on the complex copy of B
+				for (size_t i = 0; i < size; i++)
+					Bref[i] = B[matrix_iter][i];
+
+				cblas_zgemm(
+						CblasColMajor,
+						(CBLAS_TRANSPOSE)transa[group_iter], (CBLAS_TRANSPOSE)transb[group_iter],
+						m[group_iter], n[group_iter], k[group_iter],
+						CBLAS_SADDR(alpha[group_iter]), A[matrix_iter], lda[group_iter],
+										Bref, ldb[group_iter],
+						CBLAS_SADDR(beta[group_iter]), Cref[matrix_iter], ldc[group_iter]);
+
+				double Cnorm = LAPACKE_zlange_work(
+						LAPACK_COL_MAJOR, 'F', Cm[group_iter], Cn[group_iter],
+						Cref[matrix_iter], ldc[group_iter], work);
+
+				// compute difference C[matrix_iter] - Cref[matrix_iter]
+				cblas_zaxpy((size_t)ldc[group_iter]*Cn[group_iter],
+						CBLAS_SADDR(zmone), Cref[matrix_iter], 1, C[matrix_iter], 1);
+
+				double diff = LAPACKE_zlange_work(
+						LAPACK_COL_MAJOR, 'F', Cm[group_iter], Cn[group_iter],
+						C[matrix_iter],  ldc[group_iter], work);
+				if (Cnorm != 0.0)
+					diff /= Cnorm;
+				error = fmax(error, diff);
+			}
+			free(Bref);
+		}
+		param[PARAM_ERROR].d = error;
+		param[PARAM_SUCCESS].i = error < param[PARAM_TOL].d*eps;
+	}
+	//================================================================
+	// Free arrays.
+	//================================================================
+
+	for (bblas_int matrix_iter = 0; matrix_iter < batch_count; matrix_iter++) {
+
+		if (! contiguous) {
+			free(A[matrix_iter]);
+			free(B[matrix_iter]);
+			free(C[matrix_iter]);
+		}
+
+		if (test)
+			free(Cref[matrix_iter]);
+	}
+	bblas_batch_free(arena);
+	free(A);
+	free(B);
+	free(C);
+
+	if (test)
+		free(Cref);
+
+	free(n);
+	free(m);
+	free(k);
+
+	free(lda);
+	free(ldb);
+	free(ldc);
+
+	free(An);
+	free(Bn);
+	free(Cn);
+
+	free(Am);
+	free(Bm);
+	free(Cm);
+
+	free(info);
+}
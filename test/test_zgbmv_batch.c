@@ -0,0 +1,332 @@
+/**
+ *
+ * @file
+ *
+ *  BBLAS is a software package provided by:
+ *  University of Manchester, UK,
+ *  University of Tennessee, US.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+#include "test.h"
+#include "flops.h"
+#include "bblas.h"
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+
+#define COMPLEX
+
+/***************************************************************************//**
+ *
+ * @brief Expands the m-by-n band matrix A with kl sub-diagonals and ku
+ *        super-diagonals, in LAPACK band storage, to the dense matrix Ad.
+ *
+ ******************************************************************************/
+static void zband_to_dense(bblas_int m, bblas_int n, bblas_int kl, bblas_int ku,
+                           const bblas_complex64_t *A, bblas_int lda,
+                           bblas_complex64_t *Ad, bblas_int ldd)
+{
+	for (bblas_int j = 0; j < n; j++) {
+		for (bblas_int i = 0; i < m; i++)
+			Ad[i + (size_t)ldd*j] = 0.0;
+		for (bblas_int i = imax(0, j-ku); i < imin(m, j+kl+1); i++)
+			Ad[i + (size_t)ldd*j] = A[ku+i-j + (size_t)lda*j];
+	}
+}
+
+/***************************************************************************//**
+ *
+ * @brief Tests BATCHED ZGBMV.
+ *
+ * @param[in,out] param - array of parameters
+ * @param[in]     run - whether to run test
+ *
+ * Sets used flags in param indicating parameters that are used.
+ * If run is true, also runs test and stores output parameters.
+ ******************************************************************************/
+void test_zgbmv_batch(param_value_t param[], bool run)
+{
+	//================================================================
+	// Mark which parameters are used.
+	//================================================================
+	param[PARAM_NG     ].used = true;
+	param[PARAM_GS     ].used = true;
+	param[PARAM_INCM   ].used = true;
+	param[PARAM_INCG   ].used = true;
+	param[PARAM_TRANSA ].used = true;
+	param[PARAM_INFO   ].used = true;
+	param[PARAM_DIM    ].used = PARAM_USE_M | PARAM_USE_N;
+	param[PARAM_KL     ].used = true;
+	param[PARAM_KU     ].used = true;
+	param[PARAM_ALPHA  ].used = true;
+	param[PARAM_BETA   ].used = true;
+	if (! run)
+		return;
+
+	//================================================================
+	// Set parameters.
+	//================================================================
+
+	bblas_int group_count       = param[PARAM_NG].i;
+	bblas_int inc_group         = param[PARAM_INCG].i;
+	bblas_int first_group_size  = param[PARAM_GS].i;
+	bblas_int group_sizes[group_count];
+	for (bblas_int i=0; i < group_count; i++) {
+		group_sizes[i] = first_group_size + i*inc_group;
+	}
+
+	bblas_enum_t trans[group_count];
+	bblas_int kl[group_count];
+	bblas_int ku[group_count];
+	bblas_int incx[group_count];
+	bblas_int incy[group_count];
+	for (bblas_int i=0; i < group_count; i++) {
+		trans[i] = bblas_trans_const(param[PARAM_TRANSA].c);
+		kl[i] = param[PARAM_KL].i;
+		ku[i] = param[PARAM_KU].i;
+		incx[i] = 1;
+		incy[i] = 1;
+	}
+
+	bblas_int inc_matrix_size = param[PARAM_INCM].i;
+	bblas_int *m = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
+	bblas_int *n = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
+
+	for (bblas_int i=0; i < group_count; i++) {
+		m[i] = param[PARAM_DIM].dim.m + i*inc_matrix_size;
+		n[i] = param[PARAM_DIM].dim.n + i*inc_matrix_size;
+	}
+
+	bblas_int *lda = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
+
+	// x[i] is of length xm and y[i] of length ym.
+	bblas_int *xm = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
+	bblas_int *ym = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
+
+	for (bblas_int i= 0; i < group_count; i++) {
+
+		if (!bblas_transposed(trans[i])) {
+			xm[i] = n[i];
+			ym[i] = m[i];
+		}
+		else {
+			xm[i] = m[i];
+			ym[i] = n[i];
+		}
+
+		lda[i] = kl[i]+ku[i]+1;
+	}
+	int test = param[PARAM_TEST].c == 'y';
+	double eps = LAPACKE_dlamch('E');
+
+#ifdef COMPLEX
+	bblas_complex64_t alpha[group_count];
+	bblas_complex64_t beta[group_count];
+	for (bblas_int i = 0; i < group_count; i++) {
+		alpha[i] = param[PARAM_ALPHA].z;
+		beta[i]  = param[PARAM_BETA].z;
+	}
+#else
+	double alpha[group_count];
+	double beta[group_count];
+	for (bblas_int i = 0; i < group_count; i++) {
+		alpha[i] = creal(param[PARAM_ALPHA].z);
+		beta[i]  = creal(param[PARAM_BETA].z);
+	}
+#endif
+
+	//================================================================
+	// Allocate and initialize arrays.
+	//================================================================
+
+	bblas_int batch_count = 0;
+	for (bblas_int i = 0; i < group_count; i++) {
+		batch_count += group_sizes[i];
+	}
+
+	bblas_complex64_t **A =
+		(bblas_complex64_t**)malloc((size_t)batch_count*sizeof(bblas_complex64_t*));
+	assert(A != NULL);
+
+	bblas_complex64_t **x =
+		(bblas_complex64_t**)malloc((size_t)batch_count*sizeof(bblas_complex64_t*));
+	assert(x != NULL);
+
+	bblas_complex64_t **y =
+		(bblas_complex64_t**)malloc((size_t)batch_count*sizeof(bblas_complex64_t*));
+	assert(y != NULL);
+
+	bblas_complex64_t **yref = NULL;
+	if (test) {
+		yref = (bblas_complex64_t**)malloc(
+				(size_t)batch_count*sizeof(bblas_complex64_t*));
+		assert(yref != NULL);
+	}
+
+	lapack_int seed[] = {0, 0, 0, 1};
+	lapack_int retval;
+	bblas_int  group_start = 0;
+	bblas_int  group_end = 0;
+	for (bblas_int group_iter= 0; group_iter < group_count; group_iter++) {
+		group_start = group_end;
+		group_end += group_sizes[group_iter];
+		for (bblas_int matrix_iter= group_start; matrix_iter < group_end; matrix_iter++) {
+
+			A[matrix_iter] = (bblas_complex64_t*)malloc(
+					(size_t)lda[group_iter]*n[group_iter]*sizeof(bblas_complex64_t));
+			assert(A[matrix_iter] != NULL);
+			x[matrix_iter] = (bblas_complex64_t*)malloc(
+					(size_t)imax(1, xm[group_iter])*sizeof(bblas_complex64_t));
+			assert(x[matrix_iter] != NULL);
+			y[matrix_iter] = (bblas_complex64_t*)malloc(
+					(size_t)imax(1, ym[group_iter])*sizeof(bblas_complex64_t));
+			assert(y[matrix_iter] != NULL);
+
+			retval = LAPACKE_zlarnv(1, seed, (size_t)lda[group_iter]*n[group_iter],
+					A[matrix_iter]);
+			assert(retval == 0);
+			retval = LAPACKE_zlarnv(1, seed, xm[group_iter], x[matrix_iter]);
+			assert(retval == 0);
+			retval = LAPACKE_zlarnv(1, seed, ym[group_iter], y[matrix_iter]);
+			assert(retval == 0);
+
+			if (test) {
+				yref[matrix_iter] = (bblas_complex64_t*)malloc(
+						(size_t)imax(1, ym[group_iter])*sizeof(bblas_complex64_t));
+				assert(yref[matrix_iter] != NULL);
+
+				memcpy(yref[matrix_iter], y[matrix_iter],
+						(size_t)ym[group_iter]*sizeof(bblas_complex64_t));
+			}
+		}
+	}
+
+	//Set info
+	bblas_int info_size;
+	switch (bblas_info_const(param[PARAM_INFO].c)) {
+		case BblasErrorsReportAll :
+			info_size = batch_count +1;
+			break;
+		case BblasErrorsReportGroup :
+			info_size = group_count +1;
+			break;
+		case BblasErrorsReportAny :
+		case BblasErrorsReportNone :
+			info_size = 1;
+			break;
+		default :
+			bblas_error ("illegal value of info");
+			return;
+	}
+
+	bblas_int *info = (bblas_int*) malloc((size_t)info_size*sizeof(bblas_int))  ;
+	info[0] = bblas_info_const(param[PARAM_INFO].c);
+
+	//================================================================
+	// Run and time BBLAS.
+	//================================================================
+	bblas_time_t start = gettime();
+
+	blas_zgbmv_batch(group_count, (const bblas_int *)group_sizes,
+			BblasColMajor, (const bblas_enum_t *)trans,
+			(const bblas_int *)m, (const bblas_int *)n,
+			(const bblas_int *)kl, (const bblas_int *)ku,
+			(const bblas_complex64_t *)alpha, (bblas_complex64_t const *const *)A, (const bblas_int *)lda,
+			                                  (bblas_complex64_t const *const *)x, (const bblas_int *)incx,
+			(const bblas_complex64_t *)beta,  y, (const bblas_int *)incy,
+			info);
+
+	bblas_time_t stop = gettime();
+	bblas_time_t time = stop-start;
+
+	param[PARAM_TIME].d = time;
+
+	double flops = 0;
+	for (bblas_int group_iter = 0; group_iter < group_count; group_iter++) {
+		flops += flops_zgbmv(m[group_iter], n[group_iter],
+				kl[group_iter], ku[group_iter])*group_sizes[group_iter];
+	}
+	param[PARAM_MFLOPS].d = flops / time / 1e6;
+
+	//=====================================================================
+	// Test Batched API results by comparing to regular mutiple blas calls
+	// on the dense matrices.
+	//=====================================================================
+	if (test) {
+		bblas_complex64_t zmone = -1.0;
+		double error = 0.0;
+		double ynorm = 0.0;
+		group_end = 0;
+		for (bblas_int group_iter= 0; group_iter < group_count; group_iter++) {
+			group_start = group_end;
+			group_end += group_sizes[group_iter];
+			bblas_int ldd = imax(1, m[group_iter]);
+			bblas_complex64_t *Ad = (bblas_complex64_t*)malloc(
+					(size_t)ldd*n[group_iter]*sizeof(bblas_complex64_t));
+			assert(Ad != NULL);
+			for (bblas_int matrix_iter= group_start; matrix_iter < group_end; matrix_iter++) {
+
+				zband_to_dense(m[group_iter], n[group_iter],
+						kl[group_iter], ku[group_iter],
+						A[matrix_iter], lda[group_iter], Ad, ldd);
+
+				cblas_zgemv(
+						CblasColMajor, (CBLAS_TRANSPOSE)trans[group_iter],
+						m[group_iter], n[group_iter],
+						CBLAS_SADDR(alpha[group_iter]), Ad, ldd,
+						                                x[matrix_iter], incx[group_iter],
+						CBLAS_SADDR(beta[group_iter]),  yref[matrix_iter], incy[group_iter]);
+
+				ynorm += cblas_dznrm2(ym[group_iter], yref[matrix_iter], 1);
+
+				// compute difference y[matrix_iter] - yref[matrix_iter]
+				cblas_zaxpy(ym[group_iter],
+						CBLAS_SADDR(zmone), yref[matrix_iter], 1, y[matrix_iter], 1);
+
+				error += cblas_dznrm2(ym[group_iter], y[matrix_iter], 1);
+			}
+			free(Ad);
+		}
+		// The band kernel sums in a different order than gemv.
+		if (ynorm > 0.0)
+			error /= ynorm;
+		param[PARAM_ERROR].d = error;
+		param[PARAM_SUCCESS].i = error < param[PARAM_TOL].d*eps;
+	}
+
+	//================================================================
+	// Free arrays.
+	//================================================================
+
+	for (bblas_int matrix_iter = 0; matrix_iter < batch_count; matrix_iter++) {
+		free(A[matrix_iter]);
+		free(x[matrix_iter]);
+		free(y[matrix_iter]);
+
+		if (test)
+			free(yref[matrix_iter]);
+	}
+	free(A);
+	free(x);
+	free(y);
+
+	if (test)
+		free(yref);
+
+	free(info);
+
+	free(n);
+	free(m);
+
+	free(lda);
+
+	free(xm);
+	free(ym);
+}
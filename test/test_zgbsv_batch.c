@@ -0,0 +1,308 @@
+/**
+ *
+ * @file
+ *
+ *  BBLAS is a software package provided by:
+ *  University of Manchester, UK,
+ *  University of Tennessee, US.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+#include "test.h"
+#include "flops.h"
+#include "bblas.h"
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+
+#define COMPLEX
+
+/***************************************************************************//**
+ *
+ * @brief Expands the m-by-n band matrix A with kl sub-diagonals and ku
+ *        super-diagonals, in LAPACK band storage, to the dense matrix Ad.
+ *
+ ******************************************************************************/
+static void zband_to_dense(bblas_int m, bblas_int n, bblas_int kl, bblas_int ku,
+                           const bblas_complex64_t *A, bblas_int lda,
+                           bblas_complex64_t *Ad, bblas_int ldd)
+{
+	for (bblas_int j = 0; j < n; j++) {
+		for (bblas_int i = 0; i < m; i++)
+			Ad[i + (size_t)ldd*j] = 0.0;
+		for (bblas_int i = imax(0, j-ku); i < imin(m, j+kl+1); i++)
+			Ad[i + (size_t)ldd*j] = A[ku+i-j + (size_t)lda*j];
+	}
+}
+
+/***************************************************************************//**
+ *
+ * @brief Tests BATCHED ZGBSV.
+ *
+ * @param[in,out] param - array of parameters
+ * @param[in]     run - whether to run test
+ *
+ * Sets used flags in param indicating parameters that are used.
+ * If run is true, also runs test and stores output parameters.
+ ******************************************************************************/
+void test_zgbsv_batch(param_value_t param[], bool run)
+{
+	//================================================================
+	// Mark which parameters are used.
+	//================================================================
+	param[PARAM_NG     ].used = true;
+	param[PARAM_GS     ].used = true;
+	param[PARAM_INCM   ].used = true;
+	param[PARAM_INCG   ].used = true;
+	param[PARAM_INFO   ].used = true;
+	param[PARAM_DIM    ].used = PARAM_USE_N;
+	param[PARAM_NRHS   ].used = true;
+	param[PARAM_KL     ].used = true;
+	param[PARAM_KU     ].used = true;
+	if (! run)
+		return;
+
+	//================================================================
+	// Set parameters.
+	//================================================================
+
+	bblas_int group_count       = param[PARAM_NG].i;
+	bblas_int inc_group         = param[PARAM_INCG].i;
+	bblas_int first_group_size  = param[PARAM_GS].i;
+	bblas_int group_sizes[group_count];
+	for (bblas_int i=0; i < group_count; i++) {
+		group_sizes[i] = first_group_size + i*inc_group;
+	}
+
+	bblas_int kl[group_count];
+	bblas_int ku[group_count];
+	bblas_int nrhs[group_count];
+	for (bblas_int i=0; i < group_count; i++) {
+		kl[i]   = param[PARAM_KL].i;
+		ku[i]   = param[PARAM_KU].i;
+		nrhs[i] = param[PARAM_NRHS].i;
+	}
+
+	bblas_int inc_matrix_size = param[PARAM_INCM].i;
+	bblas_int *n = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
+
+	for (bblas_int i=0; i < group_count; i++) {
+		n[i] = param[PARAM_DIM].dim.n + i*inc_matrix_size;
+	}
+
+	bblas_int *lda = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
+	bblas_int *ldb = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
+
+	// kl more rows hold the fill-in of the pivoting.
+	for (bblas_int i= 0; i < group_count; i++) {
+		lda[i] = 2*kl[i]+ku[i]+1;
+		ldb[i] = imax(1, n[i]);
+	}
+	int test = param[PARAM_TEST].c == 'y';
+	double eps = LAPACKE_dlamch('E');
+
+	//================================================================
+	// Allocate and initialize arrays.
+	//================================================================
+
+	bblas_int batch_count = 0;
+	for (bblas_int i = 0; i < group_count; i++) {
+		batch_count += group_sizes[i];
+	}
+
+	bblas_complex64_t **A =
+		(bblas_complex64_t**)malloc((size_t)batch_count*sizeof(bblas_complex64_t*));
+	assert(A != NULL);
+
+	bblas_int **ipiv =
+		(bblas_int**)malloc((size_t)batch_count*sizeof(bblas_int*));
+	assert(ipiv != NULL);
+
+	bblas_complex64_t **B =
+		(bblas_complex64_t**)malloc((size_t)batch_count*sizeof(bblas_complex64_t*));
+	assert(B != NULL);
+
+	bblas_complex64_t **Aref = NULL;
+	bblas_complex64_t **Bref = NULL;
+	if (test) {
+		Aref = (bblas_complex64_t**)malloc(
+				(size_t)batch_count*sizeof(bblas_complex64_t*));
+		assert(Aref != NULL);
+		Bref = (bblas_complex64_t**)malloc(
+				(size_t)batch_count*sizeof(bblas_complex64_t*));
+		assert(Bref != NULL);
+	}
+
+	lapack_int seed[] = {0, 0, 0, 1};
+	lapack_int retval;
+	bblas_int  group_start = 0;
+	bblas_int  group_end = 0;
+	for (bblas_int group_iter= 0; group_iter < group_count; group_iter++) {
+		group_start = group_end;
+		group_end += group_sizes[group_iter];
+		for (bblas_int matrix_iter= group_start; matrix_iter < group_end; matrix_iter++) {
+
+			A[matrix_iter] = (bblas_complex64_t*)malloc(
+					(size_t)lda[group_iter]*n[group_iter]*sizeof(bblas_complex64_t));
+			assert(A[matrix_iter] != NULL);
+			ipiv[matrix_iter] = (bblas_int*)malloc(
+					(size_t)imax(1, n[group_iter])*sizeof(bblas_int));
+			assert(ipiv[matrix_iter] != NULL);
+			B[matrix_iter] = (bblas_complex64_t*)malloc(
+					(size_t)ldb[group_iter]*nrhs[group_iter]*sizeof(bblas_complex64_t));
+			assert(B[matrix_iter] != NULL);
+
+			retval = LAPACKE_zlarnv(1, seed, (size_t)lda[group_iter]*n[group_iter],
+					A[matrix_iter]);
+			assert(retval == 0);
+			// Make the A[i] diagonally dominant.
+			for (bblas_int i = 0; i < n[group_iter]; i++) {
+				A[matrix_iter][kl[group_iter]+ku[group_iter] + (size_t)lda[group_iter]*i]
+					+= kl[group_iter]+ku[group_iter]+1;
+			}
+			retval = LAPACKE_zlarnv(1, seed, (size_t)ldb[group_iter]*nrhs[group_iter],
+					B[matrix_iter]);
+			assert(retval == 0);
+
+			if (test) {
+				Aref[matrix_iter] = (bblas_complex64_t*)malloc(
+						(size_t)ldb[group_iter]*n[group_iter]*sizeof(
+							bblas_complex64_t));
+				assert(Aref[matrix_iter] != NULL);
+				Bref[matrix_iter] = (bblas_complex64_t*)malloc(
+						(size_t)ldb[group_iter]*nrhs[group_iter]*sizeof(
+							bblas_complex64_t));
+				assert(Bref[matrix_iter] != NULL);
+
+				zband_to_dense(n[group_iter], n[group_iter],
+						kl[group_iter], ku[group_iter],
+						A[matrix_iter]+kl[group_iter], lda[group_iter],
+						Aref[matrix_iter], ldb[group_iter]);
+				memcpy(Bref[matrix_iter], B[matrix_iter], (size_t)ldb[group_iter]*
+						nrhs[group_iter]*sizeof(bblas_complex64_t));
+			}
+		}
+	}
+
+	//Set info
+	bblas_int info_size;
+	switch (bblas_info_const(param[PARAM_INFO].c)) {
+		case BblasErrorsReportAll :
+			info_size = batch_count +1;
+			break;
+		case BblasErrorsReportGroup :
+			info_size = group_count +1;
+			break;
+		case BblasErrorsReportAny :
+		case BblasErrorsReportNone :
+			info_size = 1;
+			break;
+		default :
+			bblas_error ("illegal value of info");
+			return;
+	}
+
+	bblas_int *info = (bblas_int*) malloc((size_t)info_size*sizeof(bblas_int))  ;
+	info[0] = bblas_info_const(param[PARAM_INFO].c);
+
+	//================================================================
+	// Run and time BBLAS.
+	//================================================================
+	bblas_time_t start = gettime();
+
+	blas_zgbsv_batch(group_count, (const bblas_int *)group_sizes,
+			BblasColMajor, (const bblas_int *)n,
+			(const bblas_int *)kl, (const bblas_int *)ku, (const bblas_int *)nrhs,
+			A, (const bblas_int *)lda, ipiv,
+			B, (const bblas_int *)ldb,
+			info);
+
+	bblas_time_t stop = gettime();
+	bblas_time_t time = stop-start;
+
+	param[PARAM_TIME].d = time;
+
+	double flops = 0;
+	for (bblas_int group_iter = 0; group_iter < group_count; group_iter++) {
+		flops += flops_zgbsv(n[group_iter], kl[group_iter], ku[group_iter],
+				nrhs[group_iter])*group_sizes[group_iter];
+	}
+	param[PARAM_MFLOPS].d = flops / time / 1e6;
+
+	//=====================================================================
+	// Test Batched API results by the residuals of the solutions,
+	// || B - A X || / ( || A || || X || ), on the dense matrices.
+	//=====================================================================
+	if (test) {
+		bblas_complex64_t zone  =  1.0;
+		bblas_complex64_t zmone = -1.0;
+		double error = 0.0;
+		double work[1];
+		group_end = 0;
+		for (bblas_int group_iter= 0; group_iter < group_count; group_iter++) {
+			group_start = group_end;
+			group_end += group_sizes[group_iter];
+			for (bblas_int matrix_iter= group_start; matrix_iter < group_end; matrix_iter++) {
+
+				double Anorm = LAPACKE_zlange_work(
+						LAPACK_COL_MAJOR, 'F', n[group_iter], n[group_iter],
+						Aref[matrix_iter], ldb[group_iter], work);
+				double Xnorm = LAPACKE_zlange_work(
+						LAPACK_COL_MAJOR, 'F', n[group_iter], nrhs[group_iter],
+						B[matrix_iter], ldb[group_iter], work);
+
+				cblas_zgemm(
+						CblasColMajor, CblasNoTrans, CblasNoTrans,
+						n[group_iter], nrhs[group_iter], n[group_iter],
+						CBLAS_SADDR(zmone), Aref[matrix_iter], ldb[group_iter],
+						                    B[matrix_iter], ldb[group_iter],
+						CBLAS_SADDR(zone),  Bref[matrix_iter], ldb[group_iter]);
+
+				double Rnorm = LAPACKE_zlange_work(
+						LAPACK_COL_MAJOR, 'F', n[group_iter], nrhs[group_iter],
+						Bref[matrix_iter], ldb[group_iter], work);
+
+				if (Anorm*Xnorm > 0.0)
+					error = fmax(error, Rnorm/(Anorm*Xnorm));
+			}
+		}
+		param[PARAM_ERROR].d = error;
+		param[PARAM_SUCCESS].i = error < param[PARAM_TOL].d*eps;
+	}
+
+	//================================================================
+	// Free arrays.
+	//================================================================
+
+	for (bblas_int matrix_iter = 0; matrix_iter < batch_count; matrix_iter++) {
+		free(A[matrix_iter]);
+		free(ipiv[matrix_iter]);
+		free(B[matrix_iter]);
+
+		if (test) {
+			free(Aref[matrix_iter]);
+			free(Bref[matrix_iter]);
+		}
+	}
+	free(A);
+	free(ipiv);
+	free(B);
+
+	if (test) {
+		free(Aref);
+		free(Bref);
+	}
+
+	free(info);
+
+	free(n);
+
+	free(lda);
+	free(ldb);
+}
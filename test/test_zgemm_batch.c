@@ -42,9 +42,19 @@ void test_zgemm_batch(param_value_t param[], bool run)
 	param[PARAM_GS     ].used = true;
 	param[PARAM_INCM   ].used = true;
 	param[PARAM_INCG   ].used = true;
-	param[PARAM_TRANSA ].used = true;
-	param[PARAM_TRANSB ].used = true;
+	param[PARAM_TRANSA ].used = PARAM_USE_TRANS | PARAM_USE_CONJ;
+	param[PARAM_TRANSB ].used = PARAM_USE_TRANS | PARAM_USE_CONJ;
 	param[PARAM_INFO   ].used = true;
+	param[PARAM_ALLOC  ].used = true;
+	param[PARAM_PAD    ].used = true;
+	param[PARAM_OFFSET ].used = true;
+	param[PARAM_LAYOUTS].used = true;
+	param[PARAM_STREAM ].used = true;
+	param[PARAM_SHARED ].used = PARAM_USE_SHARED_A | PARAM_USE_SHARED_B;
+	param[PARAM_BLOCKS ].used = true;
+#ifdef COMPLEX
+	param[PARAM_GEMM3M ].used = true;
+#endif
 	param[PARAM_DIM    ].used = PARAM_USE_M | PARAM_USE_N | PARAM_USE_K;
 	param[PARAM_ALPHA  ].used = true;
 	param[PARAM_BETA   ].used = true;
@@ -56,47 +66,47 @@ void test_zgemm_batch(param_value_t param[], bool run)
 	// Set parameters.
 	//================================================================
 
-	int group_count       = param[PARAM_NG].i;
-	int inc_group         = param[PARAM_INCG].i;
-	int first_group_size  = param[PARAM_GS].i;
-	int group_sizes[group_count];
-	for (int i=0; i < group_count; i++) {
+	bblas_int group_count       = param[PARAM_NG].i;
+	bblas_int inc_group         = param[PARAM_INCG].i;
+	bblas_int first_group_size  = param[PARAM_GS].i;
+	bblas_int group_sizes[group_count];
+	for (bblas_int i=0; i < group_count; i++) {
 		group_sizes[i] = first_group_size + i*inc_group;
 	}
 
 	bblas_enum_t transa[group_count];
 	bblas_enum_t transb[group_count];
-	for (int i=0; i < group_count; i++) { // Todo: assign different trans value
+	for (bblas_int i=0; i < group_count; i++) { // Todo: assign different trans value
 		transa[i]  = bblas_trans_const(param[PARAM_TRANSA].c);
 		transb[i]  = bblas_trans_const(param[PARAM_TRANSB].c);
 	}
 
-	int inc_matrix_size = param[PARAM_INCM].i;
-	int *m = (int*)malloc((size_t)group_count*sizeof(int));
-	int *n = (int*)malloc((size_t)group_count*sizeof(int));
-	int *k = (int*)malloc((size_t)group_count*sizeof(int));
+	bblas_int inc_matrix_size = param[PARAM_INCM].i;
+	bblas_int *m = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
+	bblas_int *n = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
+	bblas_int *k = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
 
-	for (int i=0; i < group_count; i++) { // Todo: provide different inc par dimension
+	for (bblas_int i=0; i < group_count; i++) { // Todo: provide different inc par dimension
 		m[i] = param[PARAM_DIM].dim.m + i*inc_matrix_size;
 		n[i] = param[PARAM_DIM].dim.n + i*inc_matrix_size;
 		k[i] = param[PARAM_DIM].dim.k + i*inc_matrix_size;
 	}
 
-	int *lda = (int*)malloc((size_t)group_count*sizeof(int));
-	int *ldb = (int*)malloc((size_t)group_count*sizeof(int));
-	int *ldc = (int*)malloc((size_t)group_count*sizeof(int));
+	bblas_int *lda = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
+	bblas_int *ldb = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
+	bblas_int *ldc = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
 
-	int *An = (int*)malloc((size_t)group_count*sizeof(int));
-	int *Bn = (int*)malloc((size_t)group_count*sizeof(int));
-	int *Cn = (int*)malloc((size_t)group_count*sizeof(int));
+	bblas_int *An = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
+	bblas_int *Bn = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
+	bblas_int *Cn = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
 
-	int *Am = (int*)malloc((size_t)group_count*sizeof(int));
-	int *Bm = (int*)malloc((size_t)group_count*sizeof(int));
-	int *Cm = (int*)malloc((size_t)group_count*sizeof(int));
+	bblas_int *Am = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
+	bblas_int *Bm = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
+	bblas_int *Cm = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
 
-	for (int i= 0; i < group_count; i++) {
+	for (bblas_int i= 0; i < group_count; i++) {
 
-		if (transa[i] == BblasNoTrans) {
+		if (!bblas_transposed(transa[i])) {
 			Am[i] = m[i];
 			An[i] = k[i];
 		}
@@ -104,7 +114,7 @@ void test_zgemm_batch(param_value_t param[], bool run)
 			Am[i] = k[i];
 			An[i] = m[i];
 		}
-		if (transb[i] == BblasNoTrans) {
+		if (!bblas_transposed(transb[i])) {
 			Bm[i] = k[i];
 			Bn[i] = n[i];
 		}
@@ -126,14 +136,14 @@ void test_zgemm_batch(param_value_t param[], bool run)
 #ifdef COMPLEX
 	bblas_complex64_t alpha[group_count];
 	bblas_complex64_t beta[group_count];
-	for (int i = 0; i < group_count; i++) {
+	for (bblas_int i = 0; i < group_count; i++) {
 		alpha[i] =  param[PARAM_ALPHA].z;
 		beta[i]  =  param[PARAM_BETA].z;
 	}
 #else
 	double alpha[group_count];
 	double beta[group_count];
-	for (int i = 0; i < group_count; i++) {
+	for (bblas_int i = 0; i < group_count; i++) {
 		alpha[i] = creal(param[PARAM_ALPHA].z);
 		beta[i]  = creal(param[PARAM_BETA].z);
 	}
@@ -143,8 +153,8 @@ void test_zgemm_batch(param_value_t param[], bool run)
 	// Allocate and initialize arrays.
 	//================================================================
 
-	int batch_count =0;
-	for (int i = 0; i < group_count; i++) {
+	bblas_int batch_count =0;
+	for (bblas_int i = 0; i < group_count; i++) {
 		batch_count += group_sizes[i];
 	}
 
@@ -167,49 +177,120 @@ void test_zgemm_batch(param_value_t param[], bool run)
 		assert(Cref != NULL);
 	}
 
-	int seed[] = {0, 0, 0, 1};
-	lapack_int retval;
+	// With --pad=y, the leading dimensions are padded to avoid cache set
+	// aliasing.
+	if (param[PARAM_PAD].c == 'y') {
+		bblas_advise_ld(group_count, An, sizeof(bblas_complex64_t), lda);
+		bblas_advise_ld(group_count, Bn, sizeof(bblas_complex64_t), ldb);
+		bblas_advise_ld(group_count, Cn, sizeof(bblas_complex64_t), ldc);
+	}
 
-	int  group_start=0;
-	int  group_end =0;
-	for (int group_iter= 0; group_iter < group_count; group_iter++) {
-		group_start = group_end;
-		group_end += group_sizes[group_iter];
-		for (int matrix_iter= group_start; matrix_iter < group_end; matrix_iter++) {
+	// With --shared=y or a (or b), all the A[i] (or B[i]) of a group are
+	// one matrix, and with --blocks=y, the other operands of the group are
+	// the consecutive blocks of one matrix: B[i] and C[i] side by side for
+	// a shared A, A[i] and C[i] on top of each other for a shared B. These
+	// groups are done by a few wide gemms, or a single one.
+	char share_op[] = { 'n', 'n', 'n' };
+	if (param[PARAM_SHARED].c == 'a' || param[PARAM_SHARED].c == 'y') {
+		share_op[0] = 's';
+		if (param[PARAM_BLOCKS].c == 'y')
+			share_op[1] = share_op[2] = 'h';
+	}
+	else if (param[PARAM_SHARED].c == 'b') {
+		share_op[1] = 's';
+		if (param[PARAM_BLOCKS].c == 'y') {
+			share_op[0] = share_op[2] = 'v';
+			for (bblas_int i = 0; i < group_count; i++) {
+				lda[i] = imax(lda[i], Am[i]*group_sizes[i]);
+				ldc[i] = imax(ldc[i], Cm[i]*group_sizes[i]);
+			}
+		}
+	}
+	bool shared = share_op[0] == 's' || share_op[1] == 's';
+
+	// With --alloc=y, all the matrices come from one arena instead of
+	// one malloc each; --offset=y addresses them by offsets into it,
+	// or into the pool of --shared.
+	bool offsets = param[PARAM_OFFSET].c == 'y';
+	bool contiguous = param[PARAM_ALLOC].c == 'y' || offsets || shared;
+	bblas_arena_t arena = NULL;
+	bblas_complex64_t *pool = NULL;
+	size_t pool_size = 0;
+	if (shared) {
+		const bblas_int *rows_op[] = { Am, Bm, Cm };
+		const bblas_int *ld_op[]   = { lda, ldb, ldc };
+		const bblas_int *cols_op[] = { An, Bn, Cn };
+		void **X_op[]              = { (void**)A, (void**)B, (void**)C };
+		pool = (bblas_complex64_t*)pool_shared(group_count, group_sizes, 3,
+		                                       share_op, rows_op, ld_op, cols_op,
+		                                       sizeof(bblas_complex64_t), X_op,
+		                                       &pool_size);
+	}
+	else if (contiguous) {
+		const bblas_int *ld_op[]   = { lda, ldb, ldc };
+		const bblas_int *cols_op[] = { An, Bn, Cn };
+		size_t size_op[]     = { sizeof(bblas_complex64_t), sizeof(bblas_complex64_t), sizeof(bblas_complex64_t) };
+		void **X_op[]        = { (void**)A, (void**)B, (void**)C };
+		arena = bblas_batch_alloc(group_count, group_sizes, 3,
+		                          ld_op, cols_op, size_op, X_op);
+		assert(arena != NULL);
+	}
 
-			A[matrix_iter] = (bblas_complex64_t*)malloc(
-					(size_t)lda[group_iter]*An[group_iter]*sizeof(bblas_complex64_t));
-			assert(A[matrix_iter] != NULL);
+	lapack_int seed[] = {0, 0, 0, 1};
+	lapack_int retval;
 
-			B[matrix_iter] = (bblas_complex64_t*)malloc(
-					(size_t)ldb[group_iter]*Bn[group_iter]*sizeof(bblas_complex64_t));
-			assert(B[matrix_iter] != NULL);
+	if (shared) {
+		retval = LAPACKE_zlarnv(1, seed, pool_size, pool);
+		assert(retval == 0);
+	}
 
-			C[matrix_iter] = (bblas_complex64_t*)malloc(
-					(size_t)ldc[group_iter]*Cn[group_iter]*sizeof(bblas_complex64_t));
-			assert(C[matrix_iter] != NULL);
+	bblas_int  group_start=0;
+	bblas_int  group_end =0;
+	for (bblas_int group_iter= 0; group_iter < group_count; group_iter++) {
+		group_start = group_end;
+		group_end += group_sizes[group_iter];
+		for (bblas_int matrix_iter= group_start; matrix_iter < group_end; matrix_iter++) {
+
+			if (! contiguous) {
+				A[matrix_iter] = (bblas_complex64_t*)malloc(
+						(size_t)lda[group_iter]*An[group_iter]*sizeof(bblas_complex64_t));
+				assert(A[matrix_iter] != NULL);
+				B[matrix_iter] = (bblas_complex64_t*)malloc(
+						(size_t)ldb[group_iter]*Bn[group_iter]*sizeof(bblas_complex64_t));
+				assert(B[matrix_iter] != NULL);
+				C[matrix_iter] = (bblas_complex64_t*)malloc(
+						(size_t)ldc[group_iter]*Cn[group_iter]*sizeof(bblas_complex64_t));
+				assert(C[matrix_iter] != NULL);
+			}
 
-			retval = LAPACKE_zlarnv(1, seed, (size_t)lda[group_iter]*An[group_iter], A[matrix_iter]);
-			assert(retval == 0);
+			if (! shared) {
+				retval = LAPACKE_zlarnv(1, seed, (size_t)lda[group_iter]*An[group_iter], A[matrix_iter]);
+				assert(retval == 0);
 
-			retval = LAPACKE_zlarnv(1, seed, (size_t)ldb[group_iter]*Bn[group_iter], B[matrix_iter]);
-			assert(retval == 0);
+				retval = LAPACKE_zlarnv(1, seed, (size_t)ldb[group_iter]*Bn[group_iter], B[matrix_iter]);
+				assert(retval == 0);
 
-			retval = LAPACKE_zlarnv(1, seed, (size_t)ldc[group_iter]*Cn[group_iter], C[matrix_iter]);
-			assert(retval == 0);
+				retval = LAPACKE_zlarnv(1, seed, (size_t)ldc[group_iter]*Cn[group_iter], C[matrix_iter]);
+				assert(retval == 0);
+			}
 
+			// C[i] column by column, as the blocks of --blocks=y overlap
+			// within their leading dimension.
 			if (test) {
 				Cref[matrix_iter] = (bblas_complex64_t*)malloc(
 						(size_t)ldc[group_iter]*Cn[group_iter]*sizeof(bblas_complex64_t));
 				assert(Cref[matrix_iter] != NULL);
 
-				memcpy(Cref[matrix_iter], C[matrix_iter], (size_t)ldc[group_iter]*Cn[group_iter]*sizeof(bblas_complex64_t));
+				for (bblas_int j = 0; j < Cn[group_iter]; j++)
+					memcpy(&Cref[matrix_iter][(size_t)ldc[group_iter]*j],
+					       &C[matrix_iter][(size_t)ldc[group_iter]*j],
+					       (size_t)Cm[group_iter]*sizeof(bblas_complex64_t));
 			}
 		}
 	}
 
 	//Set info
-	int info_size;
+	bblas_int info_size;
 	switch (bblas_info_const(param[PARAM_INFO].c)) {
 		case BblasErrorsReportAll :
 			info_size = batch_count +1;
@@ -226,28 +307,95 @@ void test_zgemm_batch(param_value_t param[], bool run)
 			return;
 	}
 
-	int *info = (int*) malloc((size_t)info_size*sizeof(int))  ;
+	bblas_int *info = (bblas_int*) malloc((size_t)info_size*sizeof(bblas_int))  ;
 	info[0] = bblas_info_const(param[PARAM_INFO].c);
+
+	// The matrices of each operand as offsets from the first one.
+	bblas_int *offa = NULL;
+	bblas_int *offb = NULL;
+	bblas_int *offc = NULL;
+	if (offsets) {
+		offa = pool_offsets(batch_count, (void**)A, sizeof(bblas_complex64_t));
+		offb = pool_offsets(batch_count, (void**)B, sizeof(bblas_complex64_t));
+		offc = pool_offsets(batch_count, (void**)C, sizeof(bblas_complex64_t));
+	}
+
+	// With --layouts=y, the odd groups are passed in row major: C = op(A)op(B)
+	// in column major is C^T = op(B)^T op(A)^T in row major, on the same
+	// storage, so the reference below is unchanged.
+	bool layouts = param[PARAM_LAYOUTS].c == 'y' && !offsets;
+	bblas_enum_t layout[group_count];
+	bblas_enum_t transa_l[group_count];
+	bblas_enum_t transb_l[group_count];
+	bblas_int m_l[group_count];
+	bblas_int n_l[group_count];
+	bblas_int lda_l[group_count];
+	bblas_int ldb_l[group_count];
+	const bblas_complex64_t **A_l = (const bblas_complex64_t**)malloc((size_t)batch_count*sizeof(bblas_complex64_t*));
+	const bblas_complex64_t **B_l = (const bblas_complex64_t**)malloc((size_t)batch_count*sizeof(bblas_complex64_t*));
+	group_end = 0;
+	for (bblas_int group_iter = 0; group_iter < group_count; group_iter++) {
+		group_start = group_end;
+		group_end += group_sizes[group_iter];
+		bool row = layouts && group_iter % 2 == 1;
+		layout[group_iter]   = row ? BblasRowMajor : BblasColMajor;
+		transa_l[group_iter] = row ? transb[group_iter] : transa[group_iter];
+		transb_l[group_iter] = row ? transa[group_iter] : transb[group_iter];
+		m_l[group_iter]      = row ? n[group_iter] : m[group_iter];
+		n_l[group_iter]      = row ? m[group_iter] : n[group_iter];
+		lda_l[group_iter]    = row ? ldb[group_iter] : lda[group_iter];
+		ldb_l[group_iter]    = row ? lda[group_iter] : ldb[group_iter];
+		for (bblas_int matrix_iter = group_start; matrix_iter < group_end; matrix_iter++) {
+			A_l[matrix_iter] = row ? B[matrix_iter] : A[matrix_iter];
+			B_l[matrix_iter] = row ? A[matrix_iter] : B[matrix_iter];
+		}
+	}
 	//================================================================
 	// Run and time BBLAS.
 	//================================================================
+#ifdef COMPLEX
+	int gemm_3m = param[PARAM_GEMM3M].c == 'y';
+	bblas_set(BblasTuneGemm3M, gemm_3m);
+#endif
+	bblas_set(BblasTuneStream, param[PARAM_STREAM].c == 'y');
 	bblas_time_t start = gettime();
 
-	blas_zgemm_batch(group_count, (const int *)group_sizes,
-			BblasColMajor, (const bblas_enum_t *)transa, (const bblas_enum_t *)transb,
-			(const int *)m, (const int *)n, (const int *)k,
-			(const bblas_complex64_t *)alpha, (bblas_complex64_t const *const *)A, (const int *)lda,
-							  (bblas_complex64_t const *const *)B, (const int *)ldb,
-			(const bblas_complex64_t *)beta,                                    C, (const int *)ldc,
-			info);
+	if (offsets)
+		blas_zgemm_batch_offset(group_count, (const bblas_int *)group_sizes,
+				BblasColMajor, (const bblas_enum_t *)transa, (const bblas_enum_t *)transb,
+				(const bblas_int *)m, (const bblas_int *)n, (const bblas_int *)k,
+				(const bblas_complex64_t *)alpha, A[0], offa, (const bblas_int *)lda,
+				                                  B[0], offb, (const bblas_int *)ldb,
+				(const bblas_complex64_t *)beta,  C[0], offc, (const bblas_int *)ldc,
+				info);
+	else if (layouts)
+		blas_zgemm_batch_layouts(group_count, (const bblas_int *)group_sizes,
+				layout, transa_l, transb_l,
+				m_l, n_l, (const bblas_int *)k,
+				(const bblas_complex64_t *)alpha, A_l, lda_l,
+				                                  B_l, ldb_l,
+				(const bblas_complex64_t *)beta,  C, (const bblas_int *)ldc,
+				info);
+	else
+		blas_zgemm_batch(group_count, (const bblas_int *)group_sizes,
+				BblasColMajor, (const bblas_enum_t *)transa, (const bblas_enum_t *)transb,
+				(const bblas_int *)m, (const bblas_int *)n, (const bblas_int *)k,
+				(const bblas_complex64_t *)alpha, (bblas_complex64_t const *const *)A, (const bblas_int *)lda,
+								  (bblas_complex64_t const *const *)B, (const bblas_int *)ldb,
+				(const bblas_complex64_t *)beta,                                    C, (const bblas_int *)ldc,
+				info);
 
 	bblas_time_t stop = gettime();
 	bblas_time_t time = stop-start;
+	bblas_set(BblasTuneStream, 0);
+#ifdef COMPLEX
+	bblas_set(BblasTuneGemm3M, 0);
+#endif
 
 	param[PARAM_TIME].d = time;
 
 	double flops = 0;
-	for (int group_iter = 0; group_iter < group_count; group_iter++) {
+	for (bblas_int group_iter = 0; group_iter < group_count; group_iter++) {
 		flops += flops_zgemm(m[group_iter], n[group_iter],
 				k[group_iter])*group_sizes[group_iter];
 	}
@@ -260,46 +408,117 @@ void test_zgemm_batch(param_value_t param[], bool run)
 	if (test) {
 		bblas_complex64_t zmone = -1.0;
 		double error = 0.0;
-		double work[1];
+		double Cnorm = 0.0;
 		group_end = 0;
-		for (int group_iter= 0; group_iter < group_count; group_iter++) {
+		for (bblas_int group_iter= 0; group_iter < group_count; group_iter++) {
 			group_start = group_end;
 			group_end += group_sizes[group_iter];
-			for (int matrix_iter= group_start; matrix_iter < group_end; matrix_iter++) {
+			// BLAS has no conjugation without transposition: conjugate
+			// A[i] and B[i] in place instead, after the BBLAS run, once
+			// for a matrix shared by the group.
+			bblas_enum_t ta = transa[group_iter];
+			bblas_enum_t tb = transb[group_iter];
+			if (ta == BblasConjNoTrans)
+				ta = BblasNoTrans;
+			if (tb == BblasConjNoTrans)
+				tb = BblasNoTrans;
+			for (bblas_int matrix_iter= group_start; matrix_iter < group_end; matrix_iter++) {
+#ifdef COMPLEX
+				if (transa[group_iter] == BblasConjNoTrans &&
+				    (matrix_iter == group_start || A[matrix_iter] != A[matrix_iter-1])) {
+					for (bblas_int j = 0; j < An[group_iter]; j++)
+						for (bblas_int l = 0; l < Am[group_iter]; l++)
+							A[matrix_iter][(size_t)lda[group_iter]*j + l] =
+								conj(A[matrix_iter][(size_t)lda[group_iter]*j + l]);
+				}
+				if (transb[group_iter] == BblasConjNoTrans &&
+				    (matrix_iter == group_start || B[matrix_iter] != B[matrix_iter-1])) {
+					for (bblas_int j = 0; j < Bn[group_iter]; j++)
+						for (bblas_int l = 0; l < Bm[group_iter]; l++)
+							B[matrix_iter][(size_t)ldb[group_iter]*j + l] =
+								conj(B[matrix_iter][(size_t)ldb[group_iter]*j + l]);
+				}
+#endif
 
 				cblas_zgemm(
 						CblasColMajor,
-						(CBLAS_TRANSPOSE)transa[group_iter], (CBLAS_TRANSPOSE)transb[group_iter],
+						(CBLAS_TRANSPOSE)ta, (CBLAS_TRANSPOSE)tb,
 						m[group_iter], n[group_iter], k[group_iter],
 						CBLAS_SADDR(alpha[group_iter]), A[matrix_iter], lda[group_iter],
 										B[matrix_iter], ldb[group_iter],
 						CBLAS_SADDR(beta[group_iter]), Cref[matrix_iter], ldc[group_iter]);
 
 				// compute difference C[matrix_iter] - C[matrix_iter]
-				cblas_zaxpy((size_t)ldc[group_iter]*Cn[group_iter],
-						CBLAS_SADDR(zmone), Cref[matrix_iter], 1, C[matrix_iter], 1);
-
-				error += LAPACKE_zlange_work(
-						LAPACK_COL_MAJOR, 'F', Cm[group_iter], Cn[group_iter],
-						C[matrix_iter],  ldc[group_iter], work);
+				for (bblas_int j = 0; j < Cn[group_iter]; j++)
+					cblas_zaxpy(Cm[group_iter], CBLAS_SADDR(zmone),
+							&Cref[matrix_iter][(size_t)ldc[group_iter]*j], 1,
+							&C[matrix_iter][(size_t)ldc[group_iter]*j], 1);
 			}
 		}
+
+		// The norms of all the Cref[i] and of the differences, in one
+		// batched call each.
+		bblas_enum_t fro[group_count];
+		for (bblas_int group_iter = 0; group_iter < group_count; group_iter++)
+			fro[group_iter] = BblasFrobeniusNorm;
+		double *norms = (double*)malloc((size_t)imax(1, batch_count)*sizeof(double));
+		assert(norms != NULL);
+		bblas_int info_norm = BblasErrorsReportAny;
+
+		blas_zlange_batch(group_count, (const bblas_int *)group_sizes,
+				BblasColMajor, (const bblas_enum_t *)fro,
+				(const bblas_int *)Cm, (const bblas_int *)Cn,
+				(bblas_complex64_t const *const *)Cref, (const bblas_int *)ldc,
+				norms, &info_norm);
+		assert(info_norm == 0);
+		for (bblas_int matrix_iter = 0; matrix_iter < batch_count; matrix_iter++)
+			Cnorm += norms[matrix_iter];
+
+		info_norm = BblasErrorsReportAny;
+		blas_zlange_batch(group_count, (const bblas_int *)group_sizes,
+				BblasColMajor, (const bblas_enum_t *)fro,
+				(const bblas_int *)Cm, (const bblas_int *)Cn,
+				(bblas_complex64_t const *const *)C, (const bblas_int *)ldc,
+				norms, &info_norm);
+		assert(info_norm == 0);
+		for (bblas_int matrix_iter = 0; matrix_iter < batch_count; matrix_iter++)
+			error += norms[matrix_iter];
+		free(norms);
 		param[PARAM_ERROR].d = error;
 		param[PARAM_SUCCESS].i = error < 3*eps;
+		// The wide gemms of shared operands round differently from the
+		// reference, and the 3M algorithm is only normwise accurate; a
+		// zero reference, e.g., with alpha = beta = 0, must be matched
+		// exactly.
+		if (shared)
+			param[PARAM_SUCCESS].i = error <= param[PARAM_TOL].d*eps*Cnorm;
+#ifdef COMPLEX
+		if (gemm_3m)
+			param[PARAM_SUCCESS].i = error <= param[PARAM_TOL].d*eps*Cnorm;
+#endif
 	}
 	//================================================================
 	// Free arrays.
 	//================================================================
 
-	for (int matrix_iter = 0; matrix_iter < batch_count; matrix_iter++) {
+	for (bblas_int matrix_iter = 0; matrix_iter < batch_count; matrix_iter++) {
 
-		free(A[matrix_iter]);
-		free(B[matrix_iter]);
-		free(C[matrix_iter]);
+		if (! contiguous) {
+			free(A[matrix_iter]);
+			free(B[matrix_iter]);
+			free(C[matrix_iter]);
+		}
 
 		if (test)
 			free(Cref[matrix_iter]);
 	}
+	bblas_batch_free(arena);
+	free(pool);
+	free(A_l);
+	free(B_l);
+	free(offa);
+	free(offb);
+	free(offc);
 	free(A);
 	free(B);
 	free(C);
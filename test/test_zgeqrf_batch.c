@@ -0,0 +1,254 @@
+/**
+ *
+ * @file
+ *
+ *  BBLAS is a software package provided by:
+ *  University of Manchester, UK,
+ *  University of Tennessee, US.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+#include "test.h"
+#include "flops.h"
+#include "bblas.h"
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+
+#define COMPLEX
+
+/***************************************************************************//**
+ *
+ * @brief Tests BATCHED ZGEQRF.
+ *
+ * @param[in,out] param - array of parameters
+ * @param[in]     run - whether to run test
+ *
+ * Sets used flags in param indicating parameters that are used.
+ * If run is true, also runs test and stores output parameters.
+ ******************************************************************************/
+void test_zgeqrf_batch(param_value_t param[], bool run)
+{
+	//================================================================
+	// Mark which parameters are used.
+	//================================================================
+	param[PARAM_NG     ].used = true;
+	param[PARAM_GS     ].used = true;
+	param[PARAM_INCM   ].used = true;
+	param[PARAM_INCG   ].used = true;
+	param[PARAM_INFO   ].used = true;
+	param[PARAM_DIM    ].used = PARAM_USE_M | PARAM_USE_N;
+	if (! run)
+		return;
+
+	//================================================================
+	// Set parameters.
+	//================================================================
+
+	bblas_int group_count       = param[PARAM_NG].i;
+	bblas_int inc_group         = param[PARAM_INCG].i;
+	bblas_int first_group_size  = param[PARAM_GS].i;
+	bblas_int group_sizes[group_count];
+	for (bblas_int i=0; i < group_count; i++) {
+		group_sizes[i] = first_group_size + i*inc_group;
+	}
+
+	bblas_int inc_matrix_size = param[PARAM_INCM].i;
+	bblas_int m[group_count];
+	bblas_int n[group_count];
+	bblas_int lda[group_count];
+	for (bblas_int i=0; i < group_count; i++) {
+		m[i]   = param[PARAM_DIM].dim.m + i*inc_matrix_size;
+		n[i]   = param[PARAM_DIM].dim.n + i*inc_matrix_size;
+		lda[i] = imax(1, m[i]);
+	}
+
+	int test = param[PARAM_TEST].c == 'y';
+	double eps = LAPACKE_dlamch('E');
+
+	//================================================================
+	// Allocate and initialize arrays.
+	//================================================================
+
+	bblas_int batch_count = 0;
+	for (bblas_int i = 0; i < group_count; i++) {
+		batch_count += group_sizes[i];
+	}
+
+	bblas_complex64_t **A =
+		(bblas_complex64_t**)malloc((size_t)batch_count*sizeof(bblas_complex64_t*));
+	assert(A != NULL);
+
+	bblas_complex64_t **tau =
+		(bblas_complex64_t**)malloc((size_t)batch_count*sizeof(bblas_complex64_t*));
+	assert(tau != NULL);
+
+	bblas_complex64_t **Aref = NULL;
+	if (test) {
+		Aref = (bblas_complex64_t**)malloc(
+				(size_t)batch_count*sizeof(bblas_complex64_t*));
+		assert(Aref != NULL);
+	}
+
+	lapack_int seed[] = {0, 0, 0, 1};
+	lapack_int retval;
+	bblas_int  group_start = 0;
+	bblas_int  group_end = 0;
+	for (bblas_int group_iter= 0; group_iter < group_count; group_iter++) {
+		group_start = group_end;
+		group_end += group_sizes[group_iter];
+		size_t asize = (size_t)lda[group_iter]*n[group_iter];
+		for (bblas_int matrix_iter= group_start; matrix_iter < group_end; matrix_iter++) {
+
+			A[matrix_iter] = (bblas_complex64_t*)malloc(
+					(asize > 0 ? asize : 1)*sizeof(bblas_complex64_t));
+			assert(A[matrix_iter] != NULL);
+			tau[matrix_iter] = (bblas_complex64_t*)malloc(
+					(size_t)imax(1, imin(m[group_iter], n[group_iter]))*
+					sizeof(bblas_complex64_t));
+			assert(tau[matrix_iter] != NULL);
+
+			retval = LAPACKE_zlarnv(1, seed, asize, A[matrix_iter]);
+			assert(retval == 0);
+
+			if (test) {
+				Aref[matrix_iter] = (bblas_complex64_t*)malloc(
+						(asize > 0 ? asize : 1)*sizeof(bblas_complex64_t));
+				assert(Aref[matrix_iter] != NULL);
+				memcpy(Aref[matrix_iter], A[matrix_iter],
+						asize*sizeof(bblas_complex64_t));
+			}
+		}
+	}
+
+	//Set info
+	bblas_int info_size;
+	switch (bblas_info_const(param[PARAM_INFO].c)) {
+		case BblasErrorsReportAll :
+			info_size = batch_count +1;
+			break;
+		case BblasErrorsReportGroup :
+			info_size = group_count +1;
+			break;
+		case BblasErrorsReportAny :
+		case BblasErrorsReportNone :
+			info_size = 1;
+			break;
+		default :
+			bblas_error ("illegal value of info");
+			return;
+	}
+
+	bblas_int *info = (bblas_int*) malloc((size_t)info_size*sizeof(bblas_int))  ;
+	info[0] = bblas_info_const(param[PARAM_INFO].c);
+
+	//================================================================
+	// Run and time BBLAS.
+	//================================================================
+	bblas_time_t start = gettime();
+
+	blas_zgeqrf_batch(group_count, (const bblas_int *)group_sizes,
+			BblasColMajor, (const bblas_int *)m, (const bblas_int *)n,
+			A, (const bblas_int *)lda,
+			tau,
+			info);
+
+	bblas_time_t stop = gettime();
+	bblas_time_t time = stop-start;
+
+	param[PARAM_TIME].d = time;
+
+	double flops = 0;
+	for (bblas_int group_iter = 0; group_iter < group_count; group_iter++) {
+		flops += flops_zgeqrf(m[group_iter], n[group_iter])*group_sizes[group_iter];
+	}
+	param[PARAM_MFLOPS].d = flops / time / 1e6;
+
+	//=====================================================================
+	// Test Batched API results by the residuals of the factorizations,
+	// || A - Q R || / || A ||, with Q R formed by LAPACK zlarft and zlarfb.
+	//=====================================================================
+	if (test) {
+		double error = 0.0;
+		double work[1];
+		group_end = 0;
+		for (bblas_int group_iter= 0; group_iter < group_count; group_iter++) {
+			group_start = group_end;
+			group_end += group_sizes[group_iter];
+			bblas_int mm = m[group_iter];
+			bblas_int nn = n[group_iter];
+			bblas_int kk = imin(mm, nn);
+			bblas_int ld = lda[group_iter];
+			bblas_complex64_t *R = (bblas_complex64_t*)malloc(
+					(size_t)ld*imax(1, nn)*sizeof(bblas_complex64_t));
+			bblas_complex64_t *T = (bblas_complex64_t*)malloc(
+					(size_t)imax(1, kk)*imax(1, kk)*sizeof(bblas_complex64_t));
+			bblas_complex64_t *W = (bblas_complex64_t*)malloc(
+					(size_t)imax(1, nn)*imax(1, kk)*sizeof(bblas_complex64_t));
+			assert(R != NULL && T != NULL && W != NULL);
+			for (bblas_int matrix_iter= group_start; matrix_iter < group_end; matrix_iter++) {
+				if (kk == 0)
+					continue;
+
+				// R, the upper trapezoid of the factored A.
+				for (bblas_int j = 0; j < nn; j++)
+					for (bblas_int i = 0; i < mm; i++)
+						R[i + (size_t)ld*j] = (i <= j) ?
+							A[matrix_iter][i + (size_t)ld*j] : 0.0;
+
+				retval = LAPACKE_zlarft_work(LAPACK_COL_MAJOR, 'F', 'C',
+						mm, kk, A[matrix_iter], ld,
+						tau[matrix_iter], T, kk);
+				assert(retval == 0);
+				retval = LAPACKE_zlarfb_work(LAPACK_COL_MAJOR, 'L', 'N', 'F', 'C',
+						mm, nn, kk, A[matrix_iter], ld, T, kk,
+						R, ld, W, imax(1, nn));
+				assert(retval == 0);
+
+				double Anorm = LAPACKE_zlange_work(
+						LAPACK_COL_MAJOR, 'F', mm, nn,
+						Aref[matrix_iter], ld, work);
+
+				for (bblas_int j = 0; j < nn; j++)
+					for (bblas_int i = 0; i < mm; i++)
+						R[i + (size_t)ld*j] -= Aref[matrix_iter][i + (size_t)ld*j];
+
+				double Rnorm = LAPACKE_zlange_work(
+						LAPACK_COL_MAJOR, 'F', mm, nn, R, ld, work);
+
+				if (Anorm > 0.0)
+					error = fmax(error, Rnorm/Anorm);
+			}
+			free(R);
+			free(T);
+			free(W);
+		}
+		param[PARAM_ERROR].d = error;
+		param[PARAM_SUCCESS].i = error < param[PARAM_TOL].d*eps;
+	}
+
+	//================================================================
+	// Free arrays.
+	//================================================================
+
+	for (bblas_int matrix_iter = 0; matrix_iter < batch_count; matrix_iter++) {
+		free(A[matrix_iter]);
+		free(tau[matrix_iter]);
+
+		if (test)
+			free(Aref[matrix_iter]);
+	}
+	free(A);
+	free(tau);
+
+	if (test)
+		free(Aref);
+
+	free(info);
+}
@@ -0,0 +1,219 @@
+/**
+ *
+ * @file
+ *
+ *  BBLAS is a software package provided by:
+ *  University of Manchester, UK,
+ *  University of Tennessee, US.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+#include "test.h"
+#include "flops.h"
+#include "bblas.h"
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+
+#define COMPLEX
+
+/***************************************************************************//**
+ *
+ * @brief Tests BATCHED ZLANSY.
+ *
+ * @param[in,out] param - array of parameters
+ * @param[in]     run - whether to run test
+ *
+ * Sets used flags in param indicating parameters that are used.
+ * If run is true, also runs test and stores output parameters.
+ ******************************************************************************/
+void test_zlansy_batch(param_value_t param[], bool run)
+{
+	//================================================================
+	// Mark which parameters are used.
+	//================================================================
+	param[PARAM_NG     ].used = true;
+	param[PARAM_GS     ].used = true;
+	param[PARAM_INCM   ].used = true;
+	param[PARAM_INCG   ].used = true;
+	param[PARAM_INFO   ].used = true;
+	param[PARAM_NORM   ].used = true;
+	param[PARAM_UPLO   ].used = true;
+	param[PARAM_DIM    ].used = PARAM_USE_N;
+	if (! run)
+		return;
+
+	//================================================================
+	// Set parameters.
+	//================================================================
+
+	bblas_int group_count       = param[PARAM_NG].i;
+	bblas_int inc_group         = param[PARAM_INCG].i;
+	bblas_int first_group_size  = param[PARAM_GS].i;
+	bblas_int group_sizes[group_count];
+	for (bblas_int i=0; i < group_count; i++) {
+		group_sizes[i] = first_group_size + i*inc_group;
+	}
+
+	bblas_enum_t norm[group_count];
+	bblas_enum_t uplo[group_count];
+	for (bblas_int i=0; i < group_count; i++) {
+		norm[i] = bblas_norm_const(param[PARAM_NORM].c);
+		uplo[i] = bblas_uplo_const(param[PARAM_UPLO].c);
+	}
+
+	bblas_int inc_matrix_size = param[PARAM_INCM].i;
+	bblas_int n[group_count];
+	bblas_int lda[group_count];
+	for (bblas_int i=0; i < group_count; i++) {
+		n[i]   = param[PARAM_DIM].dim.n + i*inc_matrix_size;
+		lda[i] = imax(1, n[i]);
+	}
+
+	int test = param[PARAM_TEST].c == 'y';
+	double eps = LAPACKE_dlamch('E');
+
+	//================================================================
+	// Allocate and initialize arrays.
+	//================================================================
+
+	bblas_int batch_count = 0;
+	for (bblas_int i = 0; i < group_count; i++) {
+		batch_count += group_sizes[i];
+	}
+
+	bblas_complex64_t **A =
+		(bblas_complex64_t**)malloc((size_t)batch_count*sizeof(bblas_complex64_t*));
+	assert(A != NULL);
+
+	double *values = (double*)malloc((size_t)imax(1, batch_count)*sizeof(double));
+	assert(values != NULL);
+
+	lapack_int seed[] = {0, 0, 0, 1};
+	lapack_int retval;
+	bblas_int  group_start = 0;
+	bblas_int  group_end = 0;
+	for (bblas_int group_iter= 0; group_iter < group_count; group_iter++) {
+		group_start = group_end;
+		group_end += group_sizes[group_iter];
+		size_t asize = (size_t)lda[group_iter]*n[group_iter];
+		for (bblas_int matrix_iter= group_start; matrix_iter < group_end; matrix_iter++) {
+
+			A[matrix_iter] = (bblas_complex64_t*)malloc(
+					(asize > 0 ? asize : 1)*sizeof(bblas_complex64_t));
+			assert(A[matrix_iter] != NULL);
+
+			retval = LAPACKE_zlarnv(1, seed, asize, A[matrix_iter]);
+			assert(retval == 0);
+		}
+	}
+
+	//Set info
+	bblas_int info_size;
+	switch (bblas_info_const(param[PARAM_INFO].c)) {
+		case BblasErrorsReportAll :
+			info_size = batch_count +1;
+			break;
+		case BblasErrorsReportGroup :
+			info_size = group_count +1;
+			break;
+		case BblasErrorsReportAny :
+		case BblasErrorsReportNone :
+			info_size = 1;
+			break;
+		default :
+			bblas_error ("illegal value of info");
+			return;
+	}
+
+	bblas_int *info = (bblas_int*) malloc((size_t)info_size*sizeof(bblas_int))  ;
+	info[0] = bblas_info_const(param[PARAM_INFO].c);
+
+	//================================================================
+	// Run and time BBLAS.
+	//================================================================
+	bblas_time_t start = gettime();
+
+	blas_zlansy_batch(group_count, (const bblas_int *)group_sizes,
+			BblasColMajor, (const bblas_enum_t *)norm,
+			(const bblas_enum_t *)uplo, (const bblas_int *)n,
+			(bblas_complex64_t const *const *)A, (const bblas_int *)lda,
+			values, info);
+
+	bblas_time_t stop = gettime();
+	bblas_time_t time = stop-start;
+
+	param[PARAM_TIME].d = time;
+
+	double flops = 0;
+	for (bblas_int group_iter = 0; group_iter < group_count; group_iter++) {
+		flops += flops_zlansy(n[group_iter])*group_sizes[group_iter];
+	}
+	param[PARAM_MFLOPS].d = flops / time / 1e6;
+
+	//=====================================================================
+	// Test Batched API results against LAPACK,
+	// | values[i] - ||A[i]|| | / ||A[i]||.
+	//=====================================================================
+	if (test) {
+		double error = 0.0;
+		bool nan_ok = true;
+		group_end = 0;
+		for (bblas_int group_iter= 0; group_iter < group_count; group_iter++) {
+			group_start = group_end;
+			group_end += group_sizes[group_iter];
+			double *work = (double*)malloc(
+					(size_t)imax(1, lda[group_iter])*sizeof(double));
+			assert(work != NULL);
+			for (bblas_int matrix_iter= group_start; matrix_iter < group_end; matrix_iter++) {
+				double Anorm = LAPACKE_zlansy_work(LAPACK_COL_MAJOR,
+						lapack_const(norm[group_iter]),
+						lapack_const(uplo[group_iter]), n[group_iter],
+						A[matrix_iter], lda[group_iter], work);
+				double diff = fabs(values[matrix_iter] - Anorm);
+				error = fmax(error, (Anorm > 0.0) ? diff/Anorm : diff);
+			}
+
+			// A NaN must propagate to the norm: the first column of the
+			// first matrix is set to zeros but for one NaN, which the
+			// scaled sum of squares must not skip either.
+			if (group_sizes[group_iter] > 0 && n[group_iter] > 0) {
+				bblas_complex64_t *a = A[group_start];
+				for (bblas_int i = 0; i < n[group_iter]; i++)
+					a[i] = 0.0;
+				a[0] = NAN;
+
+				bblas_int one = 1;
+				bblas_int info_nan = BblasErrorsReportAny;
+				double value;
+				blas_zlansy_batch(1, &one, BblasColMajor, &norm[group_iter],
+						&uplo[group_iter], &n[group_iter],
+						(bblas_complex64_t const *const *)&A[group_start], &lda[group_iter],
+						&value, &info_nan);
+				if (! isnan(value))
+					nan_ok = false;
+			}
+			free(work);
+		}
+		param[PARAM_ERROR].d = error;
+		param[PARAM_SUCCESS].i = error < param[PARAM_TOL].d*eps && nan_ok;
+	}
+
+	//================================================================
+	// Free arrays.
+	//================================================================
+
+	for (bblas_int matrix_iter = 0; matrix_iter < batch_count; matrix_iter++) {
+		free(A[matrix_iter]);
+	}
+	free(A);
+	free(values);
+
+	free(info);
+}
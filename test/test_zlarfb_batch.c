@@ -0,0 +1,332 @@
+/**
+ *
+ * @file
+ *
+ *  BBLAS is a software package provided by:
+ *  University of Manchester, UK,
+ *  University of Tennessee, US.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+#include "test.h"
+#include "flops.h"
+#include "bblas.h"
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+
+#define COMPLEX
+
+/***************************************************************************//**
+ *
+ * @brief Sets the k scalar factors tau of the reflectors of order nv in
+ *        the column major V, so that they are unitary Householder
+ *        reflectors, tau(i) = 2 / (v(i)^H v(i)).
+ *
+ ******************************************************************************/
+static void zlarf_tau(bblas_enum_t direct, bblas_enum_t storev,
+                      bblas_int nv, bblas_int k,
+                      const bblas_complex64_t *V, bblas_int ldv,
+                      bblas_complex64_t *tau)
+{
+	for (bblas_int i = 0; i < k; i++) {
+		// Rows of v(i) other than its unit element and zeros.
+		bblas_int first = (direct == BblasForward) ? i+1 : 0;
+		bblas_int last  = (direct == BblasForward) ? nv : nv-k+i;
+		double norm2 = 1.0;
+		for (bblas_int r = first; r < last; r++) {
+			bblas_complex64_t v = (storev == BblasColumnwise) ?
+				V[r + (size_t)ldv*i] : V[i + (size_t)ldv*r];
+			norm2 += pow(cabs(v), 2);
+		}
+		tau[i] = 2.0/norm2;
+	}
+}
+
+/***************************************************************************//**
+ *
+ * @brief Tests BATCHED ZLARFB.
+ *
+ * The reflectors are unitary Householder reflectors, with their
+ * triangular factors formed by LAPACK zlarft.
+ *
+ * @param[in,out] param - array of parameters
+ * @param[in]     run - whether to run test
+ *
+ * Sets used flags in param indicating parameters that are used.
+ * If run is true, also runs test and stores output parameters.
+ ******************************************************************************/
+void test_zlarfb_batch(param_value_t param[], bool run)
+{
+	//================================================================
+	// Mark which parameters are used.
+	//================================================================
+	param[PARAM_NG     ].used = true;
+	param[PARAM_GS     ].used = true;
+	param[PARAM_INCM   ].used = true;
+	param[PARAM_INCG   ].used = true;
+	param[PARAM_INFO   ].used = true;
+	param[PARAM_SIDE   ].used = true;
+	param[PARAM_TRANS  ].used = true;
+	param[PARAM_DIRECT ].used = true;
+	param[PARAM_COLROW ].used = true;
+	param[PARAM_DIM    ].used = PARAM_USE_M | PARAM_USE_N | PARAM_USE_K;
+	if (! run)
+		return;
+
+	//================================================================
+	// Set parameters.
+	//================================================================
+
+	bblas_int group_count       = param[PARAM_NG].i;
+	bblas_int inc_group         = param[PARAM_INCG].i;
+	bblas_int first_group_size  = param[PARAM_GS].i;
+	bblas_int group_sizes[group_count];
+	for (bblas_int i=0; i < group_count; i++) {
+		group_sizes[i] = first_group_size + i*inc_group;
+	}
+
+	bblas_enum_t side[group_count];
+	bblas_enum_t trans[group_count];
+	bblas_enum_t direct[group_count];
+	bblas_enum_t storev[group_count];
+	for (bblas_int i=0; i < group_count; i++) {
+		side[i]   = bblas_side_const(param[PARAM_SIDE].c);
+		// H or H^H, whether transposed or conjugate transposed.
+		trans[i]  = (param[PARAM_TRANS].c == 'n') ? BblasNoTrans : Bblas_ConjTrans;
+		direct[i] = bblas_direct_const(param[PARAM_DIRECT].c);
+		storev[i] = bblas_storev_const(param[PARAM_COLROW].c);
+	}
+
+	bblas_int inc_matrix_size = param[PARAM_INCM].i;
+	bblas_int m[group_count];
+	bblas_int n[group_count];
+	bblas_int k[group_count];
+	bblas_int nv[group_count];
+	bblas_int ldv[group_count];
+	bblas_int ldt[group_count];
+	bblas_int ldc[group_count];
+	for (bblas_int i=0; i < group_count; i++) {
+		m[i]  = param[PARAM_DIM].dim.m + i*inc_matrix_size;
+		n[i]  = param[PARAM_DIM].dim.n + i*inc_matrix_size;
+		nv[i] = (side[i] == BblasLeft) ? m[i] : n[i];
+		// At most nv reflectors of order nv.
+		k[i]  = imin(param[PARAM_DIM].dim.k, nv[i]);
+		ldv[i] = imax(1, (storev[i] == BblasColumnwise) ? nv[i] : k[i]);
+		ldt[i] = imax(1, k[i]);
+		ldc[i] = imax(1, m[i]);
+	}
+
+	int test = param[PARAM_TEST].c == 'y';
+	double eps = LAPACKE_dlamch('E');
+
+	//================================================================
+	// Allocate and initialize arrays.
+	//================================================================
+
+	bblas_int batch_count = 0;
+	for (bblas_int i = 0; i < group_count; i++) {
+		batch_count += group_sizes[i];
+	}
+
+	bblas_complex64_t **V =
+		(bblas_complex64_t**)malloc((size_t)batch_count*sizeof(bblas_complex64_t*));
+	assert(V != NULL);
+
+	bblas_complex64_t **T =
+		(bblas_complex64_t**)malloc((size_t)batch_count*sizeof(bblas_complex64_t*));
+	assert(T != NULL);
+
+	bblas_complex64_t **C =
+		(bblas_complex64_t**)malloc((size_t)batch_count*sizeof(bblas_complex64_t*));
+	assert(C != NULL);
+
+	bblas_complex64_t **Cref = NULL;
+	if (test) {
+		Cref = (bblas_complex64_t**)malloc(
+				(size_t)batch_count*sizeof(bblas_complex64_t*));
+		assert(Cref != NULL);
+	}
+
+	lapack_int seed[] = {0, 0, 0, 1};
+	lapack_int retval;
+	bblas_int  group_start = 0;
+	bblas_int  group_end = 0;
+	for (bblas_int group_iter= 0; group_iter < group_count; group_iter++) {
+		group_start = group_end;
+		group_end += group_sizes[group_iter];
+		size_t vsize = (size_t)ldv[group_iter]*
+			((storev[group_iter] == BblasColumnwise) ? k[group_iter] : nv[group_iter]);
+		size_t csize = (size_t)ldc[group_iter]*n[group_iter];
+		bblas_complex64_t *tau = (bblas_complex64_t*)malloc(
+				(size_t)imax(1, k[group_iter])*sizeof(bblas_complex64_t));
+		assert(tau != NULL);
+		for (bblas_int matrix_iter= group_start; matrix_iter < group_end; matrix_iter++) {
+
+			V[matrix_iter] = (bblas_complex64_t*)malloc(
+					(vsize > 0 ? vsize : 1)*sizeof(bblas_complex64_t));
+			assert(V[matrix_iter] != NULL);
+			T[matrix_iter] = (bblas_complex64_t*)malloc(
+					(size_t)ldt[group_iter]*imax(1, k[group_iter])*
+					sizeof(bblas_complex64_t));
+			assert(T[matrix_iter] != NULL);
+			C[matrix_iter] = (bblas_complex64_t*)malloc(
+					(csize > 0 ? csize : 1)*sizeof(bblas_complex64_t));
+			assert(C[matrix_iter] != NULL);
+
+			retval = LAPACKE_zlarnv(1, seed, vsize, V[matrix_iter]);
+			assert(retval == 0);
+			zlarf_tau(direct[group_iter], storev[group_iter],
+					nv[group_iter], k[group_iter],
+					V[matrix_iter], ldv[group_iter], tau);
+			if (k[group_iter] > 0) {
+				retval = LAPACKE_zlarft_work(LAPACK_COL_MAJOR,
+						lapack_const(direct[group_iter]),
+						lapack_const(storev[group_iter]),
+						nv[group_iter], k[group_iter],
+						V[matrix_iter], ldv[group_iter],
+						tau, T[matrix_iter], ldt[group_iter]);
+				assert(retval == 0);
+			}
+			retval = LAPACKE_zlarnv(1, seed, csize, C[matrix_iter]);
+			assert(retval == 0);
+
+			if (test) {
+				Cref[matrix_iter] = (bblas_complex64_t*)malloc(
+						(csize > 0 ? csize : 1)*sizeof(bblas_complex64_t));
+				assert(Cref[matrix_iter] != NULL);
+				memcpy(Cref[matrix_iter], C[matrix_iter],
+						csize*sizeof(bblas_complex64_t));
+			}
+		}
+		free(tau);
+	}
+
+	//Set info
+	bblas_int info_size;
+	switch (bblas_info_const(param[PARAM_INFO].c)) {
+		case BblasErrorsReportAll :
+			info_size = batch_count +1;
+			break;
+		case BblasErrorsReportGroup :
+			info_size = group_count +1;
+			break;
+		case BblasErrorsReportAny :
+		case BblasErrorsReportNone :
+			info_size = 1;
+			break;
+		default :
+			bblas_error ("illegal value of info");
+			return;
+	}
+
+	bblas_int *info = (bblas_int*) malloc((size_t)info_size*sizeof(bblas_int))  ;
+	info[0] = bblas_info_const(param[PARAM_INFO].c);
+
+	//================================================================
+	// Run and time BBLAS.
+	//================================================================
+	bblas_time_t start = gettime();
+
+	blas_zlarfb_batch(group_count, (const bblas_int *)group_sizes,
+			BblasColMajor, (const bblas_enum_t *)side, (const bblas_enum_t *)trans,
+			(const bblas_enum_t *)direct, (const bblas_enum_t *)storev,
+			(const bblas_int *)m, (const bblas_int *)n, (const bblas_int *)k,
+			(bblas_complex64_t const *const *)V, (const bblas_int *)ldv,
+			(bblas_complex64_t const *const *)T, (const bblas_int *)ldt,
+			C, (const bblas_int *)ldc,
+			info);
+
+	bblas_time_t stop = gettime();
+	bblas_time_t time = stop-start;
+
+	param[PARAM_TIME].d = time;
+
+	double flops = 0;
+	for (bblas_int group_iter = 0; group_iter < group_count; group_iter++) {
+		flops += flops_zlarfb(side[group_iter], m[group_iter], n[group_iter],
+				k[group_iter])*group_sizes[group_iter];
+	}
+	param[PARAM_MFLOPS].d = flops / time / 1e6;
+
+	//=====================================================================
+	// Test Batched API results against LAPACK, || C - Cref || / || Cref ||,
+	// as the reflectors preserve the norm of C.
+	//=====================================================================
+	if (test) {
+		double error = 0.0;
+		double work[1];
+		group_end = 0;
+		for (bblas_int group_iter= 0; group_iter < group_count; group_iter++) {
+			group_start = group_end;
+			group_end += group_sizes[group_iter];
+			bblas_int ldwork = imax(1, (side[group_iter] == BblasLeft) ?
+					n[group_iter] : m[group_iter]);
+			bblas_complex64_t *W = (bblas_complex64_t*)malloc(
+					(size_t)ldwork*imax(1, k[group_iter])*sizeof(bblas_complex64_t));
+			assert(W != NULL);
+			for (bblas_int matrix_iter= group_start; matrix_iter < group_end; matrix_iter++) {
+				if (m[group_iter] == 0 || n[group_iter] == 0 || k[group_iter] == 0)
+					continue;
+
+				retval = LAPACKE_zlarfb_work(LAPACK_COL_MAJOR,
+						lapack_const(side[group_iter]),
+						lapack_const(trans[group_iter]),
+						lapack_const(direct[group_iter]),
+						lapack_const(storev[group_iter]),
+						m[group_iter], n[group_iter], k[group_iter],
+						V[matrix_iter], ldv[group_iter],
+						T[matrix_iter], ldt[group_iter],
+						Cref[matrix_iter], ldc[group_iter],
+						W, ldwork);
+				assert(retval == 0);
+
+				double Cnorm = LAPACKE_zlange_work(
+						LAPACK_COL_MAJOR, 'F', m[group_iter], n[group_iter],
+						Cref[matrix_iter], ldc[group_iter], work);
+
+				for (bblas_int j = 0; j < n[group_iter]; j++)
+					for (bblas_int i = 0; i < m[group_iter]; i++)
+						Cref[matrix_iter][i + (size_t)ldc[group_iter]*j] -=
+							C[matrix_iter][i + (size_t)ldc[group_iter]*j];
+
+				double Rnorm = LAPACKE_zlange_work(
+						LAPACK_COL_MAJOR, 'F', m[group_iter], n[group_iter],
+						Cref[matrix_iter], ldc[group_iter], work);
+
+				if (Cnorm > 0.0)
+					error = fmax(error, Rnorm/Cnorm);
+			}
+			free(W);
+		}
+		param[PARAM_ERROR].d = error;
+		param[PARAM_SUCCESS].i = error < param[PARAM_TOL].d*eps;
+	}
+
+	//================================================================
+	// Free arrays.
+	//================================================================
+
+	for (bblas_int matrix_iter = 0; matrix_iter < batch_count; matrix_iter++) {
+		free(V[matrix_iter]);
+		free(T[matrix_iter]);
+		free(C[matrix_iter]);
+
+		if (test)
+			free(Cref[matrix_iter]);
+	}
+	free(V);
+	free(T);
+	free(C);
+
+	if (test)
+		free(Cref);
+
+	free(info);
+}
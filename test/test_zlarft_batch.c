@@ -0,0 +1,276 @@
+/**
+ *
+ * @file
+ *
+ *  BBLAS is a software package provided by:
+ *  University of Manchester, UK,
+ *  University of Tennessee, US.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+#include "test.h"
+#include "flops.h"
+#include "bblas.h"
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+
+#define COMPLEX
+
+/***************************************************************************//**
+ *
+ * @brief Sets the k scalar factors tau of the reflectors of order nv in
+ *        the column major V, so that they are unitary Householder
+ *        reflectors, tau(i) = 2 / (v(i)^H v(i)).
+ *
+ ******************************************************************************/
+static void zlarf_tau(bblas_enum_t direct, bblas_enum_t storev,
+                      bblas_int nv, bblas_int k,
+                      const bblas_complex64_t *V, bblas_int ldv,
+                      bblas_complex64_t *tau)
+{
+	for (bblas_int i = 0; i < k; i++) {
+		// Rows of v(i) other than its unit element and zeros.
+		bblas_int first = (direct == BblasForward) ? i+1 : 0;
+		bblas_int last  = (direct == BblasForward) ? nv : nv-k+i;
+		double norm2 = 1.0;
+		for (bblas_int r = first; r < last; r++) {
+			bblas_complex64_t v = (storev == BblasColumnwise) ?
+				V[r + (size_t)ldv*i] : V[i + (size_t)ldv*r];
+			norm2 += pow(cabs(v), 2);
+		}
+		tau[i] = 2.0/norm2;
+	}
+}
+
+/***************************************************************************//**
+ *
+ * @brief Tests BATCHED ZLARFT.
+ *
+ * @param[in,out] param - array of parameters
+ * @param[in]     run - whether to run test
+ *
+ * Sets used flags in param indicating parameters that are used.
+ * If run is true, also runs test and stores output parameters.
+ ******************************************************************************/
+void test_zlarft_batch(param_value_t param[], bool run)
+{
+	//================================================================
+	// Mark which parameters are used.
+	//================================================================
+	param[PARAM_NG     ].used = true;
+	param[PARAM_GS     ].used = true;
+	param[PARAM_INCM   ].used = true;
+	param[PARAM_INCG   ].used = true;
+	param[PARAM_INFO   ].used = true;
+	param[PARAM_DIRECT ].used = true;
+	param[PARAM_COLROW ].used = true;
+	param[PARAM_DIM    ].used = PARAM_USE_N | PARAM_USE_K;
+	if (! run)
+		return;
+
+	//================================================================
+	// Set parameters.
+	//================================================================
+
+	bblas_int group_count       = param[PARAM_NG].i;
+	bblas_int inc_group         = param[PARAM_INCG].i;
+	bblas_int first_group_size  = param[PARAM_GS].i;
+	bblas_int group_sizes[group_count];
+	for (bblas_int i=0; i < group_count; i++) {
+		group_sizes[i] = first_group_size + i*inc_group;
+	}
+
+	bblas_enum_t direct[group_count];
+	bblas_enum_t storev[group_count];
+	for (bblas_int i=0; i < group_count; i++) {
+		direct[i] = bblas_direct_const(param[PARAM_DIRECT].c);
+		storev[i] = bblas_storev_const(param[PARAM_COLROW].c);
+	}
+
+	bblas_int inc_matrix_size = param[PARAM_INCM].i;
+	bblas_int n[group_count];
+	bblas_int k[group_count];
+	bblas_int ldv[group_count];
+	bblas_int ldt[group_count];
+	for (bblas_int i=0; i < group_count; i++) {
+		n[i] = param[PARAM_DIM].dim.n + i*inc_matrix_size;
+		// At most n reflectors of order n.
+		k[i] = imin(param[PARAM_DIM].dim.k, n[i]);
+		ldv[i] = imax(1, (storev[i] == BblasColumnwise) ? n[i] : k[i]);
+		ldt[i] = imax(1, k[i]);
+	}
+
+	int test = param[PARAM_TEST].c == 'y';
+	double eps = LAPACKE_dlamch('E');
+
+	//================================================================
+	// Allocate and initialize arrays.
+	//================================================================
+
+	bblas_int batch_count = 0;
+	for (bblas_int i = 0; i < group_count; i++) {
+		batch_count += group_sizes[i];
+	}
+
+	bblas_complex64_t **V =
+		(bblas_complex64_t**)malloc((size_t)batch_count*sizeof(bblas_complex64_t*));
+	assert(V != NULL);
+
+	bblas_complex64_t **tau =
+		(bblas_complex64_t**)malloc((size_t)batch_count*sizeof(bblas_complex64_t*));
+	assert(tau != NULL);
+
+	bblas_complex64_t **T =
+		(bblas_complex64_t**)malloc((size_t)batch_count*sizeof(bblas_complex64_t*));
+	assert(T != NULL);
+
+	lapack_int seed[] = {0, 0, 0, 1};
+	lapack_int retval;
+	bblas_int  group_start = 0;
+	bblas_int  group_end = 0;
+	for (bblas_int group_iter= 0; group_iter < group_count; group_iter++) {
+		group_start = group_end;
+		group_end += group_sizes[group_iter];
+		size_t vsize = (size_t)ldv[group_iter]*
+			((storev[group_iter] == BblasColumnwise) ? k[group_iter] : n[group_iter]);
+		for (bblas_int matrix_iter= group_start; matrix_iter < group_end; matrix_iter++) {
+
+			V[matrix_iter] = (bblas_complex64_t*)malloc(
+					(vsize > 0 ? vsize : 1)*sizeof(bblas_complex64_t));
+			assert(V[matrix_iter] != NULL);
+			tau[matrix_iter] = (bblas_complex64_t*)malloc(
+					(size_t)imax(1, k[group_iter])*sizeof(bblas_complex64_t));
+			assert(tau[matrix_iter] != NULL);
+			T[matrix_iter] = (bblas_complex64_t*)malloc(
+					(size_t)ldt[group_iter]*imax(1, k[group_iter])*
+					sizeof(bblas_complex64_t));
+			assert(T[matrix_iter] != NULL);
+
+			retval = LAPACKE_zlarnv(1, seed, vsize, V[matrix_iter]);
+			assert(retval == 0);
+			zlarf_tau(direct[group_iter], storev[group_iter],
+					n[group_iter], k[group_iter],
+					V[matrix_iter], ldv[group_iter], tau[matrix_iter]);
+		}
+	}
+
+	//Set info
+	bblas_int info_size;
+	switch (bblas_info_const(param[PARAM_INFO].c)) {
+		case BblasErrorsReportAll :
+			info_size = batch_count +1;
+			break;
+		case BblasErrorsReportGroup :
+			info_size = group_count +1;
+			break;
+		case BblasErrorsReportAny :
+		case BblasErrorsReportNone :
+			info_size = 1;
+			break;
+		default :
+			bblas_error ("illegal value of info");
+			return;
+	}
+
+	bblas_int *info = (bblas_int*) malloc((size_t)info_size*sizeof(bblas_int))  ;
+	info[0] = bblas_info_const(param[PARAM_INFO].c);
+
+	//================================================================
+	// Run and time BBLAS.
+	//================================================================
+	bblas_time_t start = gettime();
+
+	blas_zlarft_batch(group_count, (const bblas_int *)group_sizes,
+			BblasColMajor, (const bblas_enum_t *)direct, (const bblas_enum_t *)storev,
+			(const bblas_int *)n, (const bblas_int *)k,
+			(bblas_complex64_t const *const *)V, (const bblas_int *)ldv,
+			(bblas_complex64_t const *const *)tau,
+			T, (const bblas_int *)ldt,
+			info);
+
+	bblas_time_t stop = gettime();
+	bblas_time_t time = stop-start;
+
+	param[PARAM_TIME].d = time;
+
+	double flops = 0;
+	for (bblas_int group_iter = 0; group_iter < group_count; group_iter++) {
+		flops += flops_zlarft(n[group_iter], k[group_iter])*group_sizes[group_iter];
+	}
+	param[PARAM_MFLOPS].d = flops / time / 1e6;
+
+	//=====================================================================
+	// Test Batched API results against LAPACK, || T - Tref || / || Tref ||
+	// on the triangle of T.
+	//=====================================================================
+	if (test) {
+		double error = 0.0;
+		double work[1];
+		group_end = 0;
+		for (bblas_int group_iter= 0; group_iter < group_count; group_iter++) {
+			group_start = group_end;
+			group_end += group_sizes[group_iter];
+			bblas_int kk = k[group_iter];
+			char uplo = (direct[group_iter] == BblasForward) ? 'U' : 'L';
+			bblas_complex64_t *Tref = (bblas_complex64_t*)malloc(
+					(size_t)ldt[group_iter]*imax(1, kk)*sizeof(bblas_complex64_t));
+			assert(Tref != NULL);
+			for (bblas_int matrix_iter= group_start; matrix_iter < group_end; matrix_iter++) {
+				if (kk == 0)
+					continue;
+
+				retval = LAPACKE_zlarft_work(LAPACK_COL_MAJOR,
+						lapack_const(direct[group_iter]),
+						lapack_const(storev[group_iter]),
+						n[group_iter], kk,
+						V[matrix_iter], ldv[group_iter],
+						tau[matrix_iter], Tref, ldt[group_iter]);
+				assert(retval == 0);
+
+				double Tnorm = LAPACKE_zlantr_work(
+						LAPACK_COL_MAJOR, 'F', uplo, 'N', kk, kk,
+						Tref, ldt[group_iter], work);
+
+				for (bblas_int j = 0; j < kk; j++) {
+					bblas_int first = (uplo == 'U') ? 0 : j;
+					bblas_int last  = (uplo == 'U') ? j+1 : kk;
+					for (bblas_int i = first; i < last; i++)
+						Tref[i + (size_t)ldt[group_iter]*j] -=
+							T[matrix_iter][i + (size_t)ldt[group_iter]*j];
+				}
+
+				double Rnorm = LAPACKE_zlantr_work(
+						LAPACK_COL_MAJOR, 'F', uplo, 'N', kk, kk,
+						Tref, ldt[group_iter], work);
+
+				if (Tnorm > 0.0)
+					error = fmax(error, Rnorm/Tnorm);
+			}
+			free(Tref);
+		}
+		param[PARAM_ERROR].d = error;
+		param[PARAM_SUCCESS].i = error < param[PARAM_TOL].d*eps;
+	}
+
+	//================================================================
+	// Free arrays.
+	//================================================================
+
+	for (bblas_int matrix_iter = 0; matrix_iter < batch_count; matrix_iter++) {
+		free(V[matrix_iter]);
+		free(tau[matrix_iter]);
+		free(T[matrix_iter]);
+	}
+	free(V);
+	free(tau);
+	free(T);
+
+	free(info);
+}
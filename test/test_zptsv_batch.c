@@ -0,0 +1,303 @@
+/**
+ *
+ * @file
+ *
+ *  BBLAS is a software package provided by:
+ *  University of Manchester, UK,
+ *  University of Tennessee, US.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+#include "test.h"
+#include "flops.h"
+#include "bblas.h"
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+
+#define COMPLEX
+
+/***************************************************************************//**
+ *
+ * @brief Tests BATCHED ZPTSV.
+ *
+ * The matrices are diagonally dominant with a positive diagonal.
+ * With --strided=y, the systems of each group are interleaved and solved
+ * by blas_zptsv_batch_strided, one call per group.
+ *
+ * @param[in,out] param - array of parameters
+ * @param[in]     run - whether to run test
+ *
+ * Sets used flags in param indicating parameters that are used.
+ * If run is true, also runs test and stores output parameters.
+ ******************************************************************************/
+void test_zptsv_batch(param_value_t param[], bool run)
+{
+	//================================================================
+	// Mark which parameters are used.
+	//================================================================
+	param[PARAM_NG     ].used = true;
+	param[PARAM_GS     ].used = true;
+	param[PARAM_INCM   ].used = true;
+	param[PARAM_INCG   ].used = true;
+	param[PARAM_INFO   ].used = true;
+	param[PARAM_STRIDED].used = true;
+	param[PARAM_DIM    ].used = PARAM_USE_N;
+	param[PARAM_NRHS   ].used = true;
+	if (! run)
+		return;
+
+	//================================================================
+	// Set parameters.
+	//================================================================
+
+	bblas_int group_count       = param[PARAM_NG].i;
+	bblas_int inc_group         = param[PARAM_INCG].i;
+	bblas_int first_group_size  = param[PARAM_GS].i;
+	bblas_int group_sizes[group_count];
+	for (bblas_int i=0; i < group_count; i++) {
+		group_sizes[i] = first_group_size + i*inc_group;
+	}
+
+	bblas_int inc_matrix_size = param[PARAM_INCM].i;
+	bblas_int n[group_count];
+	bblas_int nrhs[group_count];
+	bblas_int ldb[group_count];
+	for (bblas_int i=0; i < group_count; i++) {
+		n[i]    = param[PARAM_DIM].dim.n + i*inc_matrix_size;
+		nrhs[i] = param[PARAM_NRHS].i;
+		ldb[i]  = imax(1, n[i]);
+	}
+
+	// Element k of the vectors of system i of group g is at
+	// i*stridet[g] + k*inct[g] in the pools of the group, and element
+	// (k, j) of its B at i*strideb[g] + k*incb[g] + j*ldbs[g].
+	bool strided = param[PARAM_STRIDED].c == 'y';
+	bblas_int inct[group_count], stridet[group_count];
+	bblas_int incb[group_count], ldbs[group_count], strideb[group_count];
+	for (bblas_int i=0; i < group_count; i++) {
+		bblas_int gs = imax(1, group_sizes[i]);
+		if (strided) {
+			inct[i]    = gs;
+			stridet[i] = 1;
+			incb[i]    = gs;
+			ldbs[i]    = gs*ldb[i];
+			strideb[i] = 1;
+		}
+		else {
+			inct[i]    = 1;
+			stridet[i] = ldb[i];
+			incb[i]    = 1;
+			ldbs[i]    = ldb[i];
+			strideb[i] = ldb[i]*nrhs[i];
+		}
+	}
+
+	int test = param[PARAM_TEST].c == 'y';
+	double eps = LAPACKE_dlamch('E');
+
+	//================================================================
+	// Allocate and initialize arrays.
+	//================================================================
+
+	bblas_int batch_count = 0;
+	for (bblas_int i = 0; i < group_count; i++) {
+		batch_count += group_sizes[i];
+	}
+
+	// One pool per operand and group, and their copies for the test.
+	double *Pd[group_count], *Rd[group_count];
+	bblas_complex64_t *Pe[group_count], *PB[group_count];
+	bblas_complex64_t *Re[group_count], *RB[group_count];
+
+	lapack_int seed[] = {0, 0, 0, 1};
+	lapack_int retval;
+	for (bblas_int g = 0; g < group_count; g++) {
+		size_t tlen = (size_t)imax(1, group_sizes[g])*ldb[g];
+		size_t blen = tlen*imax(1, nrhs[g]);
+		Pd[g] = (double*)malloc(tlen*sizeof(double));
+		Pe[g] = (bblas_complex64_t*)malloc(tlen*sizeof(bblas_complex64_t));
+		PB[g] = (bblas_complex64_t*)malloc(blen*sizeof(bblas_complex64_t));
+		assert(Pd[g] != NULL && Pe[g] != NULL && PB[g] != NULL);
+
+		retval = LAPACKE_zlarnv(2, seed, tlen, Pe[g]);
+		assert(retval == 0);
+		retval = LAPACKE_zlarnv(1, seed, blen, PB[g]);
+		assert(retval == 0);
+
+		// Diagonally dominant, hence positive definite, matrices.
+		for (bblas_int i = 0; i < group_sizes[g]; i++) {
+			double *di = Pd[g] + (size_t)stridet[g]*i;
+			const bblas_complex64_t *ei = Pe[g] + (size_t)stridet[g]*i;
+			for (bblas_int k = 0; k < n[g]; k++) {
+				di[(size_t)inct[g]*k] = 1.0;
+				if (k > 0)
+					di[(size_t)inct[g]*k] += cabs(ei[(size_t)inct[g]*(k-1)]);
+				if (k < n[g]-1)
+					di[(size_t)inct[g]*k] += cabs(ei[(size_t)inct[g]*k]);
+			}
+		}
+
+		if (test) {
+			Rd[g] = (double*)malloc(tlen*sizeof(double));
+			Re[g] = (bblas_complex64_t*)malloc(tlen*sizeof(bblas_complex64_t));
+			RB[g] = (bblas_complex64_t*)malloc(blen*sizeof(bblas_complex64_t));
+			assert(Rd[g] != NULL && Re[g] != NULL && RB[g] != NULL);
+			memcpy(Rd[g], Pd[g], tlen*sizeof(double));
+			memcpy(Re[g], Pe[g], tlen*sizeof(bblas_complex64_t));
+			memcpy(RB[g], PB[g], blen*sizeof(bblas_complex64_t));
+		}
+	}
+
+	// Pointers to the systems, for the group API.
+	double **d =
+		(double**)malloc((size_t)imax(1, batch_count)*sizeof(double*));
+	bblas_complex64_t **e =
+		(bblas_complex64_t**)malloc((size_t)imax(1, batch_count)*sizeof(bblas_complex64_t*));
+	bblas_complex64_t **B =
+		(bblas_complex64_t**)malloc((size_t)imax(1, batch_count)*sizeof(bblas_complex64_t*));
+	assert(d != NULL && e != NULL && B != NULL);
+	bblas_int group_start = 0;
+	for (bblas_int g = 0; g < group_count; g++) {
+		for (bblas_int i = 0; i < group_sizes[g]; i++) {
+			d[group_start+i] = Pd[g] + (size_t)stridet[g]*i;
+			e[group_start+i] = Pe[g] + (size_t)stridet[g]*i;
+			B [group_start+i] = PB [g] + (size_t)strideb[g]*i;
+		}
+		group_start += group_sizes[g];
+	}
+
+	//Set info
+	bblas_int info_size;
+	switch (bblas_info_const(param[PARAM_INFO].c)) {
+		case BblasErrorsReportAll :
+			info_size = batch_count +1;
+			break;
+		case BblasErrorsReportGroup :
+			info_size = group_count +1;
+			break;
+		case BblasErrorsReportAny :
+		case BblasErrorsReportNone :
+			info_size = 1;
+			break;
+		default :
+			bblas_error ("illegal value of info");
+			return;
+	}
+
+	bblas_int *info = (bblas_int*) malloc((size_t)info_size*sizeof(bblas_int))  ;
+	info[0] = bblas_info_const(param[PARAM_INFO].c);
+
+	//================================================================
+	// Run and time BBLAS.
+	//================================================================
+	bblas_time_t start = gettime();
+
+	if (strided) {
+		// As many info as the largest group, if all are reported.
+		for (bblas_int g = 0; g < group_count; g++) {
+			info[0] = bblas_info_const(param[PARAM_INFO].c);
+			bblas_int *info_g = (bblas_int*)malloc(
+				(size_t)imax(1, group_sizes[g])*sizeof(bblas_int));
+			info_g[0] = info[0];
+			blas_zptsv_batch_strided(n[g], nrhs[g],
+					Pd[g], Pe[g], inct[g], stridet[g],
+					PB[g], incb[g], ldbs[g], strideb[g],
+					group_sizes[g], info_g);
+			free(info_g);
+		}
+	}
+	else
+		blas_zptsv_batch(group_count, (const bblas_int *)group_sizes,
+				BblasColMajor, (const bblas_int *)n, (const bblas_int *)nrhs,
+				d, e,
+				B, (const bblas_int *)ldb,
+				info);
+
+	bblas_time_t stop = gettime();
+	bblas_time_t time = stop-start;
+
+	param[PARAM_TIME].d = time;
+
+	double flops = 0;
+	for (bblas_int g = 0; g < group_count; g++) {
+		flops += flops_zptsv(n[g], nrhs[g])*group_sizes[g];
+	}
+	param[PARAM_MFLOPS].d = flops / time / 1e6;
+
+	//=====================================================================
+	// Test Batched API results by the residuals of the solutions,
+	// || B - A X || / ( || A || || X || ).
+	//=====================================================================
+	if (test) {
+		double error = 0.0;
+		for (bblas_int g = 0; g < group_count; g++) {
+			for (bblas_int i = 0; i < group_sizes[g]; i++) {
+				const double *td = Rd[g] + (size_t)stridet[g]*i;
+				const bblas_complex64_t *te = Re[g] + (size_t)stridet[g]*i;
+				const bblas_complex64_t *b  = RB[g] + (size_t)strideb[g]*i;
+				const bblas_complex64_t *x  = PB[g] + (size_t)strideb[g]*i;
+				bblas_int it = inct[g];
+				bblas_int ib = incb[g];
+
+				double Anorm = 0.0;
+				for (bblas_int k = 0; k < n[g]; k++) {
+					Anorm += pow(td[(size_t)it*k], 2);
+					if (k < n[g]-1)
+						Anorm += 2.0*pow(cabs(te[(size_t)it*k]), 2);
+				}
+				double Xnorm = 0.0;
+				double Rnorm = 0.0;
+				for (bblas_int j = 0; j < nrhs[g]; j++) {
+					const bblas_complex64_t *bj = b + (size_t)ldbs[g]*j;
+					const bblas_complex64_t *xj = x + (size_t)ldbs[g]*j;
+					for (bblas_int k = 0; k < n[g]; k++) {
+						bblas_complex64_t r = bj[(size_t)ib*k]
+							- td[(size_t)it*k]*xj[(size_t)ib*k];
+						if (k > 0)
+							r -= te[(size_t)it*(k-1)]*xj[(size_t)ib*(k-1)];
+#ifdef COMPLEX
+						if (k < n[g]-1)
+							r -= conj(te[(size_t)it*k])*xj[(size_t)ib*(k+1)];
+#else
+						if (k < n[g]-1)
+							r -= te[(size_t)it*k]*xj[(size_t)ib*(k+1)];
+#endif
+						Rnorm += pow(cabs(r), 2);
+						Xnorm += pow(cabs(xj[(size_t)ib*k]), 2);
+					}
+				}
+				if (Anorm*Xnorm > 0.0)
+					error = fmax(error, sqrt(Rnorm/(Anorm*Xnorm)));
+			}
+		}
+		param[PARAM_ERROR].d = error;
+		param[PARAM_SUCCESS].i = error < param[PARAM_TOL].d*eps;
+	}
+
+	//================================================================
+	// Free arrays.
+	//================================================================
+
+	for (bblas_int g = 0; g < group_count; g++) {
+		free(Pd[g]);
+		free(Pe[g]);
+		free(PB[g]);
+		if (test) {
+			free(Rd[g]);
+			free(Re[g]);
+			free(RB[g]);
+		}
+	}
+	free(d);
+	free(e);
+	free(B);
+
+	free(info);
+}
@@ -45,8 +45,14 @@ void test_zsymm_batch(param_value_t param[], bool run)
 	param[PARAM_SIDE   ].used = true;
 	param[PARAM_UPLO   ].used = true;
 	param[PARAM_INFO   ].used = true;
+	param[PARAM_ALLOC  ].used = true;
+	param[PARAM_PAD    ].used = true;
+	param[PARAM_OFFSET ].used = true;
 	param[PARAM_DIM    ].used = PARAM_USE_M | PARAM_USE_N;
 	param[PARAM_ALPHA  ].used = true;
+	param[PARAM_LAYOUTS].used = true;
+	param[PARAM_SHARED ].used = true;
+	param[PARAM_BLOCKS ].used = true;
 	param[PARAM_BETA   ].used = true;
 
 	if (! run)
@@ -56,45 +62,45 @@ void test_zsymm_batch(param_value_t param[], bool run)
 	// Set parameters.
 	//================================================================
 
-	int group_count = param[PARAM_NG].i;
+	bblas_int group_count = param[PARAM_NG].i;
 
-	int group_sizes[group_count];
-	int first_group_size  = param[PARAM_GS].i;
-	int inc_group = param[PARAM_INCG].i;
-	for (int i=0; i < group_count; i++) {
+	bblas_int group_sizes[group_count];
+	bblas_int first_group_size  = param[PARAM_GS].i;
+	bblas_int inc_group = param[PARAM_INCG].i;
+	for (bblas_int i=0; i < group_count; i++) {
 		group_sizes[i] = first_group_size + i*inc_group;
 	}
 
 	bblas_enum_t side[group_count]; 
 	bblas_enum_t uplo[group_count];
-	for (int i = 0; i < group_count; ++i) {
+	for (bblas_int i = 0; i < group_count; ++i) {
 		side[i] = bblas_side_const(param[PARAM_SIDE].c);
 		uplo[i] = bblas_uplo_const(param[PARAM_UPLO].c);
 	}
 
-	int *m = (int*)malloc((size_t)group_count*sizeof(int));
-	int *n = (int*)malloc((size_t)group_count*sizeof(int));
-	int size_incre = param[PARAM_INCM].i;
+	bblas_int *m = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
+	bblas_int *n = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
+	bblas_int size_incre = param[PARAM_INCM].i;
 	m[0] = param[PARAM_DIM].dim.m;
 	n[0] = param[PARAM_DIM].dim.n;
-	for (int i = 1; i < group_count; ++i) {
+	for (bblas_int i = 1; i < group_count; ++i) {
 		m[i] = m[i-1] + size_incre;
 		n[i] = n[i-1] + size_incre;
 	}
 
-	int *lda = (int*)malloc((size_t)group_count*sizeof(int));
-	int *ldb = (int*)malloc((size_t)group_count*sizeof(int));
-	int *ldc = (int*)malloc((size_t)group_count*sizeof(int));
+	bblas_int *lda = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
+	bblas_int *ldb = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
+	bblas_int *ldc = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
 
-	int *An = (int*)malloc((size_t)group_count*sizeof(int));
-	int *Bn = (int*)malloc((size_t)group_count*sizeof(int));
-	int *Cn = (int*)malloc((size_t)group_count*sizeof(int));
+	bblas_int *An = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
+	bblas_int *Bn = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
+	bblas_int *Cn = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
 
-	int *Am = (int*)malloc((size_t)group_count*sizeof(int));
-	int *Bm = (int*)malloc((size_t)group_count*sizeof(int));
-	int *Cm = (int*)malloc((size_t)group_count*sizeof(int));
+	bblas_int *Am = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
+	bblas_int *Bm = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
+	bblas_int *Cm = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
 
-	for (int i = 0; i < group_count; ++i) {
+	for (bblas_int i = 0; i < group_count; ++i) {
 		if (side[i] == BblasLeft) {
 			Am[i] = m[i];
 			An[i] = m[i];
@@ -120,14 +126,14 @@ void test_zsymm_batch(param_value_t param[], bool run)
 #ifdef COMPLEX
 	bblas_complex64_t alpha[group_count];
 	bblas_complex64_t beta[group_count];
-	for (int i = 0; i < group_count; i++) {
+	for (bblas_int i = 0; i < group_count; i++) {
 		alpha[i] =  param[PARAM_ALPHA].z;
 		beta[i]  =  param[PARAM_BETA].z;
 	}
 #else
 	double alpha[group_count];
 	double beta[group_count];
-	for (int i = 0; i < group_count; i++) {
+	for (bblas_int i = 0; i < group_count; i++) {
 		alpha[i] = creal(param[PARAM_ALPHA].z);
 		beta[i]  = creal(param[PARAM_BETA].z);
 	}
@@ -137,8 +143,8 @@ void test_zsymm_batch(param_value_t param[], bool run)
 	// Allocate and initialize arrays.
 	//================================================================
 
-	int batch_count =0;
-	for (int i = 0; i < group_count; i++) {
+	bblas_int batch_count =0;
+	for (bblas_int i = 0; i < group_count; i++) {
 		batch_count += group_sizes[i];
 	}
 
@@ -162,56 +168,123 @@ void test_zsymm_batch(param_value_t param[], bool run)
 	}
 
 
-	int seed[] = {0, 0, 0, 1};
-	lapack_int retval;
-	int  group_start=0;
-	int  group_end =0;
-	for (int group_iter= 0; group_iter < group_count; group_iter++) {
-		group_start = group_end;
-		group_end += group_sizes[group_iter];
-		for (int matrix_iter= group_start; matrix_iter < group_end; matrix_iter++) {
+	// With --pad=y, the leading dimensions are padded to avoid cache set
+	// aliasing.
+	if (param[PARAM_PAD].c == 'y') {
+		bblas_advise_ld(group_count, An, sizeof(bblas_complex64_t), lda);
+		bblas_advise_ld(group_count, Bn, sizeof(bblas_complex64_t), ldb);
+		bblas_advise_ld(group_count, Cn, sizeof(bblas_complex64_t), ldc);
+	}
+
+	// With --shared=y, all the A[i] of a group are one matrix, and with
+	// --blocks=y, the B[i] and the C[i] of the group are consecutive blocks
+	// of two matrices: side by side on the left, on top of each other on
+	// the right. These groups are done by a single symm.
+	char share_op[] = { 'n', 'n', 'n' };
+	if (param[PARAM_SHARED].c == 'y') {
+		share_op[0] = 's';
+		if (param[PARAM_BLOCKS].c == 'y') {
+			if (bblas_side_const(param[PARAM_SIDE].c) == BblasLeft) {
+				share_op[1] = share_op[2] = 'h';
+			}
+			else {
+				share_op[1] = share_op[2] = 'v';
+				for (bblas_int i = 0; i < group_count; i++) {
+					ldb[i] = imax(ldb[i], Bm[i]*group_sizes[i]);
+					ldc[i] = imax(ldc[i], Cm[i]*group_sizes[i]);
+				}
+			}
+		}
+	}
+	bool shared = share_op[0] == 's';
+
+	// With --alloc=y, all the matrices come from one arena instead of
+	// one malloc each; --offset=y addresses them by offsets into it,
+	// or into the pool of --shared.
+	bool offsets = param[PARAM_OFFSET].c == 'y';
+	bool contiguous = param[PARAM_ALLOC].c == 'y' || offsets || shared;
+	bblas_arena_t arena = NULL;
+	bblas_complex64_t *pool = NULL;
+	size_t pool_size = 0;
+	if (shared) {
+		const bblas_int *rows_op[] = { Am, Bm, Cm };
+		const bblas_int *ld_op[]   = { lda, ldb, ldc };
+		const bblas_int *cols_op[] = { An, Bn, Cn };
+		void **X_op[]              = { (void**)A, (void**)B, (void**)C };
+		pool = (bblas_complex64_t*)pool_shared(group_count, group_sizes, 3,
+		                                       share_op, rows_op, ld_op, cols_op,
+		                                       sizeof(bblas_complex64_t), X_op,
+		                                       &pool_size);
+	}
+	else if (contiguous) {
+		const bblas_int *ld_op[]   = { lda, ldb, ldc };
+		const bblas_int *cols_op[] = { An, Bn, Cn };
+		size_t size_op[]     = { sizeof(bblas_complex64_t), sizeof(bblas_complex64_t), sizeof(bblas_complex64_t) };
+		void **X_op[]        = { (void**)A, (void**)B, (void**)C };
+		arena = bblas_batch_alloc(group_count, group_sizes, 3,
+		                          ld_op, cols_op, size_op, X_op);
+		assert(arena != NULL);
+	}
 
-			A[matrix_iter] = (bblas_complex64_t*)malloc(
-					(size_t)lda[group_iter]*An[group_iter]*sizeof(
-						bblas_complex64_t));
-			assert(A[matrix_iter] != NULL);
+	lapack_int seed[] = {0, 0, 0, 1};
+	lapack_int retval;
 
-			B[matrix_iter] = (bblas_complex64_t*)malloc(
-					(size_t)ldb[group_iter]*Bn[group_iter]*sizeof(
-						bblas_complex64_t));
-			assert(B[matrix_iter] != NULL);
+	if (shared) {
+		retval = LAPACKE_zlarnv(1, seed, pool_size, pool);
+		assert(retval == 0);
+	}
 
-			C[matrix_iter] = (bblas_complex64_t*)malloc(
-					(size_t)ldc[group_iter]*Cn[group_iter]*sizeof(
-						bblas_complex64_t));
-			assert(C[matrix_iter] != NULL);
+	bblas_int  group_start=0;
+	bblas_int  group_end =0;
+	for (bblas_int group_iter= 0; group_iter < group_count; group_iter++) {
+		group_start = group_end;
+		group_end += group_sizes[group_iter];
+		for (bblas_int matrix_iter= group_start; matrix_iter < group_end; matrix_iter++) {
+
+			if (! contiguous) {
+				A[matrix_iter] = (bblas_complex64_t*)malloc(
+						(size_t)lda[group_iter]*An[group_iter]*sizeof(bblas_complex64_t));
+				assert(A[matrix_iter] != NULL);
+				B[matrix_iter] = (bblas_complex64_t*)malloc(
+						(size_t)ldb[group_iter]*Bn[group_iter]*sizeof(bblas_complex64_t));
+				assert(B[matrix_iter] != NULL);
+				C[matrix_iter] = (bblas_complex64_t*)malloc(
+						(size_t)ldc[group_iter]*Cn[group_iter]*sizeof(bblas_complex64_t));
+				assert(C[matrix_iter] != NULL);
+			}
 
-			retval = LAPACKE_zlarnv(1, seed, (size_t)lda[group_iter]*An[group_iter], 
-					A[matrix_iter]);
-			assert(retval == 0);
+			if (! shared) {
+				retval = LAPACKE_zlarnv(1, seed, (size_t)lda[group_iter]*An[group_iter], 
+						A[matrix_iter]);
+				assert(retval == 0);
 
-			retval = LAPACKE_zlarnv(1, seed, (size_t)ldb[group_iter]*Bn[group_iter], 
-					B[matrix_iter]);
-			assert(retval == 0);
+				retval = LAPACKE_zlarnv(1, seed, (size_t)ldb[group_iter]*Bn[group_iter], 
+						B[matrix_iter]);
+				assert(retval == 0);
 
-			retval = LAPACKE_zlarnv(1, seed, (size_t)ldc[group_iter]*Cn[group_iter], 
-					C[matrix_iter]);
-			assert(retval == 0);
+				retval = LAPACKE_zlarnv(1, seed, (size_t)ldc[group_iter]*Cn[group_iter], 
+						C[matrix_iter]);
+				assert(retval == 0);
+			}
 
+			// C[i] column by column, as the blocks of --blocks=y overlap
+			// within their leading dimension.
 			if (test) {
 				Cref[matrix_iter] = (bblas_complex64_t*)malloc(
 						(size_t)ldc[group_iter]*Cn[group_iter]*sizeof(
 							bblas_complex64_t));
 				assert(Cref[matrix_iter] != NULL);
 
-				memcpy(Cref[matrix_iter], C[matrix_iter], (size_t)ldc[group_iter]*
-						Cn[group_iter]*sizeof(bblas_complex64_t));
+				for (bblas_int j = 0; j < Cn[group_iter]; j++)
+					memcpy(&Cref[matrix_iter][(size_t)ldc[group_iter]*j],
+					       &C[matrix_iter][(size_t)ldc[group_iter]*j],
+					       (size_t)Cm[group_iter]*sizeof(bblas_complex64_t));
 			}
 		}
 	}
 
 	//Set info
-	int info_size;
+	bblas_int info_size;
 	switch (bblas_info_const(param[PARAM_INFO].c)) {
 		case BblasErrorsReportAll :
 			info_size = batch_count +1;
@@ -228,21 +301,68 @@ void test_zsymm_batch(param_value_t param[], bool run)
 			return;
 	}
 
-	int *info = (int*) malloc((size_t)info_size*sizeof(int))  ;
-	info[0] = bblas_trans_const(param[PARAM_INFO].c);
+	bblas_int *info = (bblas_int*) malloc((size_t)info_size*sizeof(bblas_int))  ;
+	info[0] = bblas_info_const(param[PARAM_INFO].c);
+
+	// The matrices of each operand as offsets from the first one.
+	bblas_int *offa = NULL;
+	bblas_int *offb = NULL;
+	bblas_int *offc = NULL;
+	if (offsets) {
+		offa = pool_offsets(batch_count, (void**)A, sizeof(bblas_complex64_t));
+		offb = pool_offsets(batch_count, (void**)B, sizeof(bblas_complex64_t));
+		offc = pool_offsets(batch_count, (void**)C, sizeof(bblas_complex64_t));
+	}
 
+	// With --layouts=y, the odd groups are passed in row major:
+	// C = alpha A B + beta C in column major is its transpose in row major
+	// with side and uplo flipped and m and n swapped, on the same storage, so
+	// the reference below is unchanged.
+	bool layouts = param[PARAM_LAYOUTS].c == 'y' && !offsets;
+	bblas_enum_t layout[group_count];
+	bblas_enum_t side_l[group_count];
+	bblas_enum_t uplo_l[group_count];
+	bblas_int m_l[group_count];
+	bblas_int n_l[group_count];
+	for (bblas_int group_iter = 0; group_iter < group_count; group_iter++) {
+		bool row = layouts && group_iter % 2 == 1;
+		layout[group_iter] = row ? BblasRowMajor : BblasColMajor;
+		side_l[group_iter] = row ? (side[group_iter] == BblasLeft ? BblasRight : BblasLeft)
+		                         : side[group_iter];
+		uplo_l[group_iter] = row ? (uplo[group_iter] == BblasLower ? BblasUpper : BblasLower)
+		                         : uplo[group_iter];
+		m_l[group_iter]    = row ? n[group_iter] : m[group_iter];
+		n_l[group_iter]    = row ? m[group_iter] : n[group_iter];
+	}
 	//================================================================
 	// Run and time BBLAS.
 	//================================================================
 	bblas_time_t start = gettime();
 
-	blas_zsymm_batch(group_count, (const int *)group_sizes,
-			BblasColMajor, (const bblas_enum_t *)side, (const bblas_enum_t *)uplo,
-			(const int *)m, (const int *)n, 
-			(const bblas_complex64_t *)alpha, (bblas_complex64_t const *const *)A, (const int *)lda,
-							                  (bblas_complex64_t const* const *)B, (const int *)ldb,
-			(const bblas_complex64_t *)beta,  				    C, (const int *)ldc,
-			info);
+	if (offsets)
+		blas_zsymm_batch_offset(group_count, (const bblas_int *)group_sizes,
+				BblasColMajor, (const bblas_enum_t *)side, (const bblas_enum_t *)uplo,
+				(const bblas_int *)m, (const bblas_int *)n, 
+				(const bblas_complex64_t *)alpha, A[0], offa, (const bblas_int *)lda,
+				                                  B[0], offb, (const bblas_int *)ldb,
+				(const bblas_complex64_t *)beta,  C[0], offc, (const bblas_int *)ldc,
+				info);
+	else if (layouts)
+		blas_zsymm_batch_layouts(group_count, (const bblas_int *)group_sizes,
+				layout, side_l, uplo_l,
+				m_l, n_l,
+				(const bblas_complex64_t *)alpha, (bblas_complex64_t const *const *)A, (const bblas_int *)lda,
+				                                  (bblas_complex64_t const* const *)B, (const bblas_int *)ldb,
+				(const bblas_complex64_t *)beta,                                    C, (const bblas_int *)ldc,
+				info);
+	else
+		blas_zsymm_batch(group_count, (const bblas_int *)group_sizes,
+				BblasColMajor, (const bblas_enum_t *)side, (const bblas_enum_t *)uplo,
+				(const bblas_int *)m, (const bblas_int *)n, 
+				(const bblas_complex64_t *)alpha, (bblas_complex64_t const *const *)A, (const bblas_int *)lda,
+								                  (bblas_complex64_t const* const *)B, (const bblas_int *)ldb,
+				(const bblas_complex64_t *)beta,  				    C, (const bblas_int *)ldc,
+				info);
 
 	bblas_time_t stop = gettime();
 	bblas_time_t time = stop-start;
@@ -250,7 +370,7 @@ void test_zsymm_batch(param_value_t param[], bool run)
 	param[PARAM_TIME].d = time;
 
 	double flops = 0;
-	for (int group_iter = 0; group_iter < group_count; group_iter++) {
+	for (bblas_int group_iter = 0; group_iter < group_count; group_iter++) {
 		flops += flops_zsymm(side[group_iter], m[group_iter], n[group_iter])
 			*group_sizes[group_iter];
 	}
@@ -263,12 +383,13 @@ void test_zsymm_batch(param_value_t param[], bool run)
 	if (test) {
 		bblas_complex64_t zmone = -1.0;
 		double error = 0.0;
+		double Cnorm = 0.0;
 		double work[1];
 		group_end = 0;
-		for (int group_iter= 0; group_iter < group_count; group_iter++) {
+		for (bblas_int group_iter= 0; group_iter < group_count; group_iter++) {
 			group_start = group_end;
 			group_end += group_sizes[group_iter];
-			for (int matrix_iter= group_start; matrix_iter < group_end; matrix_iter++) {
+			for (bblas_int matrix_iter= group_start; matrix_iter < group_end; matrix_iter++) {
 
 				cblas_zsymm(CblasColMajor,
 						(CBLAS_SIDE) side[group_iter], (CBLAS_UPLO) uplo[group_iter],
@@ -278,8 +399,14 @@ void test_zsymm_batch(param_value_t param[], bool run)
 						CBLAS_SADDR(beta[group_iter]),  Cref[matrix_iter], ldc[group_iter]);
 
 				// compute difference C[matrix_iter] - C[matrix_iter]
-				cblas_zaxpy((size_t)ldc[group_iter]*Cn[group_iter],
-						CBLAS_SADDR(zmone), Cref[matrix_iter], 1, C[matrix_iter], 1);
+				Cnorm += LAPACKE_zlange_work(
+						LAPACK_COL_MAJOR, 'F', Cm[group_iter], Cn[group_iter],
+						Cref[matrix_iter], ldc[group_iter], work);
+
+				for (bblas_int j = 0; j < Cn[group_iter]; j++)
+					cblas_zaxpy(Cm[group_iter], CBLAS_SADDR(zmone),
+							&Cref[matrix_iter][(size_t)ldc[group_iter]*j], 1,
+							&C[matrix_iter][(size_t)ldc[group_iter]*j], 1);
 
 				error += LAPACKE_zlange_work(
 						LAPACK_COL_MAJOR, 'F', Cm[group_iter], Cn[group_iter],
@@ -288,20 +415,31 @@ void test_zsymm_batch(param_value_t param[], bool run)
 		}
 		param[PARAM_ERROR].d = error;
 		param[PARAM_SUCCESS].i = error < 3*eps;
+		// The single symm of --blocks=y rounds differently from the
+		// reference; a zero reference must still be matched exactly.
+		if (shared)
+			param[PARAM_SUCCESS].i = error <= param[PARAM_TOL].d*eps*Cnorm;
 	}
 	//================================================================
 	// Free arrays.
 	//================================================================
 
-	for (int matrix_iter = 0; matrix_iter < batch_count; matrix_iter++) {
+	for (bblas_int matrix_iter = 0; matrix_iter < batch_count; matrix_iter++) {
 
-		free(A[matrix_iter]);
-		free(B[matrix_iter]);
-		free(C[matrix_iter]);
+		if (! contiguous) {
+			free(A[matrix_iter]);
+			free(B[matrix_iter]);
+			free(C[matrix_iter]);
+		}
 
 		if (test)
 			free(Cref[matrix_iter]);
 	}
+	bblas_batch_free(arena);
+	free(pool);
+	free(offa);
+	free(offb);
+	free(offc);
 	free(A);
 	free(B);
 	free(C);
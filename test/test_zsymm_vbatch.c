@@ -0,0 +1,214 @@
+/**
+ *
+ * @file
+ *
+ *  BBLAS is a software package provided by:
+ *  University of Manchester, UK,
+ *  University of Tennessee, US.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+#include "test.h"
+#include "flops.h"
+#include "bblas.h"
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#define COMPLEX
+
+/***************************************************************************//**
+ *
+ * @brief Tests variable size BATCHED ZSYMM.
+ *
+ * The batch has ng different shapes, the i-th one with dimensions
+ * dim + i*incm, and gs matrices of each shape, interleaved so that no two
+ * consecutive matrices have the same shape.
+ *
+ * @param[in,out] param - array of parameters
+ * @param[in]     run - whether to run test
+ *
+ * Sets used flags in param indicating parameters that are used.
+ * If run is true, also runs test and stores output parameters.
+ ******************************************************************************/
+void test_zsymm_vbatch(param_value_t param[], bool run)
+{
+	//================================================================
+	// Mark which parameters are used.
+	//================================================================
+	param[PARAM_NG     ].used = true;
+	param[PARAM_GS     ].used = true;
+	param[PARAM_INCM   ].used = true;
+	param[PARAM_SIDE   ].used = true;
+	param[PARAM_UPLO   ].used = true;
+	param[PARAM_INFO   ].used = true;
+	param[PARAM_DIM    ].used = PARAM_USE_M | PARAM_USE_N;
+	param[PARAM_ALPHA  ].used = true;
+	param[PARAM_BETA   ].used = true;
+	if (! run)
+		return;
+
+	//================================================================
+	// Set parameters.
+	//================================================================
+	bblas_int shape_count = param[PARAM_NG].i;
+	bblas_int batch_count = shape_count*param[PARAM_GS].i;
+	bblas_int inc_matrix_size = param[PARAM_INCM].i;
+
+	bblas_enum_t side   = bblas_side_const(param[PARAM_SIDE].c);
+	bblas_enum_t uplo   = bblas_uplo_const(param[PARAM_UPLO].c);
+
+	bblas_complex64_t alpha = param[PARAM_ALPHA].z;
+	bblas_complex64_t beta = param[PARAM_BETA].z;
+
+	bblas_int *m   = (bblas_int*)malloc((size_t)batch_count*sizeof(bblas_int));
+	bblas_int *n   = (bblas_int*)malloc((size_t)batch_count*sizeof(bblas_int));
+	bblas_int *lda = (bblas_int*)malloc((size_t)batch_count*sizeof(bblas_int));
+	bblas_int *ldb = (bblas_int*)malloc((size_t)batch_count*sizeof(bblas_int));
+	bblas_int *ldc = (bblas_int*)malloc((size_t)batch_count*sizeof(bblas_int));
+	assert(m != NULL && n != NULL && lda != NULL && ldb != NULL && ldc != NULL);
+
+	// Matrix i has shape i % shape_count.
+	for (bblas_int i = 0; i < batch_count; i++) {
+		bblas_int shape = i % shape_count;
+		m[i] = param[PARAM_DIM].dim.m + shape*inc_matrix_size;
+		n[i] = param[PARAM_DIM].dim.n + shape*inc_matrix_size;
+		lda[i] = imax(1, (side == BblasLeft) ? m[i] : n[i]);
+		ldb[i] = imax(1, m[i]);
+		ldc[i] = imax(1, m[i]);
+	}
+
+	int test = param[PARAM_TEST].c == 'y';
+	double eps = LAPACKE_dlamch('E');
+
+	//================================================================
+	// Allocate and initialize arrays.
+	//================================================================
+	lapack_int seed[] = {0, 0, 0, 1};
+	lapack_int retval;
+
+	bblas_complex64_t **A = (bblas_complex64_t**)malloc(
+		(size_t)batch_count*sizeof(bblas_complex64_t*));
+	bblas_complex64_t **B = (bblas_complex64_t**)malloc(
+		(size_t)batch_count*sizeof(bblas_complex64_t*));
+	bblas_complex64_t **C = (bblas_complex64_t**)malloc(
+		(size_t)batch_count*sizeof(bblas_complex64_t*));
+	bblas_complex64_t **Cref = NULL;
+	if (test)
+		Cref = (bblas_complex64_t**)malloc(
+			(size_t)batch_count*sizeof(bblas_complex64_t*));
+	assert(A != NULL && B != NULL && C != NULL);
+
+	for (bblas_int i = 0; i < batch_count; i++) {
+		size_t asize = (size_t)lda[i]*((side == BblasLeft) ? m[i] : n[i]);
+		A[i] = (bblas_complex64_t*)malloc(asize*sizeof(bblas_complex64_t));
+		assert(A[i] != NULL);
+		retval = LAPACKE_zlarnv(1, seed, asize, A[i]);
+		assert(retval == 0);
+
+		size_t bsize = (size_t)ldb[i]*n[i];
+		B[i] = (bblas_complex64_t*)malloc(bsize*sizeof(bblas_complex64_t));
+		assert(B[i] != NULL);
+		retval = LAPACKE_zlarnv(1, seed, bsize, B[i]);
+		assert(retval == 0);
+
+		size_t csize = (size_t)ldc[i]*n[i];
+		C[i] = (bblas_complex64_t*)malloc(csize*sizeof(bblas_complex64_t));
+		assert(C[i] != NULL);
+		retval = LAPACKE_zlarnv(1, seed, csize, C[i]);
+		assert(retval == 0);
+
+		if (test) {
+			Cref[i] = (bblas_complex64_t*)malloc(csize*sizeof(bblas_complex64_t));
+			assert(Cref[i] != NULL);
+			memcpy(Cref[i], C[i], csize*sizeof(bblas_complex64_t));
+		}
+	}
+
+	// Set info
+	int info_option = bblas_info_const(param[PARAM_INFO].c);
+	bblas_int info_size = (info_option == BblasErrorsReportAll) ? batch_count+1 : 1;
+	bblas_int *info = (bblas_int*)malloc((size_t)info_size*sizeof(bblas_int));
+	assert(info != NULL);
+	info[0] = info_option;
+
+	//================================================================
+	// Run and time BBLAS.
+	//================================================================
+	bblas_time_t start = gettime();
+
+	blas_zsymm_vbatch(batch_count,
+	                  BblasColMajor, side, uplo,
+	                  (const bblas_int *)m, (const bblas_int *)n,
+	                  alpha, (bblas_complex64_t const *const *)A, (const bblas_int *)lda,
+	                         (bblas_complex64_t const *const *)B, (const bblas_int *)ldb,
+	                  beta,  C, (const bblas_int *)ldc,
+	                  info);
+
+	bblas_time_t stop = gettime();
+	bblas_time_t time = stop-start;
+
+	param[PARAM_TIME].d = time;
+
+	double flops = 0;
+	for (bblas_int i = 0; i < batch_count; i++)
+		flops += flops_zsymm(side, m[i], n[i]);
+	param[PARAM_MFLOPS].d = flops / time / 1e6;
+
+	//=====================================================================
+	// Test results by comparing to one BLAS call per matrix.
+	//=====================================================================
+	if (test) {
+		bblas_complex64_t zmone = -1.0;
+		double error = 0.0;
+		double work[1];
+		for (bblas_int i = 0; i < batch_count; i++) {
+			cblas_zsymm(CblasColMajor,
+			            (CBLAS_SIDE)side, (CBLAS_UPLO)uplo,
+			            m[i], n[i],
+			            CBLAS_SADDR(alpha), A[i], lda[i],
+			                                B[i], ldb[i],
+			            CBLAS_SADDR(beta),  Cref[i], ldc[i]);
+
+			bblas_int rows = m[i];
+			bblas_int cols = n[i];
+			double Xnorm = LAPACKE_zlange_work(
+				LAPACK_COL_MAJOR, 'F', rows, cols, Cref[i], ldc[i], work);
+			cblas_zaxpy(ldc[i]*cols, CBLAS_SADDR(zmone), Cref[i], 1, C[i], 1);
+			double diff = LAPACKE_zlange_work(
+				LAPACK_COL_MAJOR, 'F', rows, cols, C[i], ldc[i], work);
+			if (Xnorm > 0.0)
+				diff /= Xnorm;
+			error = fmax(error, diff);
+		}
+		param[PARAM_ERROR].d = error;
+		param[PARAM_SUCCESS].i = error < param[PARAM_TOL].d*eps;
+	}
+
+	//================================================================
+	// Free arrays.
+	//================================================================
+	for (bblas_int i = 0; i < batch_count; i++) {
+		free(A[i]);
+		free(B[i]);
+		free(C[i]);
+		if (test)
+			free(Cref[i]);
+	}
+	free(A);
+	free(B);
+	free(C);
+	if (test)
+		free(Cref);
+	free(info);
+	free(m);
+	free(n);
+	free(lda);
+	free(ldb);
+	free(ldc);
+}
@@ -45,8 +45,12 @@ void test_zsyr2k_batch(param_value_t param[], bool run)
 	param[PARAM_UPLO   ].used = true;
 	param[PARAM_TRANS  ].used = true;
 	param[PARAM_INFO   ].used = true;
+	param[PARAM_ALLOC  ].used = true;
+	param[PARAM_PAD    ].used = true;
+	param[PARAM_OFFSET ].used = true;
 	param[PARAM_DIM    ].used = PARAM_USE_N | PARAM_USE_K;
 	param[PARAM_ALPHA  ].used = true;
+	param[PARAM_LAYOUTS].used = true;
 	param[PARAM_BETA   ].used = true;
 	if (! run)
 		return;
@@ -55,43 +59,43 @@ void test_zsyr2k_batch(param_value_t param[], bool run)
 	// Set parameters.
 	//================================================================
 
-	int group_count       = param[PARAM_NG].i;
-	int inc_group         = param[PARAM_INCG].i;
-	int first_group_size  = param[PARAM_GS].i;
-	int group_sizes[group_count];
-	for (int i=0; i < group_count; i++) {
+	bblas_int group_count       = param[PARAM_NG].i;
+	bblas_int inc_group         = param[PARAM_INCG].i;
+	bblas_int first_group_size  = param[PARAM_GS].i;
+	bblas_int group_sizes[group_count];
+	for (bblas_int i=0; i < group_count; i++) {
 		group_sizes[i] = first_group_size + i*inc_group;
 	}
 
 	bblas_enum_t trans[group_count];
 	bblas_enum_t uplo[group_count];
-	for (int i=0; i < group_count; i++) { // Todo: assign different trans value
+	for (bblas_int i=0; i < group_count; i++) { // Todo: assign different trans value
 		trans[i] = bblas_trans_const(param[PARAM_TRANS].c);
 		uplo[i] =  bblas_uplo_const(param[PARAM_UPLO].c);
 	}
 
-	int inc_matrix_size = param[PARAM_INCM].i;
-	int *n = (int*)malloc((size_t)group_count*sizeof(int));
-	int *k = (int*)malloc((size_t)group_count*sizeof(int));
+	bblas_int inc_matrix_size = param[PARAM_INCM].i;
+	bblas_int *n = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
+	bblas_int *k = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
 
-	for (int i=0; i < group_count; i++) { // Todo: provide different inc par dimension
+	for (bblas_int i=0; i < group_count; i++) { // Todo: provide different inc par dimension
 		n[i] = param[PARAM_DIM].dim.n + i*inc_matrix_size;
 		k[i] = param[PARAM_DIM].dim.k + i*inc_matrix_size;
 	}
 
-	int *lda = (int*)malloc((size_t)group_count*sizeof(int));
-	int *ldb = (int*)malloc((size_t)group_count*sizeof(int));
-	int *ldc = (int*)malloc((size_t)group_count*sizeof(int));
+	bblas_int *lda = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
+	bblas_int *ldb = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
+	bblas_int *ldc = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
 
-	int *An = (int*)malloc((size_t)group_count*sizeof(int));
-	int *Bn = (int*)malloc((size_t)group_count*sizeof(int));
-	int *Cn = (int*)malloc((size_t)group_count*sizeof(int));
+	bblas_int *An = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
+	bblas_int *Bn = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
+	bblas_int *Cn = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
 
-	int *Am = (int*)malloc((size_t)group_count*sizeof(int));
-	int *Bm = (int*)malloc((size_t)group_count*sizeof(int));
-	int *Cm = (int*)malloc((size_t)group_count*sizeof(int));
+	bblas_int *Am = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
+	bblas_int *Bm = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
+	bblas_int *Cm = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
 
-	for (int i= 0; i < group_count; i++) {
+	for (bblas_int i= 0; i < group_count; i++) {
 
 		if (trans[i] == BblasNoTrans) {
 			Am[i]= n[i];
@@ -118,14 +122,14 @@ void test_zsyr2k_batch(param_value_t param[], bool run)
 #ifdef COMPLEX
 	bblas_complex64_t alpha[group_count];
 	bblas_complex64_t beta[group_count];
-	for (int i = 0; i < group_count; i++) {
+	for (bblas_int i = 0; i < group_count; i++) {
 		alpha[i] =  param[PARAM_ALPHA].z;
 		beta[i]  =  param[PARAM_BETA].z;
 	}
 #else
 	double alpha[group_count];
 	double beta[group_count];
-	for (int i = 0; i < group_count; i++) {
+	for (bblas_int i = 0; i < group_count; i++) {
 		alpha[i] = creal(param[PARAM_ALPHA].z);
 		beta[i]  = creal(param[PARAM_BETA].z);
 	}
@@ -135,8 +139,8 @@ void test_zsyr2k_batch(param_value_t param[], bool run)
 	// Allocate and initialize arrays.
 	//================================================================
 
-	int batch_count =0;
-	for (int i = 0; i < group_count; i++) {
+	bblas_int batch_count =0;
+	for (bblas_int i = 0; i < group_count; i++) {
 		batch_count += group_sizes[i];
 	}
 
@@ -159,27 +163,50 @@ void test_zsyr2k_batch(param_value_t param[], bool run)
 		assert(Cref != NULL);
 	}
 
-	int seed[] = {0, 0, 0, 1};
+	// With --pad=y, the leading dimensions are padded to avoid cache set
+	// aliasing.
+	if (param[PARAM_PAD].c == 'y') {
+		bblas_advise_ld(group_count, An, sizeof(bblas_complex64_t), lda);
+		bblas_advise_ld(group_count, Bn, sizeof(bblas_complex64_t), ldb);
+		bblas_advise_ld(group_count, Cn, sizeof(bblas_complex64_t), ldc);
+	}
+
+	// With --alloc=y, all the matrices come from one arena instead of
+	// one malloc each; --offset=y addresses them by offsets into it.
+	bool offsets = param[PARAM_OFFSET].c == 'y';
+	bool contiguous = param[PARAM_ALLOC].c == 'y' || offsets;
+	bblas_arena_t arena = NULL;
+	if (contiguous) {
+		const bblas_int *ld_op[]   = { lda, ldb, ldc };
+		const bblas_int *cols_op[] = { An, Bn, Cn };
+		size_t size_op[]     = { sizeof(bblas_complex64_t), sizeof(bblas_complex64_t), sizeof(bblas_complex64_t) };
+		void **X_op[]        = { (void**)A, (void**)B, (void**)C };
+		arena = bblas_batch_alloc(group_count, group_sizes, 3,
+		                          ld_op, cols_op, size_op, X_op);
+		assert(arena != NULL);
+	}
+
+	lapack_int seed[] = {0, 0, 0, 1};
 	lapack_int retval;
 
-	int  group_start=0;
-	int  group_end =0;
-	for (int group_iter= 0; group_iter < group_count; group_iter++) {
+	bblas_int  group_start=0;
+	bblas_int  group_end =0;
+	for (bblas_int group_iter= 0; group_iter < group_count; group_iter++) {
 		group_start = group_end;
 		group_end += group_sizes[group_iter];
-		for (int matrix_iter= group_start; matrix_iter < group_end; matrix_iter++) {
-
-			A[matrix_iter] = (bblas_complex64_t*)malloc(
-					(size_t)lda[group_iter]*An[group_iter]*sizeof(bblas_complex64_t));
-			assert(A[matrix_iter] != NULL);
-
-			B[matrix_iter] = (bblas_complex64_t*)malloc(
-					(size_t)ldb[group_iter]*Bn[group_iter]*sizeof(bblas_complex64_t));
-			assert(B[matrix_iter] != NULL);
-
-			C[matrix_iter] = (bblas_complex64_t*)malloc(
-					(size_t)ldc[group_iter]*Cn[group_iter]*sizeof(bblas_complex64_t));
-			assert(C[matrix_iter] != NULL);
+		for (bblas_int matrix_iter= group_start; matrix_iter < group_end; matrix_iter++) {
+
+			if (! contiguous) {
+				A[matrix_iter] = (bblas_complex64_t*)malloc(
+						(size_t)lda[group_iter]*An[group_iter]*sizeof(bblas_complex64_t));
+				assert(A[matrix_iter] != NULL);
+				B[matrix_iter] = (bblas_complex64_t*)malloc(
+						(size_t)ldb[group_iter]*Bn[group_iter]*sizeof(bblas_complex64_t));
+				assert(B[matrix_iter] != NULL);
+				C[matrix_iter] = (bblas_complex64_t*)malloc(
+						(size_t)ldc[group_iter]*Cn[group_iter]*sizeof(bblas_complex64_t));
+				assert(C[matrix_iter] != NULL);
+			}
 
 			retval = LAPACKE_zlarnv(1, seed, (size_t)lda[group_iter]*An[group_iter], A[matrix_iter]);
 			assert(retval == 0);
@@ -201,7 +228,7 @@ void test_zsyr2k_batch(param_value_t param[], bool run)
 	}
 
 	//Set info
-	int info_size;
+	bblas_int info_size;
 	switch (bblas_info_const(param[PARAM_INFO].c)) {
 		case BblasErrorsReportAll :
 			info_size = batch_count +1;
@@ -218,20 +245,79 @@ void test_zsyr2k_batch(param_value_t param[], bool run)
 			return;
 	}
 
-	int *info = (int*) malloc((size_t)info_size*sizeof(int))  ;
+	bblas_int *info = (bblas_int*) malloc((size_t)info_size*sizeof(bblas_int))  ;
 	info[0] = bblas_info_const(param[PARAM_INFO].c);
+
+	// The matrices of each operand as offsets from the first one.
+	bblas_int *offa = NULL;
+	bblas_int *offb = NULL;
+	bblas_int *offc = NULL;
+	if (offsets) {
+		offa = pool_offsets(batch_count, (void**)A, sizeof(bblas_complex64_t));
+		offb = pool_offsets(batch_count, (void**)B, sizeof(bblas_complex64_t));
+		offc = pool_offsets(batch_count, (void**)C, sizeof(bblas_complex64_t));
+	}
+
+	// With --layouts=y, the odd groups are passed in row major:
+	// C = alpha A B^T + alpha B A^T + beta C in column major is its transpose
+	// in row major with uplo flipped and trans swapped between BblasNoTrans
+	// and BblasTrans, on the same storage, so the reference below is
+	// unchanged.
+	// A and B are swapped too: alpha multiplies both products.
+	bool layouts = param[PARAM_LAYOUTS].c == 'y' && !offsets;
+	bblas_enum_t layout[group_count];
+	bblas_enum_t uplo_l[group_count];
+	bblas_enum_t trans_l[group_count];
+	bblas_int lda_l[group_count];
+	bblas_int ldb_l[group_count];
+	const bblas_complex64_t **A_l = (const bblas_complex64_t**)malloc((size_t)batch_count*sizeof(bblas_complex64_t*));
+	const bblas_complex64_t **B_l = (const bblas_complex64_t**)malloc((size_t)batch_count*sizeof(bblas_complex64_t*));
+	bblas_int group_stop = 0;
+	for (bblas_int group_iter = 0; group_iter < group_count; group_iter++) {
+		bblas_int group_first = group_stop;
+		group_stop += group_sizes[group_iter];
+		bool row = layouts && group_iter % 2 == 1;
+		layout[group_iter]  = row ? BblasRowMajor : BblasColMajor;
+		uplo_l[group_iter]  = row ? (uplo[group_iter] == BblasLower ? BblasUpper : BblasLower)
+		                          : uplo[group_iter];
+		trans_l[group_iter] = row ? (trans[group_iter] == BblasNoTrans ? BblasTrans : BblasNoTrans)
+		                          : trans[group_iter];
+		lda_l[group_iter]   = row ? ldb[group_iter] : lda[group_iter];
+		ldb_l[group_iter]   = row ? lda[group_iter] : ldb[group_iter];
+		for (bblas_int matrix_iter = group_first; matrix_iter < group_stop; matrix_iter++) {
+			A_l[matrix_iter] = row ? B[matrix_iter] : A[matrix_iter];
+			B_l[matrix_iter] = row ? A[matrix_iter] : B[matrix_iter];
+		}
+	}
 	//================================================================
 	// Run and time BBLAS.
 	//================================================================
 	bblas_time_t start = gettime();
 
-	blas_zsyr2k_batch(group_count, (const int *)group_sizes,
-			BblasColMajor, (const bblas_enum_t *)uplo, (const bblas_enum_t *)trans,
-			(const int *)n, (const int *)k, 
-			(const bblas_complex64_t *)alpha, (bblas_complex64_t const *const *)A, (const int *)lda,
-							                  (bblas_complex64_t const* const *)B, (const int *)ldb,
-			(const bblas_complex64_t *)beta, 				                    C, (const int *)ldc,
-			info);
+	if (offsets)
+		blas_zsyr2k_batch_offset(group_count, (const bblas_int *)group_sizes,
+				BblasColMajor, (const bblas_enum_t *)uplo, (const bblas_enum_t *)trans,
+				(const bblas_int *)n, (const bblas_int *)k, 
+				(const bblas_complex64_t *)alpha, A[0], offa, (const bblas_int *)lda,
+				                                  B[0], offb, (const bblas_int *)ldb,
+				(const bblas_complex64_t *)beta,  C[0], offc, (const bblas_int *)ldc,
+				info);
+	else if (layouts)
+		blas_zsyr2k_batch_layouts(group_count, (const bblas_int *)group_sizes,
+				layout, uplo_l, trans_l,
+				(const bblas_int *)n, (const bblas_int *)k,
+				(const bblas_complex64_t *)alpha, A_l, lda_l,
+				                                  B_l, ldb_l,
+				(const bblas_complex64_t *)beta,                                        C, (const bblas_int *)ldc,
+				info);
+	else
+		blas_zsyr2k_batch(group_count, (const bblas_int *)group_sizes,
+				BblasColMajor, (const bblas_enum_t *)uplo, (const bblas_enum_t *)trans,
+				(const bblas_int *)n, (const bblas_int *)k, 
+				(const bblas_complex64_t *)alpha, (bblas_complex64_t const *const *)A, (const bblas_int *)lda,
+								                  (bblas_complex64_t const* const *)B, (const bblas_int *)ldb,
+				(const bblas_complex64_t *)beta, 				                    C, (const bblas_int *)ldc,
+				info);
 
 	bblas_time_t stop = gettime();
 	bblas_time_t time = stop-start;
@@ -239,7 +325,7 @@ void test_zsyr2k_batch(param_value_t param[], bool run)
 	param[PARAM_TIME].d = time;
 
 	double flops = 0;
-	for (int group_iter = 0; group_iter < group_count; group_iter++) {
+	for (bblas_int group_iter = 0; group_iter < group_count; group_iter++) {
 		flops += flops_zher2k(n[group_iter], k[group_iter])*group_sizes[group_iter];
 	}
 	param[PARAM_MFLOPS].d = flops / time / 1e6;
@@ -252,10 +338,10 @@ void test_zsyr2k_batch(param_value_t param[], bool run)
 		double error = 0.0;
 		double work[1];
 		group_end = 0;
-		for (int group_iter= 0; group_iter < group_count; group_iter++) {
+		for (bblas_int group_iter= 0; group_iter < group_count; group_iter++) {
 			group_start = group_end;
 			group_end += group_sizes[group_iter];
-			for (int matrix_iter= group_start; matrix_iter < group_end; matrix_iter++) {
+			for (bblas_int matrix_iter= group_start; matrix_iter < group_end; matrix_iter++) {
 
 				cblas_zsyr2k(CblasColMajor, (CBLAS_UPLO) uplo[group_iter], (CBLAS_TRANSPOSE)trans[group_iter],
 						n[group_iter], k[group_iter],
@@ -263,31 +349,49 @@ void test_zsyr2k_batch(param_value_t param[], bool run)
 										B[matrix_iter], ldb[group_iter],
 						CBLAS_SADDR(beta[group_iter]),  Cref[matrix_iter], ldc[group_iter]);
 
+				// The row major groups run the other triangle's kernel,
+				// whose rounding differs: use the relative error there.
+				bool row = layouts && group_iter % 2 == 1;
+				double Cnorm = row ? LAPACKE_zlansy_work(
+						LAPACK_COL_MAJOR, 'F', uplo[group_iter], Cn[group_iter],
+						Cref[matrix_iter], ldc[group_iter], work) : 0.0;
+
 				// compute difference C[matrix_iter] - C[matrix_iter]
 				cblas_zaxpy((size_t)ldc[group_iter]*Cn[group_iter],
 						CBLAS_SADDR(zmone), Cref[matrix_iter], 1, C[matrix_iter], 1);
 
-				error += LAPACKE_zlansy_work(
+				double diff = LAPACKE_zlansy_work(
 						LAPACK_COL_MAJOR, 'F', uplo[group_iter], Cn[group_iter],
 						C[matrix_iter],  ldc[group_iter], work);
+				if (Cnorm != 0.0)
+					diff /= Cnorm;
+				error += diff;
 			}
 		}
 		param[PARAM_ERROR].d = error;
-		param[PARAM_SUCCESS].i = error < 3*eps;
+		param[PARAM_SUCCESS].i = error < (layouts ? param[PARAM_TOL].d : 3)*eps;
 	}
 	//================================================================
 	// Free arrays.
 	//================================================================
 
-	for (int matrix_iter = 0; matrix_iter < batch_count; matrix_iter++) {
+	for (bblas_int matrix_iter = 0; matrix_iter < batch_count; matrix_iter++) {
 
-		free(A[matrix_iter]);
-		free(B[matrix_iter]);
-		free(C[matrix_iter]);
+		if (! contiguous) {
+			free(A[matrix_iter]);
+			free(B[matrix_iter]);
+			free(C[matrix_iter]);
+		}
 
 		if (test)
 			free(Cref[matrix_iter]);
 	}
+	bblas_batch_free(arena);
+	free(A_l);
+	free(B_l);
+	free(offa);
+	free(offb);
+	free(offc);
 	free(A);
 	free(B);
 	free(C);
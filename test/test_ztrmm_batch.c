@@ -47,8 +47,14 @@ void test_ztrmm_batch(param_value_t param[], bool run)
 	param[PARAM_TRANSA ].used = true;
 	param[PARAM_DIAG   ].used = true;
 	param[PARAM_INFO   ].used = true;
+	param[PARAM_ALLOC  ].used = true;
+	param[PARAM_PAD    ].used = true;
+	param[PARAM_OFFSET ].used = true;
 	param[PARAM_DIM    ].used = PARAM_USE_M | PARAM_USE_N;
 	param[PARAM_ALPHA  ].used = true;
+	param[PARAM_LAYOUTS].used = true;
+	param[PARAM_SHARED ].used = true;
+	param[PARAM_BLOCKS ].used = true;
 	if (! run)
 		return;
 
@@ -56,11 +62,11 @@ void test_ztrmm_batch(param_value_t param[], bool run)
 	// Set parameters
 	//================================================================
 
-	int group_count       = param[PARAM_NG].i;
-	int inc_group         = param[PARAM_INCG].i;
-	int first_group_size  = param[PARAM_GS].i;
-	int group_sizes[group_count];
-	for (int i=0; i < group_count; i++) {
+	bblas_int group_count       = param[PARAM_NG].i;
+	bblas_int inc_group         = param[PARAM_INCG].i;
+	bblas_int first_group_size  = param[PARAM_GS].i;
+	bblas_int group_sizes[group_count];
+	for (bblas_int i=0; i < group_count; i++) {
 		group_sizes[i] = first_group_size + i*inc_group;
 	}
 
@@ -68,30 +74,30 @@ void test_ztrmm_batch(param_value_t param[], bool run)
 	bblas_enum_t uplo[group_count];
 	bblas_enum_t side[group_count];
 	bblas_enum_t diag[group_count]; 
-	for (int i=0; i < group_count; i++) { // Todo: assign different trans value
-		transa[i] = bblas_trans_const(param[PARAM_TRANS].c);
+	for (bblas_int i=0; i < group_count; i++) { // Todo: assign different trans value
+		transa[i] = bblas_trans_const(param[PARAM_TRANSA].c);
 		uplo[i]  =  bblas_uplo_const(param[PARAM_UPLO].c);
 		side[i]  = bblas_side_const(param[PARAM_SIDE].c);
 		diag[i]  = bblas_diag_const(param[PARAM_DIAG].c);
 		
 	}
 
-	int *m = (int*)malloc((size_t)group_count*sizeof(int));
-	int *n = (int*)malloc((size_t)group_count*sizeof(int));
-	int size_incre = param[PARAM_INCM].i;
+	bblas_int *m = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
+	bblas_int *n = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
+	bblas_int size_incre = param[PARAM_INCM].i;
 	m[0] = param[PARAM_DIM].dim.m;
 	n[0] = param[PARAM_DIM].dim.n;
-	for (int i = 1; i < group_count; ++i) {
+	for (bblas_int i = 1; i < group_count; ++i) {
 		m[i] = m[i-1] + size_incre;
 		n[i] = n[i-1] + size_incre;
 	}
 
 
-	int *lda = (int*)malloc((size_t)group_count*sizeof(int));
-	int *ldb = (int*)malloc((size_t)group_count*sizeof(int));
-	int *k   = (int*)malloc((size_t)group_count*sizeof(int));
+	bblas_int *lda = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
+	bblas_int *ldb = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
+	bblas_int *k   = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
 
-	for (int i = 0; i < group_count; ++i) {
+	for (bblas_int i = 0; i < group_count; ++i) {
 		if (side[i] == BblasLeft) {
 			k[i]    = m[i];
 			lda[i]  = imax(1, m[i]);
@@ -108,12 +114,12 @@ void test_ztrmm_batch(param_value_t param[], bool run)
 
 #ifdef COMPLEX
 	bblas_complex64_t alpha[group_count];
-	for (int i = 0; i < group_count; i++) {
+	for (bblas_int i = 0; i < group_count; i++) {
 		alpha[i] =  param[PARAM_ALPHA].z;
 	}
 #else
 	double alpha[group_count];
-	for (int i = 0; i < group_count; i++) {
+	for (bblas_int i = 0; i < group_count; i++) {
 		alpha[i] = creal(param[PARAM_ALPHA].z);
 	}
 #endif
@@ -122,8 +128,8 @@ void test_ztrmm_batch(param_value_t param[], bool run)
 	// Allocate and initialize arrays.
 	//================================================================
 
-	int batch_count =0;
-	for (int i = 0; i < group_count; i++) {
+	bblas_int batch_count =0;
+	for (bblas_int i = 0; i < group_count; i++) {
 		batch_count += group_sizes[i];
 	}
 
@@ -143,48 +149,114 @@ void test_ztrmm_batch(param_value_t param[], bool run)
 	}
 
 
-	int seed[] = {0, 0, 0, 1};
+	// With --pad=y, the leading dimensions are padded to avoid cache set
+	// aliasing.
+	if (param[PARAM_PAD].c == 'y') {
+		bblas_advise_ld(group_count, k, sizeof(bblas_complex64_t), lda);
+		bblas_advise_ld(group_count, n, sizeof(bblas_complex64_t), ldb);
+	}
+
+	// With --shared=y, all the A[i] of a group are one matrix, and with
+	// --blocks=y, the B[i] of the group are consecutive blocks of one
+	// matrix: side by side on the left, on top of each other on the right.
+	// These groups are done by a single trmm.
+	char share_op[] = { 'n', 'n' };
+	if (param[PARAM_SHARED].c == 'y') {
+		share_op[0] = 's';
+		if (param[PARAM_BLOCKS].c == 'y') {
+			if (bblas_side_const(param[PARAM_SIDE].c) == BblasLeft) {
+				share_op[1] = 'h';
+			}
+			else {
+				share_op[1] = 'v';
+				for (bblas_int i = 0; i < group_count; i++)
+					ldb[i] = imax(ldb[i], m[i]*group_sizes[i]);
+			}
+		}
+	}
+	bool shared = share_op[0] == 's';
+
+	// With --alloc=y, all the matrices come from one arena instead of
+	// one malloc each; --offset=y addresses them by offsets into it,
+	// or into the pool of --shared.
+	bool offsets = param[PARAM_OFFSET].c == 'y';
+	bool contiguous = param[PARAM_ALLOC].c == 'y' || offsets || shared;
+	bblas_arena_t arena = NULL;
+	bblas_complex64_t *pool = NULL;
+	size_t pool_size = 0;
+	if (shared) {
+		const bblas_int *rows_op[] = { k, m };
+		const bblas_int *ld_op[]   = { lda, ldb };
+		const bblas_int *cols_op[] = { k, n };
+		void **X_op[]              = { (void**)A, (void**)B };
+		pool = (bblas_complex64_t*)pool_shared(group_count, group_sizes, 2,
+		                                       share_op, rows_op, ld_op, cols_op,
+		                                       sizeof(bblas_complex64_t), X_op,
+		                                       &pool_size);
+	}
+	else if (contiguous) {
+		const bblas_int *ld_op[]   = { lda, ldb };
+		const bblas_int *cols_op[] = { k, n };
+		size_t size_op[]     = { sizeof(bblas_complex64_t), sizeof(bblas_complex64_t) };
+		void **X_op[]        = { (void**)A, (void**)B };
+		arena = bblas_batch_alloc(group_count, group_sizes, 2,
+		                          ld_op, cols_op, size_op, X_op);
+		assert(arena != NULL);
+	}
+
+	lapack_int seed[] = {0, 0, 0, 1};
 	lapack_int retval;
-	int  group_start=0;
-	int  group_end =0;
-	for (int group_iter= 0; group_iter < group_count; group_iter++) {
-		group_start = group_end;
-		group_end += group_sizes[group_iter];
-		for (int matrix_iter= group_start; matrix_iter < group_end; matrix_iter++) {
 
-			A[matrix_iter] = (bblas_complex64_t*)malloc(
-					(size_t)lda[group_iter]*k[group_iter]*sizeof(
-						bblas_complex64_t));
-			assert(A[matrix_iter] != NULL);
+	if (shared) {
+		retval = LAPACKE_zlarnv(1, seed, pool_size, pool);
+		assert(retval == 0);
+	}
 
-			B[matrix_iter] = (bblas_complex64_t*)malloc(
-					(size_t)ldb[group_iter]*n[group_iter]*sizeof(
-						bblas_complex64_t));
-			assert(B[matrix_iter] != NULL);
+	bblas_int  group_start=0;
+	bblas_int  group_end =0;
+	for (bblas_int group_iter= 0; group_iter < group_count; group_iter++) {
+		group_start = group_end;
+		group_end += group_sizes[group_iter];
+		for (bblas_int matrix_iter= group_start; matrix_iter < group_end; matrix_iter++) {
+
+			if (! contiguous) {
+				A[matrix_iter] = (bblas_complex64_t*)malloc(
+						(size_t)lda[group_iter]*k[group_iter]*sizeof(bblas_complex64_t));
+				assert(A[matrix_iter] != NULL);
+				B[matrix_iter] = (bblas_complex64_t*)malloc(
+						(size_t)ldb[group_iter]*n[group_iter]*sizeof(bblas_complex64_t));
+				assert(B[matrix_iter] != NULL);
+			}
 
-			retval = LAPACKE_zlarnv(1, seed, (size_t)lda[group_iter]*k[group_iter], 
-					A[matrix_iter]);
-			assert(retval == 0);
+			if (! shared) {
+				retval = LAPACKE_zlarnv(1, seed, (size_t)lda[group_iter]*k[group_iter], 
+						A[matrix_iter]);
+				assert(retval == 0);
 
-			retval = LAPACKE_zlarnv(1, seed, (size_t)ldb[group_iter]*n[group_iter], 
-					B[matrix_iter]);
-			assert(retval == 0);
+				retval = LAPACKE_zlarnv(1, seed, (size_t)ldb[group_iter]*n[group_iter], 
+						B[matrix_iter]);
+				assert(retval == 0);
+			}
 
+			// B[i] column by column, as the blocks of --blocks=y overlap
+			// within their leading dimension.
 			if (test) {
 				Bref[matrix_iter] = (bblas_complex64_t*)malloc(
 						(size_t)ldb[group_iter]*n[group_iter]*sizeof(
 							bblas_complex64_t));
 				assert(Bref[matrix_iter] != NULL);
 
-				memcpy(Bref[matrix_iter], B[matrix_iter], (size_t)ldb[group_iter]*
-						n[group_iter]*sizeof(bblas_complex64_t));
+				for (bblas_int j = 0; j < n[group_iter]; j++)
+					memcpy(&Bref[matrix_iter][(size_t)ldb[group_iter]*j],
+					       &B[matrix_iter][(size_t)ldb[group_iter]*j],
+					       (size_t)m[group_iter]*sizeof(bblas_complex64_t));
 			}
 		}
 	}
 
 	//Set info
-	int info_size;
-	switch (bblas_info_const(param[PARAM_TRANSA].c)) {
+	bblas_int info_size;
+	switch (bblas_info_const(param[PARAM_INFO].c)) {
 		case BblasErrorsReportAll :
 			info_size = batch_count +1;
 			break;
@@ -200,21 +272,66 @@ void test_ztrmm_batch(param_value_t param[], bool run)
 			return;
 	}
 
-	int *info = (int*) malloc((size_t)info_size*sizeof(int))  ;
-	info[0] = bblas_trans_const(param[PARAM_TRANSA].c);
+	bblas_int *info = (bblas_int*) malloc((size_t)info_size*sizeof(bblas_int))  ;
+	info[0] = bblas_info_const(param[PARAM_INFO].c);
 
+	// The matrices of each operand as offsets from the first one.
+	bblas_int *offa = NULL;
+	bblas_int *offb = NULL;
+	if (offsets) {
+		offa = pool_offsets(batch_count, (void**)A, sizeof(bblas_complex64_t));
+		offb = pool_offsets(batch_count, (void**)B, sizeof(bblas_complex64_t));
+	}
+
+	// With --layouts=y, the odd groups are passed in row major:
+	// B = alpha op(A) B in column major is its transpose in row major with
+	// side and uplo flipped and m and n swapped, on the same storage, so the
+	// reference below is unchanged.
+	bool layouts = param[PARAM_LAYOUTS].c == 'y' && !offsets;
+	bblas_enum_t layout[group_count];
+	bblas_enum_t side_l[group_count];
+	bblas_enum_t uplo_l[group_count];
+	bblas_int m_l[group_count];
+	bblas_int n_l[group_count];
+	for (bblas_int group_iter = 0; group_iter < group_count; group_iter++) {
+		bool row = layouts && group_iter % 2 == 1;
+		layout[group_iter] = row ? BblasRowMajor : BblasColMajor;
+		side_l[group_iter] = row ? (side[group_iter] == BblasLeft ? BblasRight : BblasLeft)
+		                         : side[group_iter];
+		uplo_l[group_iter] = row ? (uplo[group_iter] == BblasLower ? BblasUpper : BblasLower)
+		                         : uplo[group_iter];
+		m_l[group_iter]    = row ? n[group_iter] : m[group_iter];
+		n_l[group_iter]    = row ? m[group_iter] : n[group_iter];
+	}
 	//================================================================
 	// Run and time BBLAS.
 	//================================================================
 	bblas_time_t start = gettime();
 
-	blas_ztrmm_batch(group_count, (const int *)group_sizes,
-			BblasColMajor, (const bblas_enum_t *)side, (const bblas_enum_t *)uplo,
-			(const bblas_enum_t *)transa, (const bblas_enum_t *)diag,
-			(const int *)m, (const int *)n,
-			(const bblas_complex64_t *)alpha, (bblas_complex64_t const *const *)A, (const int *)lda,
-											                                    B, (int const *)ldb,
-			info);
+	if (offsets)
+		blas_ztrmm_batch_offset(group_count, (const bblas_int *)group_sizes,
+				BblasColMajor, (const bblas_enum_t *)side, (const bblas_enum_t *)uplo,
+				(const bblas_enum_t *)transa, (const bblas_enum_t *)diag,
+				(const bblas_int *)m, (const bblas_int *)n,
+				(const bblas_complex64_t *)alpha, A[0], offa, (const bblas_int *)lda,
+				                                  B[0], offb, (bblas_int const *)ldb,
+				info);
+	else if (layouts)
+		blas_ztrmm_batch_layouts(group_count, (const bblas_int *)group_sizes,
+				layout, side_l, uplo_l,
+				(const bblas_enum_t *)transa, (const bblas_enum_t *)diag,
+				m_l, n_l,
+				(const bblas_complex64_t *)alpha, (bblas_complex64_t const *const *)A, (const bblas_int *)lda,
+				                                                                    B, (bblas_int const *)ldb,
+				info);
+	else
+		blas_ztrmm_batch(group_count, (const bblas_int *)group_sizes,
+				BblasColMajor, (const bblas_enum_t *)side, (const bblas_enum_t *)uplo,
+				(const bblas_enum_t *)transa, (const bblas_enum_t *)diag,
+				(const bblas_int *)m, (const bblas_int *)n,
+				(const bblas_complex64_t *)alpha, (bblas_complex64_t const *const *)A, (const bblas_int *)lda,
+												                                    B, (bblas_int const *)ldb,
+				info);
 
 	bblas_time_t stop = gettime();
 	bblas_time_t time = stop-start;
@@ -222,7 +339,7 @@ void test_ztrmm_batch(param_value_t param[], bool run)
 	param[PARAM_TIME].d = time;
 
 	double flops = 0;
-	for (int group_iter = 0; group_iter < group_count; group_iter++) {
+	for (bblas_int group_iter = 0; group_iter < group_count; group_iter++) {
 		flops += flops_ztrmm(side[group_iter], m[group_iter], n[group_iter])
 			*group_sizes[group_iter];
 	}
@@ -236,10 +353,10 @@ void test_ztrmm_batch(param_value_t param[], bool run)
 		double error = 0.0;
 		double work[1];
 		group_end = 0;
-		for (int group_iter= 0; group_iter < group_count; group_iter++) {
+		for (bblas_int group_iter= 0; group_iter < group_count; group_iter++) {
 			group_start = group_end;
 			group_end += group_sizes[group_iter];
-			for (int matrix_iter= group_start; matrix_iter < group_end; matrix_iter++) {
+			for (bblas_int matrix_iter= group_start; matrix_iter < group_end; matrix_iter++) {
 
 				cblas_ztrmm(CblasColMajor, (CBLAS_SIDE)side[group_iter], (CBLAS_UPLO)uplo[group_iter],
 						(CBLAS_TRANSPOSE)transa[group_iter], (CBLAS_DIAG)diag[group_iter],
@@ -247,29 +364,45 @@ void test_ztrmm_batch(param_value_t param[], bool run)
                         CBLAS_SADDR(alpha[group_iter]), A[matrix_iter], lda[group_iter], 
 						                             Bref[matrix_iter], ldb[group_iter]);
 
-				cblas_zaxpy((size_t)ldb[group_iter]*n[group_iter], CBLAS_SADDR(zmone), Bref[matrix_iter], 1, 
-						B[matrix_iter], 1);
+				// Small matrices go through the native kernel, whose
+				// rounding differs from CBLAS: use the relative error.
+				double Bnorm = LAPACKE_zlange_work(
+						LAPACK_COL_MAJOR, 'F', m[group_iter], n[group_iter], Bref[matrix_iter], ldb[group_iter], work);
 
-				error = LAPACKE_zlange_work(
+				for (bblas_int j = 0; j < n[group_iter]; j++)
+					cblas_zaxpy(m[group_iter], CBLAS_SADDR(zmone),
+							&Bref[matrix_iter][(size_t)ldb[group_iter]*j], 1,
+							&B[matrix_iter][(size_t)ldb[group_iter]*j], 1);
+
+				double diff = LAPACKE_zlange_work(
 						LAPACK_COL_MAJOR, 'F', m[group_iter], n[group_iter], B[matrix_iter], ldb[group_iter], work);
+				if (Bnorm != 0.0)
+					diff /= Bnorm;
+				error += diff;
 			}
 		}
 		param[PARAM_ERROR].d = error;
-		param[PARAM_SUCCESS].i = error < 3*eps;
+		param[PARAM_SUCCESS].i = error < param[PARAM_TOL].d*eps;
 	}
 
 	//================================================================
 	// Free arrays.
 	//================================================================
 
-	for (int matrix_iter = 0; matrix_iter < batch_count; matrix_iter++) { 
+	for (bblas_int matrix_iter = 0; matrix_iter < batch_count; matrix_iter++) { 
 
-		free(A[matrix_iter]);
-		free(B[matrix_iter]);
+		if (! contiguous) {
+			free(A[matrix_iter]);
+			free(B[matrix_iter]);
+		}
 
 		if (test)
 			free(Bref[matrix_iter]);
 	}
+	bblas_batch_free(arena);
+	free(pool);
+	free(offa);
+	free(offb);
 	free(A);
 	free(B);
 
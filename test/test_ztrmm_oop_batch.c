@@ -0,0 +1,422 @@
+/**
+ *
+ * @file
+ *
+ *  BBLAS is a software package provided by:
+ *  University of Manchester, UK,
+ *  University of Tennessee, US.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+#include "test.h"
+#include "flops.h"
+#include "bblas.h"
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+
+#define COMPLEX
+
+/***************************************************************************//**
+ *
+ * @brief Tests BATCHED out-of-place ZTRMM.
+ *
+ * @param[in,out] param - array of parameters
+ * @param[in]     run - whether to run test
+ *
+ * Sets used flags in param indicating parameters that are used.
+ * If run is true, also runs test and stores output parameters.
+ ******************************************************************************/
+void test_ztrmm_oop_batch(param_value_t param[], bool run)
+{
+	//================================================================
+	// Mark which parameters are used.
+	//================================================================
+	param[PARAM_NG     ].used = true;
+	param[PARAM_GS     ].used = true;
+	param[PARAM_INCM   ].used = true;
+	param[PARAM_INCG   ].used = true;
+	param[PARAM_SIDE   ].used = true;
+	param[PARAM_UPLO   ].used = true;
+	param[PARAM_TRANSA ].used = true;
+	param[PARAM_DIAG   ].used = true;
+	param[PARAM_INFO   ].used = true;
+	param[PARAM_ALLOC  ].used = true;
+	param[PARAM_PAD    ].used = true;
+	param[PARAM_DIM    ].used = PARAM_USE_M | PARAM_USE_N;
+	param[PARAM_ALPHA  ].used = true;
+	param[PARAM_LAYOUTS].used = true;
+	param[PARAM_SHARED ].used = true;
+	param[PARAM_BLOCKS ].used = true;
+	if (! run)
+		return;
+
+	//================================================================
+	// Set parameters
+	//================================================================
+
+	bblas_int group_count       = param[PARAM_NG].i;
+	bblas_int inc_group         = param[PARAM_INCG].i;
+	bblas_int first_group_size  = param[PARAM_GS].i;
+	bblas_int group_sizes[group_count];
+	for (bblas_int i=0; i < group_count; i++) {
+		group_sizes[i] = first_group_size + i*inc_group;
+	}
+
+	bblas_enum_t transa[group_count];
+	bblas_enum_t uplo[group_count];
+	bblas_enum_t side[group_count];
+	bblas_enum_t diag[group_count]; 
+	for (bblas_int i=0; i < group_count; i++) { // Todo: assign different trans value
+		transa[i] = bblas_trans_const(param[PARAM_TRANSA].c);
+		uplo[i]  =  bblas_uplo_const(param[PARAM_UPLO].c);
+		side[i]  = bblas_side_const(param[PARAM_SIDE].c);
+		diag[i]  = bblas_diag_const(param[PARAM_DIAG].c);
+		
+	}
+
+	bblas_int *m = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
+	bblas_int *n = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
+	bblas_int size_incre = param[PARAM_INCM].i;
+	m[0] = param[PARAM_DIM].dim.m;
+	n[0] = param[PARAM_DIM].dim.n;
+	for (bblas_int i = 1; i < group_count; ++i) {
+		m[i] = m[i-1] + size_incre;
+		n[i] = n[i-1] + size_incre;
+	}
+
+
+	bblas_int *lda = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
+	bblas_int *ldb = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
+	bblas_int *ldc = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
+	bblas_int *k   = (bblas_int*)malloc((size_t)group_count*sizeof(bblas_int));
+
+	for (bblas_int i = 0; i < group_count; ++i) {
+		if (side[i] == BblasLeft) {
+			k[i]    = m[i];
+			lda[i]  = imax(1, m[i]);
+		}
+		else {
+			k[i]    = n[i];
+			lda[i]  = imax(1, n[i]);
+		}
+		ldb[i]  = imax(1, m[i]);
+		ldc[i]  = imax(1, m[i]);
+	}
+
+	int test = param[PARAM_TEST].c == 'y';
+	double eps = LAPACKE_dlamch('E');
+
+#ifdef COMPLEX
+	bblas_complex64_t alpha[group_count];
+	for (bblas_int i = 0; i < group_count; i++) {
+		alpha[i] =  param[PARAM_ALPHA].z;
+	}
+#else
+	double alpha[group_count];
+	for (bblas_int i = 0; i < group_count; i++) {
+		alpha[i] = creal(param[PARAM_ALPHA].z);
+	}
+#endif
+
+	//================================================================
+	// Allocate and initialize arrays.
+	//================================================================
+
+	bblas_int batch_count =0;
+	for (bblas_int i = 0; i < group_count; i++) {
+		batch_count += group_sizes[i];
+	}
+
+	bblas_complex64_t **A =
+		(bblas_complex64_t**)malloc((size_t)batch_count*sizeof(bblas_complex64_t*));
+	assert(A != NULL);
+
+	bblas_complex64_t **B =
+		(bblas_complex64_t**)malloc((size_t)batch_count*sizeof(bblas_complex64_t*));
+	assert(B != NULL);
+
+	bblas_complex64_t **C =
+		(bblas_complex64_t**)malloc((size_t)batch_count*sizeof(bblas_complex64_t*));
+	assert(C != NULL);
+
+	bblas_complex64_t **Bref = NULL;
+	if (test) {
+		Bref = (bblas_complex64_t**)malloc(
+				(size_t)batch_count*sizeof(bblas_complex64_t*));
+		assert(Bref != NULL);
+	}
+
+
+	// With --pad=y, the leading dimensions are padded to avoid cache set
+	// aliasing.
+	if (param[PARAM_PAD].c == 'y') {
+		bblas_advise_ld(group_count, k, sizeof(bblas_complex64_t), lda);
+		bblas_advise_ld(group_count, n, sizeof(bblas_complex64_t), ldb);
+		bblas_advise_ld(group_count, n, sizeof(bblas_complex64_t), ldc);
+	}
+
+	// With --shared=y, all the A[i] of a group are one matrix, and with
+	// --blocks=y, the B[i] and the C[i] of the group are consecutive blocks
+	// of two matrices: side by side on the left, on top of each other on
+	// the right. These groups are done by a single trmm.
+	char share_op[] = { 'n', 'n', 'n' };
+	if (param[PARAM_SHARED].c == 'y') {
+		share_op[0] = 's';
+		if (param[PARAM_BLOCKS].c == 'y') {
+			if (bblas_side_const(param[PARAM_SIDE].c) == BblasLeft) {
+				share_op[1] = share_op[2] = 'h';
+			}
+			else {
+				share_op[1] = share_op[2] = 'v';
+				for (bblas_int i = 0; i < group_count; i++) {
+					ldb[i] = imax(ldb[i], m[i]*group_sizes[i]);
+					ldc[i] = imax(ldc[i], m[i]*group_sizes[i]);
+				}
+			}
+		}
+	}
+	bool shared = share_op[0] == 's';
+
+	// With --alloc=y, all the matrices come from one arena instead of
+	// one malloc each, or from the pool of --shared.
+	bool contiguous = param[PARAM_ALLOC].c == 'y' || shared;
+	bblas_arena_t arena = NULL;
+	bblas_complex64_t *pool = NULL;
+	size_t pool_size = 0;
+	if (shared) {
+		const bblas_int *rows_op[] = { k, m, m };
+		const bblas_int *ld_op[]   = { lda, ldb, ldc };
+		const bblas_int *cols_op[] = { k, n, n };
+		void **X_op[]              = { (void**)A, (void**)B, (void**)C };
+		pool = (bblas_complex64_t*)pool_shared(group_count, group_sizes, 3,
+		                                       share_op, rows_op, ld_op, cols_op,
+		                                       sizeof(bblas_complex64_t), X_op,
+		                                       &pool_size);
+	}
+	else if (contiguous) {
+		const bblas_int *ld_op[]   = { lda, ldb, ldc };
+		const bblas_int *cols_op[] = { k, n, n };
+		size_t size_op[]     = { sizeof(bblas_complex64_t), sizeof(bblas_complex64_t), sizeof(bblas_complex64_t) };
+		void **X_op[]        = { (void**)A, (void**)B, (void**)C };
+		arena = bblas_batch_alloc(group_count, group_sizes, 3,
+		                          ld_op, cols_op, size_op, X_op);
+		assert(arena != NULL);
+	}
+
+	lapack_int seed[] = {0, 0, 0, 1};
+	lapack_int retval;
+
+	if (shared) {
+		retval = LAPACKE_zlarnv(1, seed, pool_size, pool);
+		assert(retval == 0);
+	}
+
+	bblas_int  group_start=0;
+	bblas_int  group_end =0;
+	for (bblas_int group_iter= 0; group_iter < group_count; group_iter++) {
+		group_start = group_end;
+		group_end += group_sizes[group_iter];
+		for (bblas_int matrix_iter= group_start; matrix_iter < group_end; matrix_iter++) {
+
+			if (! contiguous) {
+				A[matrix_iter] = (bblas_complex64_t*)malloc(
+						(size_t)lda[group_iter]*k[group_iter]*sizeof(bblas_complex64_t));
+				assert(A[matrix_iter] != NULL);
+				B[matrix_iter] = (bblas_complex64_t*)malloc(
+						(size_t)ldb[group_iter]*n[group_iter]*sizeof(bblas_complex64_t));
+				assert(B[matrix_iter] != NULL);
+				C[matrix_iter] = (bblas_complex64_t*)malloc(
+						(size_t)ldc[group_iter]*n[group_iter]*sizeof(bblas_complex64_t));
+				assert(C[matrix_iter] != NULL);
+			}
+
+			if (! shared) {
+				retval = LAPACKE_zlarnv(1, seed, (size_t)lda[group_iter]*k[group_iter], 
+						A[matrix_iter]);
+				assert(retval == 0);
+
+				retval = LAPACKE_zlarnv(1, seed, (size_t)ldb[group_iter]*n[group_iter], 
+						B[matrix_iter]);
+				assert(retval == 0);
+			}
+
+			// B[i] column by column, as the blocks of --blocks=y overlap
+			// within their leading dimension.
+			if (test) {
+				Bref[matrix_iter] = (bblas_complex64_t*)malloc(
+						(size_t)ldb[group_iter]*n[group_iter]*sizeof(
+							bblas_complex64_t));
+				assert(Bref[matrix_iter] != NULL);
+
+				for (bblas_int j = 0; j < n[group_iter]; j++)
+					memcpy(&Bref[matrix_iter][(size_t)ldb[group_iter]*j],
+					       &B[matrix_iter][(size_t)ldb[group_iter]*j],
+					       (size_t)m[group_iter]*sizeof(bblas_complex64_t));
+			}
+		}
+	}
+
+	//Set info
+	bblas_int info_size;
+	switch (bblas_info_const(param[PARAM_INFO].c)) {
+		case BblasErrorsReportAll :
+			info_size = batch_count +1;
+			break;
+		case BblasErrorsReportGroup :
+			info_size = group_count +1;
+			break;
+		case BblasErrorsReportAny :
+		case BblasErrorsReportNone :
+			info_size = 1;
+			break;
+		default :
+			bblas_error ("illegal value of info");
+			return;
+	}
+
+	bblas_int *info = (bblas_int*) malloc((size_t)info_size*sizeof(bblas_int))  ;
+	info[0] = bblas_info_const(param[PARAM_INFO].c);
+
+	// With --layouts=y, the odd groups are passed in row major:
+	// C = alpha op(A) B in column major is its transpose in row major with
+	// side and uplo flipped and m and n swapped, on the same storage, so the
+	// reference below is unchanged.
+	bool layouts = param[PARAM_LAYOUTS].c == 'y';
+	bblas_enum_t layout[group_count];
+	bblas_enum_t side_l[group_count];
+	bblas_enum_t uplo_l[group_count];
+	bblas_int m_l[group_count];
+	bblas_int n_l[group_count];
+	for (bblas_int group_iter = 0; group_iter < group_count; group_iter++) {
+		bool row = layouts && group_iter % 2 == 1;
+		layout[group_iter] = row ? BblasRowMajor : BblasColMajor;
+		side_l[group_iter] = row ? (side[group_iter] == BblasLeft ? BblasRight : BblasLeft)
+		                         : side[group_iter];
+		uplo_l[group_iter] = row ? (uplo[group_iter] == BblasLower ? BblasUpper : BblasLower)
+		                         : uplo[group_iter];
+		m_l[group_iter]    = row ? n[group_iter] : m[group_iter];
+		n_l[group_iter]    = row ? m[group_iter] : n[group_iter];
+	}
+	//================================================================
+	// Run and time BBLAS.
+	//================================================================
+	bblas_time_t start = gettime();
+
+	if (layouts)
+		blas_ztrmm_oop_batch_layouts(group_count, (const bblas_int *)group_sizes,
+				layout, side_l, uplo_l,
+				(const bblas_enum_t *)transa, (const bblas_enum_t *)diag,
+				m_l, n_l,
+				(const bblas_complex64_t *)alpha, (bblas_complex64_t const *const *)A, (const bblas_int *)lda,
+				                                  (bblas_complex64_t const *const *)B, (const bblas_int *)ldb,
+				                                                                    C, (const bblas_int *)ldc,
+				info);
+	else
+		blas_ztrmm_oop_batch(group_count, (const bblas_int *)group_sizes,
+				BblasColMajor, (const bblas_enum_t *)side, (const bblas_enum_t *)uplo,
+				(const bblas_enum_t *)transa, (const bblas_enum_t *)diag,
+				(const bblas_int *)m, (const bblas_int *)n,
+				(const bblas_complex64_t *)alpha, (bblas_complex64_t const *const *)A, (const bblas_int *)lda,
+								  (bblas_complex64_t const *const *)B, (const bblas_int *)ldb,
+								                                    C, (const bblas_int *)ldc,
+				info);
+
+	bblas_time_t stop = gettime();
+	bblas_time_t time = stop-start;
+
+	param[PARAM_TIME].d = time;
+
+	double flops = 0;
+	for (bblas_int group_iter = 0; group_iter < group_count; group_iter++) {
+		flops += flops_ztrmm(side[group_iter], m[group_iter], n[group_iter])
+			*group_sizes[group_iter];
+	}
+	param[PARAM_MFLOPS].d = flops / time / 1e6;
+
+	//=====================================================================
+	// Test Batched API results by comparing to regular mutiple blas calls .
+	//=====================================================================
+	if (test) {
+		bblas_complex64_t zmone = -1.0;
+		double error = 0.0;
+		double work[1];
+		group_end = 0;
+		for (bblas_int group_iter= 0; group_iter < group_count; group_iter++) {
+			group_start = group_end;
+			group_end += group_sizes[group_iter];
+			for (bblas_int matrix_iter= group_start; matrix_iter < group_end; matrix_iter++) {
+
+				// B must be left unchanged.
+				for (bblas_int j = 0; j < n[group_iter]; j++)
+					cblas_zaxpy(m[group_iter], CBLAS_SADDR(zmone),
+							&Bref[matrix_iter][(size_t)ldb[group_iter]*j], 1,
+							&B[matrix_iter][(size_t)ldb[group_iter]*j], 1);
+				error += LAPACKE_zlange_work(
+						LAPACK_COL_MAJOR, 'F', m[group_iter], n[group_iter], B[matrix_iter], ldb[group_iter], work);
+
+				cblas_ztrmm(CblasColMajor, (CBLAS_SIDE)side[group_iter], (CBLAS_UPLO)uplo[group_iter],
+						(CBLAS_TRANSPOSE)transa[group_iter], (CBLAS_DIAG)diag[group_iter],
+						m[group_iter], n[group_iter],
+						CBLAS_SADDR(alpha[group_iter]), A[matrix_iter], lda[group_iter], 
+						                             Bref[matrix_iter], ldb[group_iter]);
+
+				double Cnorm = LAPACKE_zlange_work(
+						LAPACK_COL_MAJOR, 'F', m[group_iter], n[group_iter], Bref[matrix_iter], ldb[group_iter], work);
+
+				for (bblas_int j = 0; j < n[group_iter]; j++) {
+					cblas_zaxpy(m[group_iter], CBLAS_SADDR(zmone),
+							&Bref[matrix_iter][(size_t)ldb[group_iter]*j], 1,
+							&C[matrix_iter][(size_t)ldc[group_iter]*j], 1);
+				}
+
+				double diff = LAPACKE_zlange_work(
+						LAPACK_COL_MAJOR, 'F', m[group_iter], n[group_iter], C[matrix_iter], ldc[group_iter], work);
+				if (Cnorm != 0.0)
+					diff /= Cnorm;
+				error += diff;
+			}
+		}
+		param[PARAM_ERROR].d = error;
+		param[PARAM_SUCCESS].i = error < param[PARAM_TOL].d*eps;
+	}
+
+	//================================================================
+	// Free arrays.
+	//================================================================
+
+	for (bblas_int matrix_iter = 0; matrix_iter < batch_count; matrix_iter++) { 
+
+		if (! contiguous) {
+			free(A[matrix_iter]);
+			free(B[matrix_iter]);
+			free(C[matrix_iter]);
+		}
+
+		if (test)
+			free(Bref[matrix_iter]);
+	}
+	bblas_batch_free(arena);
+	free(pool);
+	free(A);
+	free(B);
+	free(C);
+
+	if (test)
+		free(Bref);
+
+	free(n);
+	free(m);
+	free(k);
+
+	free(lda);
+	free(ldb);
+	free(ldc);
+	free(info);
+}
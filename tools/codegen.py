@@ -172,7 +172,7 @@ class SourceFile( object ):
         m = self.precisions_re.search( self._text )
         if m:
             self._is_generated = False
-            self._table = m.group(1)          # e.g.:  normal or mixed
+            self._table = m.group(1)          # e.g.:  normal, mixed, half or realcomplex
             self._src   = m.group(2)          # e.g.:  z
             self._dsts  = m.group(3).split()  # e.g.:  s, d, c
         else:
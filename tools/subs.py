@@ -70,6 +70,7 @@ blas_mixed = [
     #'12345678901234567890', '12345678901234567890')
 
     # ----- mixed "zc" routines
+    ('dsgemm',               'zcgemm'              ),
     ('dsposv',               'zcposv'              ),
     ('dsgesv',               'zcgesv'              ),
     ('dsgbsv',               'zcgbsv'              ),
@@ -100,6 +101,7 @@ blas_mixed = [
     ('dormqr',               'zunmqr'              ),
     ('dpotrf',               'zpotrf'              ),
     ('dpotrs',               'zpotrs'              ),
+    ('dscale',               'zscale'              ),
     ('dsymm',                'zhemm'               ),
     ('dsymv',                'zhemv'               ),
     ('dsyrk',                'zherk'               ),
@@ -140,8 +142,12 @@ blas = [
     ('scopy',                'dcopy',                'scopy',                'dcopy'               ),
     ('sdot',                 'ddot',                 'cdotc',                'zdotc'               ),
     ('sdot',                 'ddot',                 'cdotu',                'zdotu'               ),
+    ('sgbmm',                'dgbmm',                'cgbmm',                'zgbmm'               ),
+    ('sgbmv',                'dgbmv',                'cgbmv',                'zgbmv'               ),
+    ('sgather',              'dgather',              'cgather',              'zgather'             ),
     ('sgeadd',               'dgeadd',               'cgeadd',               'zgeadd'              ),
     ('sgemm',                'dgemm',                'cgemm',                'zgemm'               ),
+    ('sgemm',                'dgemm',                'sgemm',                'dgemm'               ),
     ('sgemv',                'dgemv',                'cgemv',                'zgemv'               ),
     ('sger',                 'dger',                 'cgerc',                'zgerc'               ),
     ('sger',                 'dger',                 'cgeru',                'zgeru'               ),
@@ -152,6 +158,7 @@ blas = [
     ('sscal',                'dscal',                'cscal',                'zscal'               ),
     ('sscal',                'dscal',                'csscal',               'zdscal'              ),
     ('sscal',                'dscal',                'sscal',                'dscal'               ),
+    ('sscatter',             'dscatter',             'cscatter',             'zscatter'            ),
     ('sswap',                'dswap',                'cswap',                'zswap'               ),
     ('ssymm',                'dsymm',                'chemm',                'zhemm'               ),
     ('ssymm',                'dsymm',                'csymm',                'zsymm'               ),
@@ -214,6 +221,7 @@ lapack = [
     ('sgetrf',               'dgetrf',               'cgetrf',               'zgetrf'              ),
     ('sgetri',               'dgetri',               'cgetri',               'zgetri'              ),
     ('sgetrs',               'dgetrs',               'cgetrs',               'zgetrs'              ),
+    ('sgtsv',                'dgtsv',                'cgtsv',                'zgtsv'               ),
     ('spbtrf',               'dpbtrf',               'cpbtrf',               'zpbtrf'              ),
     ('spbtrs',               'dpbtrs',               'cpbtrs',               'zpbtrs'              ),
     ('shseqr',               'dhseqr',               'chseqr',               'zhseqr'              ),
@@ -295,6 +303,7 @@ lapack = [
     ('spotrf',               'dpotrf',               'cpotrf',               'zpotrf'              ),
     ('spotri',               'dpotri',               'cpotri',               'zpotri'              ),
     ('spotrs',               'dpotrs',               'cpotrs',               'zpotrs'              ),
+    ('sptsv',                'dptsv',                'cptsv',                'zptsv'               ),
     ('sqpt01',               'dqpt01',               'cqpt01',               'zqpt01'              ),
     ('sqrt02',               'dqrt02',               'cqrt02',               'zqrt02'              ),
     ('ssbtrd',               'dsbtrd',               'chbtrd',               'zhbtrd'              ),
@@ -416,6 +425,71 @@ subs = {
 
   ],  # end mixed
 
+  # ------------------------------------------------------------
+  # replacements applied to 16-bit input, single precision accumulate files.
+  'half': [
+    # fp16,                  bf16
+    #'12345678901234567890', '12345678901234567890')
+
+    # ----- header (identifies precision; not a substitution)
+    ('sh',                   'sb'                  ),
+
+    # ----- Text
+    ('fp16',                 'bf16'                ),
+    ('FP16',                 'BF16'                ),
+
+    # ----- BBLAS routines
+    ('shgemm',               'sbgemm'              ),
+    ('SHGEMM',               'SBGEMM'              ),
+
+    # ----- BBLAS data types and conversions
+    ('bblas_half_t',         'bblas_bfloat16_t'    ),
+    ('bblas_h2s',            'bblas_b2s'           ),
+    ('bblas_s2h',            'bblas_s2b'           ),
+
+    # ----- header files
+    (r'_sh\.h\b',            r'_sb\.h\b'             ),
+    (r'_SH_H\b',             r'_SB_H\b'              ),
+
+  ],  # end half
+
+  # ------------------------------------------------------------
+  # replacements applied to real-times-complex files.
+  'realcomplex': [
+    # single                 double
+    #'12345678901234567890', '12345678901234567890')
+
+    # ----- header (identifies precision; not a substitution)
+    ('sc',                   'dz'                  ),
+
+    # ----- BBLAS routines (before the BLAS names they contain)
+    ('scgemm',               'dzgemm'              ),
+    ('csgemm',               'zdgemm'              ),
+    ('SCGEMM',               'DZGEMM'              ),
+    ('CSGEMM',               'ZDGEMM'              ),
+
+    # ----- data types
+    ('bblas_complex32_t',    'bblas_complex64_t'   ),
+    ('float',                'double'              ),
+
+    # ----- BLAS and LAPACK
+    ('sgemm',                'dgemm'               ),
+    ('cgemm',                'zgemm'               ),
+    ('cscale',               'zscale'              ),
+    ('saxpy',                'daxpy'               ),
+    ('caxpy',                'zaxpy'               ),
+    ('slarnv',               'dlarnv'              ),
+    ('clarnv',               'zlarnv'              ),
+    ('slamch',               'dlamch'              ),
+    ('slange',               'dlange'              ),
+    ('clange',               'zlange'              ),
+
+    # ----- header files
+    (r'_sc\.h\b',            r'_dz\.h\b'             ),
+    (r'_SC_H\b',             r'_DZ_H\b'              ),
+
+  ],  # end realcomplex
+
   # ------------------------------------------------------------
   # replacements applied to most files.
   'normal': [